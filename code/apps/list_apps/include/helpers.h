@@ -13,6 +13,7 @@
 #ifdef BIDIRECTIONAL
     #include "linked_list/bidirectional.h"
     typedef BiNode Node;
+    typedef BiNode Item;
 
     // Defining macros to be use functions
     #define displayList displayBiList
@@ -35,9 +36,44 @@
     #define deleteAllRec deleteEntireBiListRecursively
     #define getCountIter getBiNodesCount
     #define getCountRec getBiNodesCountRecursively
+#elif defined(HASHED)
+    /**
+     * REMARK:
+     *
+     * The hash table is an alternative backend: the app "list" is a hash table
+     * (NULL when empty like a list root) whose buckets are unidirectional
+     * lists, and found items are their nodes. As a hash table is neither
+     * ordered nor recursive, the ordered and recursive operations are the same
+     * as the unordered iterative ones.
+     */
+    #include "linked_list/hash_table.h"
+    typedef HashTable Node;
+    typedef UniNode Item;
+
+    #define displayList displayHashTable
+    #define listToString hashTableToString
+    #define addIter addHashNode
+    #define addOrderedIter addHashNode
+    #define addRec addHashNode
+    #define addOrderedRec addHashNode
+    #define findIter findHashNode
+    #define findOrderedIter findHashNode
+    #define findRec findHashNode
+    #define findOrderedRec findHashNode
+    #define updateIter updateHashNode
+    #define updateRec updateHashNode
+    #define deleteIter deleteHashNode
+    #define deleteOrderedIter deleteHashNode
+    #define deleteRec deleteHashNode
+    #define deleteOrderedRec deleteHashNode
+    #define deleteAllIter deleteEntireHashTable
+    #define deleteAllRec deleteEntireHashTable
+    #define getCountIter getHashNodesCount
+    #define getCountRec getHashNodesCount
 #else
     #include "linked_list/unidirectional.h"
     typedef UniNode Node;
+    typedef UniNode Item;
 
     #define displayList displayUniList
     #define listToString uniListToString
@@ -194,7 +194,7 @@ void performListOperation(Node **root,
             scanf("%d", &value);
             clearAnyRemainingChars();
 
-            Node *itemPtr;
+            Item *itemPtr;
             if(recursive) {
                 if(listType == UNORDERED) {
                     itemPtr = findRec(*root, value);
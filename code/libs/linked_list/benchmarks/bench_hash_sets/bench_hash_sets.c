@@ -0,0 +1,165 @@
+/**
+ * @file bench_hash_sets.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the open-addressing integer set ("swiss_set.h")
+ *        against the chained hash table of unidirectional lists
+ *        ("hash_table.h"), adding, finding (existing and missing values) and
+ *        deleting the same random values.
+ *
+ * Usage: bench_hash_sets [numValues]
+ *
+ * Times are given in nanoseconds per operation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/hash_table.h"
+#include "linked_list/swiss_set.h"
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Returns a pseudo-random int made of two calls to rand (RAND_MAX may
+ *        be as small as 32767).
+ */
+static int getRandomValue() {
+    return (int) (((unsigned) rand() << 16) ^ (unsigned) rand());
+}
+
+/**
+ * @brief Prints one row of results.
+ */
+static void printRow(const char *name,
+                     double add,
+                     double findHit,
+                     double findMiss,
+                     double delete,
+                     size_t numValues) {
+    printf("%-12s %10.1f %10.1f %10.1f %10.1f\n",
+           name,
+           add * 1e9 / numValues,
+           findHit * 1e9 / numValues,
+           findMiss * 1e9 / numValues,
+           delete * 1e9 / numValues);
+}
+
+int main(int argc, char *args[]) {
+    size_t numValues = argc > 1 ? strtoul(args[1], NULL, 10) : 1000000;
+
+    if(argc > 2 || numValues == 0) {
+        fprintf(stderr, "Usage: %s [numValues]\n", args[0]);
+        exit(1);
+    }
+
+    // Values (even) and missing values (odd)
+    int *values = malloc(numValues * sizeof(int));
+    int *missing = malloc(numValues * sizeof(int));
+
+    if(!values || !missing) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    srand(1);
+
+    for(size_t i = 0; i < numValues; ++i) {
+        values[i] = getRandomValue() & ~1;
+        missing[i] = getRandomValue() | 1;
+    }
+
+    size_t numFound = 0;
+    double start;
+
+    printf("Values = %zu (ns per operation)\n", numValues);
+    printf("%-12s %10s %10s %10s %10s\n",
+           "set",
+           "add",
+           "find hit",
+           "find miss",
+           "delete");
+
+    // Chained hash table
+    HashTable *table = NULL;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        addHashNode(&table, values[i]);
+    }
+    double add = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findHashNode(table, values[i]) != NULL;
+    }
+    double findHit = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findHashNode(table, missing[i]) != NULL;
+    }
+    double findMiss = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        deleteHashNode(&table, values[i]);
+    }
+    double delete = now() - start;
+
+    deleteEntireHashTable(&table);
+    printRow("hash table", add, findHit, findMiss, delete, numValues);
+
+    // Open-addressing set
+    SwissSet set;
+
+    if(!initSwissSet(&set)) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        addSwissValue(&set, values[i]);
+    }
+    add = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findSwissValue(&set, values[i]);
+    }
+    findHit = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findSwissValue(&set, missing[i]);
+    }
+    findMiss = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        deleteSwissValue(&set, values[i]);
+    }
+    delete = now() - start;
+
+    deleteEntireSwissSet(&set);
+    printRow("swiss set", add, findHit, findMiss, delete, numValues);
+
+    // Keeps the lookups from being optimized away
+    printf("Found = %zu\n", numFound);
+
+    free(values);
+    free(missing);
+
+    return 0;
+}
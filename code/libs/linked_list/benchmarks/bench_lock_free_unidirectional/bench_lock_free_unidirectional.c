@@ -0,0 +1,232 @@
+/**
+ * @file bench_lock_free_unidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the throughput of the lock-free ordered list
+ *        ("lock_free_unidirectional.h") against the ordered unidirectional
+ *        list ("unidirectional.h") protected by one global mutex, while the
+ *        number of threads contending on the same list grows.
+ *
+ * Usage: bench_lock_free_unidirectional [maxThreads] [numKeys] [opsPerThread]
+ *                                       [readPercentage]
+ *
+ * The workload is run with 1, 2, 4, ... up to maxThreads threads. The
+ * operations that are not lookups are equally split between additions and
+ * deletions of random keys in [0, numKeys).
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/lock_free_unidirectional.h"
+#include "linked_list/unidirectional.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def MAX_THREADS
+ *
+ * @brief The maximum number of threads.
+ */
+#define MAX_THREADS 256
+
+/**
+ * @brief The kind of list being benchmarked.
+ */
+typedef enum Backend {
+    MUTEX_LIST,
+    LOCK_FREE_LIST
+} Backend;
+
+/**
+ * @brief The settings shared by all threads of a workload.
+ */
+typedef struct Workload {
+    Backend backend;
+    unsigned readPercentage;
+    size_t numKeys;
+    size_t opsPerThread;
+} Workload;
+
+/**
+ * @brief The arguments of every thread.
+ */
+typedef struct WorkerArgs {
+    const Workload *workload;
+    unsigned long long seed;
+    size_t found;
+} WorkerArgs;
+
+// The lists and lock shared by the threads
+UniNode *mutexList = NULL;
+pthread_mutex_t listMutex = PTHREAD_MUTEX_INITIALIZER;
+LockFreeUniList lockFreeList;
+
+/**
+ * @brief A small xorshift64* pseudo-random generator, being faster than rand()
+ *        and, unlike it, safe to use from several threads.
+ *
+ * @param state Pointer to the non-zero generator state.
+ *
+ * @return The next pseudo-random 64-bit number.
+ */
+static unsigned long long nextRandom(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Runs the operations of one thread.
+ *
+ * @param arg Pointer to the WorkerArgs of the thread.
+ */
+static void *runWorker(void *arg) {
+    WorkerArgs *args = arg;
+    const Workload *workload = args->workload;
+    unsigned long long state = args->seed;
+
+    for(size_t i = 0; i < workload->opsPerThread; ++i) {
+        unsigned long long random = nextRandom(&state);
+        int key = (int) ((random >> 8) % workload->numKeys);
+        bool read = random % 100 < workload->readPercentage;
+        bool add = (random >> 7) & 1;
+
+        if(workload->backend == LOCK_FREE_LIST) {
+            if(read) {
+                args->found += findOrderedLockFreeUniNode(&lockFreeList, key);
+            }
+            else if(add) {
+                addOrderedLockFreeUniNode(&lockFreeList, key);
+            }
+            else {
+                deleteOrderedLockFreeUniNode(&lockFreeList, key);
+            }
+        }
+        else {
+            pthread_mutex_lock(&listMutex);
+
+            if(read) {
+                args->found += findOrderedUniNode(mutexList, key) != NULL;
+            }
+            else if(add) {
+                addOrderedUniNode(&mutexList, key);
+            }
+            else {
+                deleteOrderedUniNode(&mutexList, key);
+            }
+
+            pthread_mutex_unlock(&listMutex);
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief Runs a workload and returns its throughput in millions of operations
+ *        per second.
+ */
+static double runWorkload(const Workload *workload, size_t numThreads) {
+    pthread_t threads[MAX_THREADS];
+    WorkerArgs args[MAX_THREADS];
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+    // Half filling the lists with random keys
+    mutexList = NULL;
+    initLockFreeUniList(&lockFreeList);
+
+    for(size_t i = 0; i < workload->numKeys / 2; ++i) {
+        int key = (int) (nextRandom(&state) % workload->numKeys);
+
+        if(workload->backend == LOCK_FREE_LIST) {
+            addOrderedLockFreeUniNode(&lockFreeList, key);
+        }
+        else {
+            addOrderedUniNode(&mutexList, key);
+        }
+    }
+
+    double start = now();
+
+    for(size_t t = 0; t < numThreads; ++t) {
+        args[t].workload = workload;
+        args[t].seed = nextRandom(&state) | 1;
+        args[t].found = 0;
+
+        if(pthread_create(&threads[t], NULL, runWorker, &args[t]) != 0) {
+            fprintf(stderr, "Thread creation failed!\n");
+            exit(1);
+        }
+    }
+
+    for(size_t t = 0; t < numThreads; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    double elapsed = now() - start;
+
+    deleteEntireUniList(&mutexList);
+    deleteEntireLockFreeUniList(&lockFreeList);
+    reclaimAllEBRPointers();
+
+    return numThreads * workload->opsPerThread / elapsed * 1e-6;
+}
+
+int main(int argc, char *args[]) {
+    size_t maxThreads = argc > 1 ? strtoul(args[1], NULL, 10) : 8;
+    size_t numKeys = argc > 2 ? strtoul(args[2], NULL, 10) : 512;
+    size_t opsPerThread = argc > 3 ? strtoul(args[3], NULL, 10) : 50000;
+    unsigned readPercentage = argc > 4 ? strtoul(args[4], NULL, 10) : 80;
+
+    if(argc > 5 || maxThreads == 0 || maxThreads > MAX_THREADS ||
+       numKeys == 0 || opsPerThread == 0 || readPercentage > 100) {
+        fprintf(stderr,
+                "Usage: %s [maxThreads (1 to %d)] [numKeys] [opsPerThread] "
+                "[readPercentage (0 to 100)]\n",
+                args[0],
+                MAX_THREADS);
+        exit(1);
+    }
+
+    printf("Keys = %zu, operations per thread = %zu, reads = %u%%\n",
+           numKeys, opsPerThread, readPercentage);
+    printf("%-8s %16s %18s\n", "threads", "mutex Mops/s", "lock-free Mops/s");
+
+    for(size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        double throughputs[2];
+
+        for(int backend = MUTEX_LIST; backend <= LOCK_FREE_LIST; ++backend) {
+            Workload workload = {backend,
+                                 readPercentage,
+                                 numKeys,
+                                 opsPerThread};
+
+            throughputs[backend] = runWorkload(&workload, numThreads);
+        }
+
+        printf("%-8zu %16.2f %18.2f\n",
+               numThreads,
+               throughputs[MUTEX_LIST],
+               throughputs[LOCK_FREE_LIST]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file bench_packed_array.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the packed memory array ("packed_array.h") against
+ *        the ordered unidirectional list ("unidirectional.h"), adding,
+ *        finding, scanning in order and deleting the same random values.
+ *
+ * Usage: bench_packed_array [numValues]
+ *
+ * Times are given in nanoseconds per operation (per value for the scan). As
+ * every operation of the ordered list walks half of it on average, numValues
+ * is kept small by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/packed_array.h"
+#include "linked_list/unidirectional.h"
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Returns a pseudo-random int made of two calls to rand (RAND_MAX may
+ *        be as small as 32767).
+ */
+static int getRandomValue() {
+    return (int) (((unsigned) rand() << 16) ^ (unsigned) rand());
+}
+
+/**
+ * @brief Prints one row of results.
+ */
+static void printRow(const char *name,
+                     double add,
+                     double find,
+                     double scan,
+                     double delete,
+                     size_t numValues) {
+    printf("%-14s %10.1f %10.1f %10.2f %10.1f\n",
+           name,
+           add * 1e9 / numValues,
+           find * 1e9 / numValues,
+           scan * 1e9 / numValues,
+           delete * 1e9 / numValues);
+}
+
+int main(int argc, char *args[]) {
+    size_t numValues = argc > 1 ? strtoul(args[1], NULL, 10) : 20000;
+
+    if(argc > 2 || numValues == 0) {
+        fprintf(stderr, "Usage: %s [numValues]\n", args[0]);
+        exit(1);
+    }
+
+    int *values = malloc(numValues * sizeof(int));
+    int *scanned = malloc(numValues * sizeof(int));
+
+    if(!values || !scanned) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    srand(1);
+
+    for(size_t i = 0; i < numValues; ++i) {
+        values[i] = getRandomValue();
+    }
+
+    size_t numFound = 0;
+    long long sum = 0;
+    double start;
+
+    printf("Values = %zu (ns per operation)\n", numValues);
+    printf("%-14s %10s %10s %10s %10s\n",
+           "ordered set",
+           "add",
+           "find",
+           "scan",
+           "delete");
+
+    // Ordered unidirectional list
+    UniNode *root = NULL;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        addOrderedUniNode(&root, values[i]);
+    }
+    double add = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findOrderedUniNode(root, values[i]) != NULL;
+    }
+    double find = now() - start;
+
+    start = now();
+    for(UniNode *node = root; node; node = node->next) {
+        sum += node->value;
+    }
+    double scan = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        deleteOrderedUniNode(&root, values[i]);
+    }
+    double delete = now() - start;
+
+    deleteEntireUniList(&root);
+    printRow("ordered list", add, find, scan, delete, numValues);
+
+    // Packed memory array
+    PackedArray array;
+
+    if(!initPackedArray(&array)) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        addOrderedPackedValue(&array, values[i]);
+    }
+    add = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        numFound += findOrderedPackedValue(&array, values[i]);
+    }
+    find = now() - start;
+
+    start = now();
+    size_t numScanned = getOrderedPackedRange(&array,
+                                              -2147483647 - 1,
+                                              2147483647,
+                                              scanned,
+                                              numValues);
+
+    for(size_t i = 0; i < numScanned; ++i) {
+        sum += scanned[i];
+    }
+    scan = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numValues; ++i) {
+        deleteOrderedPackedValue(&array, values[i]);
+    }
+    delete = now() - start;
+
+    deleteEntirePackedArray(&array);
+    printRow("packed array", add, find, scan, delete, numValues);
+
+    // Keeps the lookups and the scans from being optimized away
+    printf("Found = %zu, sum = %lld\n", numFound, sum);
+
+    free(values);
+    free(scanned);
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file bench_parallel_sort.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the parallel sort ("parallel_sort.h") of
+ *        unidirectional and bidirectional lists against their sequential sort
+ *        (sortUniList and sortBiList), while the number of threads grows.
+ *
+ * Usage: bench_parallel_sort [maxThreads] [numValues]
+ *
+ * Every run sorts the same random values, and the parallel sort is run with
+ * 1, 2, 4, ... up to maxThreads threads. The speedup is relative to the
+ * sequential sort.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/parallel_sort.h"
+
+/**
+ * @def MAX_THREADS
+ *
+ * @brief The maximum number of threads.
+ */
+#define MAX_THREADS 256
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Links the given nodes in array order and fills them with the same
+ *        pseudo-random values every time.
+ *
+ * @return The first node of the list.
+ */
+static UniNode *resetUniList(UniNode *nodes, size_t numValues) {
+    srand(1);
+
+    for(size_t i = 0; i < numValues; ++i) {
+        nodes[i].value = rand();
+        nodes[i].next = i + 1 < numValues ? &nodes[i + 1] : NULL;
+    }
+
+    return nodes;
+}
+
+/**
+ * @brief Links the given nodes in array order and fills them with the same
+ *        pseudo-random values every time.
+ *
+ * @return The first node of the list.
+ */
+static BiNode *resetBiList(BiNode *nodes, size_t numValues) {
+    srand(1);
+
+    for(size_t i = 0; i < numValues; ++i) {
+        nodes[i].value = rand();
+        nodes[i].prev = i > 0 ? &nodes[i - 1] : NULL;
+        nodes[i].next = i + 1 < numValues ? &nodes[i + 1] : NULL;
+    }
+
+    return nodes;
+}
+
+int main(int argc, char *args[]) {
+    size_t maxThreads = argc > 1 ? strtoul(args[1], NULL, 10) : 8;
+    size_t numValues = argc > 2 ? strtoul(args[2], NULL, 10) : 4000000;
+
+    if(argc > 3 || maxThreads == 0 || maxThreads > MAX_THREADS ||
+       numValues == 0) {
+        fprintf(stderr,
+                "Usage: %s [maxThreads (1 to %d)] [numValues]\n",
+                args[0],
+                MAX_THREADS);
+        exit(1);
+    }
+
+    UniNode *uniNodes = malloc(numValues * sizeof(UniNode));
+    BiNode *biNodes = malloc(numValues * sizeof(BiNode));
+
+    if(!uniNodes || !biNodes) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    printf("Values = %zu\n", numValues);
+    printf("%-8s %-10s %12s %10s\n", "list", "threads", "seconds", "speedup");
+
+    // Sequential sorts (reference)
+    UniNode *uniRoot = resetUniList(uniNodes, numValues);
+    double start = now();
+    sortUniList(&uniRoot);
+    double uniSequential = now() - start;
+
+    BiNode *biRoot = resetBiList(biNodes, numValues);
+    start = now();
+    sortBiList(&biRoot);
+    double biSequential = now() - start;
+
+    printf("%-8s %-10s %12.3f %10.2f\n", "uni", "sequential", uniSequential, 1.0);
+    printf("%-8s %-10s %12.3f %10.2f\n", "bi", "sequential", biSequential, 1.0);
+
+    for(size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        uniRoot = resetUniList(uniNodes, numValues);
+        start = now();
+        sortUniListInParallel(&uniRoot, numThreads);
+        double elapsed = now() - start;
+
+        printf("%-8s %-10zu %12.3f %10.2f\n",
+               "uni",
+               numThreads,
+               elapsed,
+               uniSequential / elapsed);
+
+        biRoot = resetBiList(biNodes, numValues);
+        start = now();
+        sortBiListInParallel(&biRoot, numThreads);
+        elapsed = now() - start;
+
+        printf("%-8s %-10zu %12.3f %10.2f\n",
+               "bi",
+               numThreads,
+               elapsed,
+               biSequential / elapsed);
+    }
+
+    free(uniNodes);
+    free(biNodes);
+
+    return 0;
+}
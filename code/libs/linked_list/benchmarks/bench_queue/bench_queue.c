@@ -0,0 +1,302 @@
+/**
+ * @file bench_queue.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the throughput of the MPMC and MPSC queues
+ *        ("queue.h") against a queue of unidirectional nodes protected by one
+ *        global mutex, with producer threads adding values and consumer
+ *        threads removing them at the same time.
+ *
+ * Usage: bench_queue [numProducers] [numConsumers] [itemsPerProducer]
+ *
+ * The MPSC queue is only benchmarked with a single consumer. The mutex-guarded
+ * queue keeps a pointer to its last node, as adding with addUniNode (which
+ * walks the entire list) would make the comparison meaningless.
+ */
+
+// Needed for sched_yield as we compile in strict C standard mode
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/queue.h"
+#include "linked_list/unidirectional.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def MAX_THREADS
+ *
+ * @brief The maximum number of producers and of consumers.
+ */
+#define MAX_THREADS 128
+
+/**
+ * @brief The kind of queue being benchmarked.
+ */
+typedef enum Backend {
+    MUTEX_QUEUE,
+    MPMC_QUEUE,
+    MPSC_QUEUE
+} Backend;
+
+/**
+ * @brief The settings shared by all threads of a workload.
+ */
+typedef struct Workload {
+    Backend backend;
+    size_t itemsPerProducer;
+    size_t totalItems;
+} Workload;
+
+// The queues shared by the threads
+UniNode *mutexHead = NULL;
+UniNode *mutexTail = NULL;
+pthread_mutex_t queueMutex = PTHREAD_MUTEX_INITIALIZER;
+MPMCQueue mpmcQueue;
+MPSCQueue mpscQueue;
+
+// The number of values removed by all consumers
+atomic_size_t numConsumed;
+
+// The sum of the removed values (which keeps the removals from being dropped)
+atomic_llong consumedSum;
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Adds a value at the back of the mutex-guarded queue in O(1).
+ */
+static bool enqueueMutex(int value) {
+    UniNode *newNode = malloc(sizeof(UniNode));
+
+    if(newNode) {
+        newNode->value = value;
+        newNode->next = NULL;
+
+        pthread_mutex_lock(&queueMutex);
+
+        if(mutexTail) {
+            mutexTail->next = newNode;
+        }
+        else {
+            mutexHead = newNode;
+        }
+
+        mutexTail = newNode;
+        pthread_mutex_unlock(&queueMutex);
+    }
+
+    return newNode != NULL;
+}
+
+/**
+ * @brief Removes the value at the front of the mutex-guarded queue.
+ */
+static bool dequeueMutex(int *valuePtr) {
+    pthread_mutex_lock(&queueMutex);
+    UniNode *node = mutexHead;
+
+    if(node) {
+        mutexHead = node->next;
+
+        if(!mutexHead) {
+            mutexTail = NULL;
+        }
+    }
+
+    pthread_mutex_unlock(&queueMutex);
+
+    if(node) {
+        *valuePtr = node->value;
+        free(node);
+    }
+
+    return node != NULL;
+}
+
+/**
+ * @brief Runs a producer thread.
+ *
+ * @param arg Pointer to the Workload.
+ */
+static void *runProducer(void *arg) {
+    const Workload *workload = arg;
+
+    for(size_t i = 0; i < workload->itemsPerProducer; ++i) {
+        int value = (int) i;
+
+        switch(workload->backend) {
+            case MUTEX_QUEUE:
+                enqueueMutex(value);
+                break;
+
+            case MPMC_QUEUE:
+                enqueueMPMC(&mpmcQueue, value);
+                break;
+
+            case MPSC_QUEUE: {
+                // The node is freed by the consumer (intrusive queue)
+                QueueNode *node = malloc(sizeof(QueueNode));
+
+                if(node) {
+                    node->value = value;
+                    enqueueMPSC(&mpscQueue, node);
+                }
+                break;
+            }
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief Runs a consumer thread until all values are removed.
+ *
+ * @param arg Pointer to the Workload.
+ */
+static void *runConsumer(void *arg) {
+    const Workload *workload = arg;
+    long long sum = 0;
+
+    while(atomic_load(&numConsumed) < workload->totalItems) {
+        bool removed = false;
+        int value = 0;
+
+        switch(workload->backend) {
+            case MUTEX_QUEUE:
+                removed = dequeueMutex(&value);
+                break;
+
+            case MPMC_QUEUE:
+                removed = dequeueMPMC(&mpmcQueue, &value);
+                break;
+
+            case MPSC_QUEUE: {
+                QueueNode *node = dequeueMPSC(&mpscQueue);
+
+                if(node) {
+                    value = node->value;
+                    free(node);
+                    removed = true;
+                }
+                break;
+            }
+        }
+
+        if(removed) {
+            sum += value;
+            atomic_fetch_add(&numConsumed, 1);
+        }
+        else {
+            sched_yield();
+        }
+    }
+
+    atomic_fetch_add(&consumedSum, sum);
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief Runs a workload and returns its throughput in millions of values
+ *        per second (moved from producers to consumers).
+ */
+static double runWorkload(const Workload *workload,
+                          size_t numProducers,
+                          size_t numConsumers) {
+    pthread_t producers[MAX_THREADS], consumers[MAX_THREADS];
+
+    mutexHead = mutexTail = NULL;
+    initMPMCQueue(&mpmcQueue);
+    initMPSCQueue(&mpscQueue);
+    atomic_store(&numConsumed, 0);
+    atomic_store(&consumedSum, 0);
+
+    double start = now();
+
+    for(size_t c = 0; c < numConsumers; ++c) {
+        if(pthread_create(&consumers[c], NULL, runConsumer,
+                          (void *) workload) != 0) {
+            fprintf(stderr, "Thread creation failed!\n");
+            exit(1);
+        }
+    }
+
+    for(size_t p = 0; p < numProducers; ++p) {
+        if(pthread_create(&producers[p], NULL, runProducer,
+                          (void *) workload) != 0) {
+            fprintf(stderr, "Thread creation failed!\n");
+            exit(1);
+        }
+    }
+
+    for(size_t p = 0; p < numProducers; ++p) {
+        pthread_join(producers[p], NULL);
+    }
+
+    for(size_t c = 0; c < numConsumers; ++c) {
+        pthread_join(consumers[c], NULL);
+    }
+
+    double elapsed = now() - start;
+
+    deleteEntireMPMCQueue(&mpmcQueue);
+    reclaimAllEBRPointers();
+
+    return workload->totalItems / elapsed * 1e-6;
+}
+
+int main(int argc, char *args[]) {
+    size_t numProducers = argc > 1 ? strtoul(args[1], NULL, 10) : 2;
+    size_t numConsumers = argc > 2 ? strtoul(args[2], NULL, 10) : 2;
+    size_t itemsPerProducer = argc > 3 ? strtoul(args[3], NULL, 10) : 500000;
+
+    if(argc > 4 || numProducers == 0 || numProducers > MAX_THREADS ||
+       numConsumers == 0 || numConsumers > MAX_THREADS ||
+       itemsPerProducer == 0) {
+        fprintf(stderr,
+                "Usage: %s [numProducers (1 to %d)] [numConsumers (1 to %d)] "
+                "[itemsPerProducer]\n",
+                args[0],
+                MAX_THREADS,
+                MAX_THREADS);
+        exit(1);
+    }
+
+    printf("Producers = %zu, consumers = %zu, items per producer = %zu\n",
+           numProducers, numConsumers, itemsPerProducer);
+    printf("%-8s %16s\n", "queue", "Mitems/s");
+
+    const char *names[] = {"mutex", "MPMC", "MPSC"};
+    Backend lastBackend = numConsumers == 1 ? MPSC_QUEUE : MPMC_QUEUE;
+
+    for(int backend = MUTEX_QUEUE; backend <= (int) lastBackend; ++backend) {
+        Workload workload = {backend,
+                             itemsPerProducer,
+                             numProducers * itemsPerProducer};
+
+        printf("%-8s %16.2f\n",
+               names[backend],
+               runWorkload(&workload, numProducers, numConsumers));
+    }
+
+    return 0;
+}
@@ -0,0 +1,300 @@
+/**
+ * @file bench_self_organizing.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the self-organizing searches of unordered
+ *        unidirectional lists (findUniNodeMovingToFront and
+ *        findUniNodeTransposing in "unidirectional.h") against findUniNode,
+ *        on lookup traces following a Zipf distribution.
+ *
+ * Usage: bench_self_organizing [numValues] [numLookups] [exponent]
+ *
+ * The list holds the values 0 to numValues - 1 in a random order. Value i is
+ * looked up with a probability proportional to 1 / (i + 1)^exponent, so a few
+ * values make up most lookups (the bigger the exponent, the more skewed). All
+ * searches replay the same trace, starting from the same list, and the
+ * average number of visited nodes is reported along with the time.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "linked_list/unidirectional.h"
+
+/**
+ * @brief The searches being benchmarked.
+ */
+typedef enum Search {
+    PLAIN_SEARCH,
+    MOVE_TO_FRONT_SEARCH,
+    TRANSPOSE_SEARCH
+} Search;
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Returns a pseudo-random number in [0, 1).
+ */
+static double getRandom() {
+    return (double) rand() / ((double) RAND_MAX + 1.0);
+}
+
+/**
+ * @brief Fills the trace with values drawn from a Zipf distribution over
+ *        [0, numValues), by binary-searching the cumulative distribution.
+ *
+ * @return True if the trace got filled and false otherwise (allocation
+ *         failure).
+ */
+static bool fillZipfTrace(int *trace,
+                          size_t numLookups,
+                          size_t numValues,
+                          double exponent) {
+    double *cumulative = malloc(numValues * sizeof(double));
+    bool filled = cumulative != NULL;
+
+    if(filled) {
+        double sum = 0.0;
+
+        for(size_t i = 0; i < numValues; ++i) {
+            sum += 1.0 / pow((double) (i + 1), exponent);
+            cumulative[i] = sum;
+        }
+
+        for(size_t l = 0; l < numLookups; ++l) {
+            double target = getRandom() * sum;
+            size_t low = 0, high = numValues - 1;
+
+            while(low < high) {
+                size_t middle = low + (high - low) / 2;
+
+                if(cumulative[middle] <= target) {
+                    low = middle + 1;
+                }
+                else {
+                    high = middle;
+                }
+            }
+
+            trace[l] = (int) low;
+        }
+
+        free(cumulative);
+    }
+
+    return filled;
+}
+
+/**
+ * @brief Builds a list holding 0 to numValues - 1 in the same pseudo-random
+ *        order every time.
+ *
+ * @note The nodes are linked in a random order of their addresses too, as the
+ *       nodes of a long-lived list are scattered in memory. Otherwise, the
+ *       plain search would walk memory sequentially while the reorganized
+ *       lists would not, which would bias the comparison.
+ *
+ * @return The root node of the list (NULL on allocation failure).
+ */
+static UniNode *buildList(UniNode **nodes, int *values, size_t numValues) {
+    UniNode *root = NULL;
+
+    srand(2);
+
+    for(size_t i = 0; i < numValues; ++i) {
+        nodes[i] = malloc(sizeof(UniNode));
+        values[i] = (int) i;
+    }
+
+    // Fisher-Yates shuffles of the node addresses and of the values
+    for(size_t i = numValues; i > 1; --i) {
+        size_t j = (size_t) (getRandom() * i);
+        size_t k = (size_t) (getRandom() * i);
+        UniNode *node = nodes[i - 1];
+        int value = values[i - 1];
+
+        nodes[i - 1] = nodes[j];
+        nodes[j] = node;
+        values[i - 1] = values[k];
+        values[k] = value;
+    }
+
+    // Linking from the last node, so that a failed allocation is skipped
+    for(size_t i = numValues; i > 0; --i) {
+        if(nodes[i - 1]) {
+            nodes[i - 1]->value = values[i - 1];
+            nodes[i - 1]->next = root;
+            root = nodes[i - 1];
+        }
+    }
+
+    if(getUniNodesCount(root) != numValues) {
+        deleteEntireUniList(&root);
+    }
+
+    return root;
+}
+
+/**
+ * @brief Counts the nodes visited to find the given value (its position).
+ */
+static size_t getDepth(UniNode *root, int value) {
+    size_t depth = 1;
+
+    while(root && root->value != value) {
+        root = root->next;
+        depth += 1;
+    }
+
+    return depth;
+}
+
+/**
+ * @brief Replays the trace with the given search on a fresh list.
+ *
+ * @param depths Set to the average number of visited nodes per lookup.
+ *
+ * @return The elapsed time in seconds (negative on allocation failure).
+ */
+static double replay(Search search,
+                     const int *trace,
+                     size_t numLookups,
+                     UniNode **nodes,
+                     int *values,
+                     size_t numValues,
+                     double *depths) {
+    UniNode *root = buildList(nodes, values, numValues);
+    size_t found = 0, totalDepth = 0;
+    double elapsed = -1.0;
+
+    if(root) {
+        double start = now();
+
+        for(size_t l = 0; l < numLookups; ++l) {
+            UniNode *itemPtr = NULL;
+
+            switch(search) {
+                case PLAIN_SEARCH:
+                    itemPtr = findUniNode(root, trace[l]);
+                    break;
+
+                case MOVE_TO_FRONT_SEARCH:
+                    itemPtr = findUniNodeMovingToFront(&root, trace[l]);
+                    break;
+
+                case TRANSPOSE_SEARCH:
+                    itemPtr = findUniNodeTransposing(&root, trace[l]);
+                    break;
+            }
+
+            found += itemPtr != NULL;
+        }
+
+        elapsed = now() - start;
+        deleteEntireUniList(&root);
+
+        // The visited nodes are counted on a separate (untimed) replay
+        root = buildList(nodes, values, numValues);
+
+        for(size_t l = 0; l < numLookups && root; ++l) {
+            totalDepth += getDepth(root, trace[l]);
+
+            if(search == MOVE_TO_FRONT_SEARCH) {
+                findUniNodeMovingToFront(&root, trace[l]);
+            }
+            else if(search == TRANSPOSE_SEARCH) {
+                findUniNodeTransposing(&root, trace[l]);
+            }
+        }
+
+        deleteEntireUniList(&root);
+        *depths = (double) totalDepth / numLookups;
+
+        if(found != numLookups) {
+            fprintf(stderr, "Some values were not found!\n");
+        }
+    }
+
+    return elapsed;
+}
+
+int main(int argc, char *args[]) {
+    size_t numValues = argc > 1 ? strtoul(args[1], NULL, 10) : 10000;
+    size_t numLookups = argc > 2 ? strtoul(args[2], NULL, 10) : 200000;
+    double exponent = argc > 3 ? strtod(args[3], NULL) : 1.0;
+
+    if(argc > 4 || numValues == 0 || numLookups == 0 || exponent < 0.0) {
+        fprintf(stderr,
+                "Usage: %s [numValues] [numLookups] [exponent (>= 0)]\n",
+                args[0]);
+        exit(1);
+    }
+
+    int *trace = malloc(numLookups * sizeof(int));
+    int *values = malloc(numValues * sizeof(int));
+    UniNode **nodes = malloc(numValues * sizeof(UniNode *));
+
+    srand(1);
+
+    if(!trace || !values || !nodes ||
+       !fillZipfTrace(trace, numLookups, numValues, exponent)) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    const char *names[] = {"findUniNode", "move-to-front", "transpose"};
+    double plainElapsed = 0.0;
+
+    printf("Values = %zu, lookups = %zu, exponent = %.2f\n",
+           numValues,
+           numLookups,
+           exponent);
+    printf("%-14s %12s %14s %10s\n",
+           "search",
+           "seconds",
+           "nodes/lookup",
+           "speedup");
+
+    for(Search search = PLAIN_SEARCH; search <= TRANSPOSE_SEARCH; ++search) {
+        double depths = 0.0;
+        double elapsed = replay(search,
+                                trace,
+                                numLookups,
+                                nodes,
+                                values,
+                                numValues,
+                                &depths);
+
+        if(elapsed < 0.0) {
+            fprintf(stderr, "Allocation failed!\n");
+            exit(1);
+        }
+
+        if(search == PLAIN_SEARCH) {
+            plainElapsed = elapsed;
+        }
+
+        printf("%-14s %12.3f %14.1f %10.2f\n",
+               names[search],
+               elapsed,
+               depths,
+               plainElapsed / elapsed);
+    }
+
+    free(trace);
+    free(values);
+    free(nodes);
+
+    return 0;
+}
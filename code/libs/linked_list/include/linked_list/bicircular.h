@@ -0,0 +1,290 @@
+/**
+ * @file bicircular.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the functions associated with bidirectional
+ *        circular linked lists, embracing both unordered and ordered versions.
+ */
+
+#ifndef BICIRCULAR_H
+#define BICIRCULAR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "linked_list/bidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * A bidirectional circular list is made of BiNode nodes, where the next
+ * pointer of the last node points back to the first node and the prev pointer
+ * of the first node points to the last node. The list is kept by a pointer to
+ * its first node (as for bidirectional lists) and its last node is root->prev,
+ * which gives O(1) access to both ends. Hence, adding to the end of the list
+ * (and, for ordered lists, adding a value not smaller than the maximum one)
+ * takes O(1) instead of O(n). An empty list has a NULL root.
+ */
+
+// Task 1: Textual Description
+/**
+ * @brief Displays the elements of a bidirectional circular list starting from
+ *        its first node.
+ *
+ * @param root Pointer to the first node of the list.
+ */
+void displayBiCircularList(BiNode *root);
+
+/**
+ * @brief Converts a bidirectional circular list to a string representation.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @return A string representation of the list.
+ */
+char *biCircularListToString(BiNode *root);
+
+// Task 2: Creation Operation
+/**
+ * @brief Adds a new node with the specified value to the end of the
+ *        bidirectional circular list in O(1).
+ *
+ * @param root Pointer to a pointer to the first node of the list. If the list
+ *             is empty, *root should be NULL and it is set to the new node.
+ *             The value of root should not be NULL. Otherwise, nothing is
+ *             done.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addBiCircularNode(BiNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to the end of the
+ *        bidirectional circular list. As the end is reached in O(1), there is
+ *        nothing to recurse on, and it behaves as addBiCircularNode (it is
+ *        kept for the sake of having the same functions as other lists).
+ *
+ * @param root Pointer to a pointer to the first node of the list.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addBiCircularNodeRecursively(BiNode **root, int value);
+
+// Task 3: Read / Find Operations
+/**
+ * @brief Finds the first node with specified value in the given bidirectional
+ *        circular list.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the first node found with the specified value, or NULL
+ *         in case of non-existing value.
+ */
+BiNode *findBiCircularNode(BiNode *root, int value);
+
+/**
+ * @brief Finds recursively the first node with specified value in the given
+ *        bidirectional circular list.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the first node found with the specified value, or NULL
+ *         in case of non-existing value.
+ */
+BiNode *findBiCircularNodeRecursively(BiNode *root, int value);
+
+// Task 4: Update Operation
+/**
+ * @brief Updates the value of the first node with the given original value.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param originalValue The original value to search for.
+ *
+ * @param newValue The new value to set for the first found node.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateBiCircularNode(BiNode *root, int originalValue, int newValue);
+
+/**
+ * @brief Updates the value of the first node with the given original value. It
+ *        is based on recursive approach.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param originalValue The original value to search for.
+ *
+ * @param newValue The new value to set for the first found node.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateBiCircularNodeRecursively(BiNode *root,
+                                     int originalValue,
+                                     int newValue);
+
+// Task 5: Delete Operation
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        bidirectional circular list.
+ *
+ * @param root Pointer to a pointer to the first node of the list (updated if
+ *             the first node is deleted).
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteBiCircularNode(BiNode **root, int value);
+
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        bidirectional circular list. It is based on recursion.
+ *
+ * @param root Pointer to a pointer to the first node of the list (updated if
+ *             the first node is deleted).
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteBiCircularNodeRecursively(BiNode **root, int value);
+
+// Task 6: Delete Entire List
+/**
+ * @brief Deletes the entire bidirectional circular list.
+ *
+ * @param root A pointer to a pointer to the first node of the list, which is
+ *             set to NULL.
+ */
+void deleteEntireBiCircularList(BiNode **root);
+
+/**
+ * @brief Deletes the entire bidirectional circular list. It is based on
+ *        recursion.
+ *
+ * @param root A pointer to a pointer to the first node of the list, which is
+ *             set to NULL.
+ */
+void deleteEntireBiCircularListRecursively(BiNode **root);
+
+// Task 7: Getting List Length / BiNodes Count
+/**
+ * @brief Counts the number of nodes in the given bidirectional circular list.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getBiCircularNodesCount(BiNode *root);
+
+/**
+ * @brief Counts the number of nodes in the given bidirectional circular list.
+ *        It is based on recursion.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getBiCircularNodesCountRecursively(BiNode *root);
+
+// Task 8: Ordered Bidirectional Circular List
+/**
+ * @brief Adds a new node with the specified value to the given bidirectional
+ *        circular list in ascending order. Adding a value that is not smaller
+ *        than the last (maximum) one takes O(1).
+ *
+ * @param root A pointer to a pointer to the first node of the list.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedBiCircularNode(BiNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to the given bidirectional
+ *        circular list in ascending order. It utilizes recursion.
+ *
+ * @param root A pointer to a pointer to the first node of the list.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedBiCircularNodeRecursively(BiNode **root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered bidirectional
+ *        circular list. Values outside the range of the first and last nodes
+ *        are rejected in O(1).
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+BiNode *findOrderedBiCircularNode(BiNode *root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered bidirectional
+ *        circular list. It is based on recursion.
+ *
+ * @param root Pointer to the first node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+BiNode *findOrderedBiCircularNodeRecursively(BiNode *root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered
+ *        bidirectional circular list.
+ *
+ * @param root A pointer to a pointer to the first node of the list.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedBiCircularNode(BiNode **root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered
+ *        bidirectional circular list. It is based on recursion.
+ *
+ * @param root A pointer to a pointer to the first node of the list.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedBiCircularNodeRecursively(BiNode **root, int value);
+
+// Task 9: Sorting
+/**
+ * @brief Sorts the given bidirectional circular list in ascending order in
+ *        O(n log(n)). It breaks the circle, sorts the nodes in place using
+ *        sortBiList and closes the circle again.
+ *
+ * @param root A pointer to a pointer to the first node of the list, which
+ *             is set to the new first node.
+ */
+void sortBiCircularList(BiNode **root);
+
+#endif
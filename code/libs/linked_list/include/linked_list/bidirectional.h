@@ -287,4 +287,318 @@ bool deleteOrderedBiNode(BiNode **root, int value);
  */
 bool deleteOrderedBiNodeRecursively(BiNode **root, int value);
 
+// Task 9: Sorting
+/**
+ * @brief Sorts the given bidirectional list in ascending order, turning it
+ *        into an ordered list in O(n log(n)) instead of the O(n^2) of adding
+ *        every value with addOrderedBiNode. It is an in-place iterative
+ *        bottom-up merge sort: nodes are relinked (never allocated nor
+ *        copied), prev pointers are fixed up in a single final pass, and
+ *        equal values keep their relative order (stable sort).
+ *
+ * @param root A pointer to a pointer to the root node of the bidirectional
+ *             list to sort, which is set to the new first node.
+ */
+void sortBiList(BiNode **root);
+
+// Task 10: Bulk Operations
+/**
+ * @brief Adds a batch of values to the given ordered bidirectional list in a
+ *        single O(n + count) pass, instead of the O(n * count) of calling
+ *        addOrderedBiNode for every value. The new nodes are allocated
+ *        first, and nothing is added if any allocation fails.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered
+ *             bidirectional list to add to.
+ *
+ * @param values The values to add (can be NULL if count is zero).
+ *
+ * @param count The number of values to add.
+ *
+ * @param areSorted Tells if the values are given in ascending order. If not,
+ *                  the new nodes are sorted first using sortBiList, which
+ *                  makes the whole operation O(n + count log(count)).
+ *
+ * @return True if all the values are added and false otherwise (in which case
+ *         the list is left unchanged).
+ */
+bool addOrderedBiNodes(BiNode **root,
+                       const int *values,
+                       size_t count,
+                       bool areSorted);
+
+/**
+ * @brief Looks up a batch of keys in the given ordered bidirectional list in a
+ *        single O(n + count) merge-join pass, instead of the O(n * count) of
+ *        calling findOrderedBiNode for every key. The scan for a key
+ *        resumes where the scan for the previous key stopped.
+ *
+ * @param root A pointer to the root node of the ordered bidirectional list to
+ *             search.
+ *
+ * @param keys The keys to search for, in ascending order (duplicates are
+ *             allowed). A key smaller than the previous one is still found
+ *             correctly, but restarts the scan from the root.
+ *
+ * @param count The number of keys.
+ *
+ * @param nodes An array of count entries receiving, for every key, a pointer
+ *              to the first node holding it or NULL if it does not exist. It
+ *              can be NULL if only the number of found keys is needed.
+ *
+ * @return The number of keys found in the list.
+ */
+size_t findOrderedBiNodes(BiNode *root,
+                          const int *keys,
+                          size_t count,
+                          BiNode **nodes);
+
+// Task 11: Set Operations
+/**
+ * @brief Builds a new ordered bidirectional list holding the values present in
+ *        either list, in a single O(n + m) pass over the two given ordered
+ *        lists (which are left unchanged). As the lists represent sets, every
+ *        value appears once in the result even if it is repeated in the given
+ *        lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedBiListsUnion(BiNode *first,
+                            BiNode *second,
+                            BiNode **result);
+
+/**
+ * @brief Builds a new ordered bidirectional list holding the values present in
+ *        both lists, in a single O(n + m) pass over the two given ordered lists
+ *        (which are left unchanged). As the lists represent sets, every value
+ *        appears once in the result even if it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedBiListsIntersection(BiNode *first,
+                                   BiNode *second,
+                                   BiNode **result);
+
+/**
+ * @brief Builds a new ordered bidirectional list holding the values of the
+ *        first list that are not in the second one, in a single O(n + m) pass
+ *        over the two given ordered lists (which are left unchanged). As the
+ *        lists represent sets, every value appears once in the result even if
+ *        it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedBiListsDifference(BiNode *first,
+                                 BiNode *second,
+                                 BiNode **result);
+
+// Task 12: Finger Search
+/**
+ * REMARK:
+ *
+ * The ordered functions above always search from the root node, although a
+ * BiNode can be walked backward too. The finger functions below search from a
+ * node of the list (the finger) instead: forward if the value is bigger than
+ * the one of the finger and backward otherwise. The finger is then moved to
+ * the accessed node, so that sequential and near-sorted accesses take
+ * O(distance) steps instead of O(n). Passing the tail of the list as finger
+ * makes searches for values near the maximum start from the end.
+ *
+ * They behave like findOrderedBiNode, addOrderedBiNode and deleteOrderedBiNode
+ * otherwise: a value is found, added before or deleted at its first
+ * occurrence.
+ */
+
+/**
+ * @brief Finds the first node holding the given value in an ordered
+ *        bidirectional list, searching from the given finger.
+ *
+ * @param root A pointer to the root node of the ordered bidirectional list,
+ *             where the search starts if there is no finger.
+ *
+ * @param finger A pointer to a pointer to a node of the list (or to NULL). It
+ *               is set to the found node, or to the node where the search
+ *               stopped if not found.
+ *
+ * @param value The value to search for.
+ *
+ * @return Pointer to the found node or NULL if not found.
+ */
+BiNode *findOrderedBiNodeFromFinger(BiNode *root, BiNode **finger, int value);
+
+/**
+ * @brief Adds a node to an ordered bidirectional list, searching for its
+ *        position from the given finger.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered
+ *             bidirectional list, which is updated if the node is added first.
+ *
+ * @param finger A pointer to a pointer to a node of the list (or to NULL). It
+ *               is set to the new node.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the node got added and false otherwise.
+ */
+bool addOrderedBiNodeFromFinger(BiNode **root, BiNode **finger, int value);
+
+/**
+ * @brief Deletes the first node holding the given value from an ordered
+ *        bidirectional list, searching for it from the given finger.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered
+ *             bidirectional list, which is updated if the first node is
+ *             deleted.
+ *
+ * @param finger A pointer to a pointer to a node of the list (or to NULL). It
+ *               is set to the node following the deleted one (or preceding it
+ *               if it was the last one), or to where the search stopped if not
+ *               found.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the node got deleted and false otherwise.
+ */
+bool deleteOrderedBiNodeFromFinger(BiNode **root, BiNode **finger, int value);
+
+// Task 13: Cursor
+/**
+ * REMARK:
+ *
+ * Editing the middle of a list through the functions above searches for the
+ * node to work on from the root node first. A cursor instead stands on a node
+ * of the list and moves one node forward or backward at a time, so a list can
+ * be edited while being traversed, every operation taking O(1):
+ *
+ * 1 - The cursor stands on node (NULL once it moved past the last node) and
+ *     remembers prev, the node before it (NULL at the front). Keeping prev
+ *     allows adding at the end of the list and moving back from past the end.
+ *
+ * 2 - The cursor keeps a pointer to the root of the list, which is updated
+ *     when a node is added or deleted at the front.
+ *
+ * The list must only be modified through the cursor while it is in use.
+ */
+
+/**
+ * @struct BiCursor
+ *
+ * @brief A cursor over a bidirectional list.
+ */
+typedef struct BiCursor {
+    /**
+     * @brief Pointer to the pointer to the root node of the list.
+     */
+    BiNode **root;
+
+    /**
+     * @brief Pointer to the node before the cursor (NULL at the front).
+     */
+    BiNode *prev;
+
+    /**
+     * @brief Pointer to the node the cursor stands on (NULL past the last
+     *        node).
+     */
+    BiNode *node;
+} BiCursor;
+
+/**
+ * @brief Initializes a cursor standing on the root node of a bidirectional
+ *        list.
+ *
+ * @param cursor Pointer to the cursor to be initialized.
+ *
+ * @param root A pointer to a pointer to the root node of the bidirectional
+ *             list.
+ *
+ * @return True if the cursor got initialized and false otherwise (NULL cursor
+ *         or root).
+ */
+bool initBiCursor(BiCursor *cursor, BiNode **root);
+
+/**
+ * @brief Moves a cursor to the next node.
+ *
+ * @param cursor Pointer to the cursor.
+ *
+ * @return True if the cursor moved and false otherwise (already past the last
+ *         node).
+ */
+bool moveBiCursorNext(BiCursor *cursor);
+
+/**
+ * @brief Moves a cursor to the previous node.
+ *
+ * @param cursor Pointer to the cursor.
+ *
+ * @return True if the cursor moved and false otherwise (already at the
+ *         front).
+ */
+bool moveBiCursorPrev(BiCursor *cursor);
+
+/**
+ * @brief Adds a node before the node a cursor stands on (at the end of the
+ *        list if past the last node). The cursor stays on the same node.
+ *
+ * @param cursor Pointer to the cursor.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the node got added and false otherwise (NULL cursor or
+ *         allocation failure).
+ */
+bool addBiNodeBeforeCursor(BiCursor *cursor, int value);
+
+/**
+ * @brief Adds a node after the node a cursor stands on. The cursor stays on
+ *        the same node.
+ *
+ * @param cursor Pointer to the cursor.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the node got added and false otherwise (NULL cursor, past
+ *         the last node or allocation failure).
+ */
+bool addBiNodeAfterCursor(BiCursor *cursor, int value);
+
+/**
+ * @brief Deletes the node a cursor stands on. The cursor moves to the next
+ *        node.
+ *
+ * @param cursor Pointer to the cursor.
+ *
+ * @return True if the node got deleted and false otherwise (NULL cursor or
+ *         past the last node).
+ */
+bool deleteBiNodeAtCursor(BiCursor *cursor);
+
 #endif
@@ -0,0 +1,188 @@
+/**
+ * @file hash_table.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        chained hash tables whose buckets are unidirectional lists.
+ */
+
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "linked_list/unidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * The unordered unidirectional list (see "unidirectional.h") needs O(n) steps
+ * to find a value. A hash table spreads the values over many buckets, every
+ * bucket being a short unidirectional list (chain) of UniNode nodes, and a
+ * value is only searched for in the chain of its bucket. As long as there are
+ * about as many buckets as values, chains hold O(1) nodes on average and so
+ * do add, find, update and delete.
+ *
+ * The hash table holds a set of values (duplicates are not allowed). Its
+ * functions follow the style of "unidirectional.h": a NULL table is an empty
+ * one and it gets created upon the first addition.
+ *
+ * Once there are more values than buckets, the number of buckets is doubled.
+ * Instead of moving all nodes at once (a pause proportional to the size of
+ * the table), the resize is incremental:
+ *
+ * 1 - The new buckets are allocated and the current ones become the old ones.
+ *     New values are only added to the new buckets.
+ *
+ * 2 - Every operation (add, find, update or delete) moves the chains of the
+ *     next HASH_TABLE_MIGRATED_BUCKETS old buckets to the new ones. Meanwhile,
+ *     a value is searched for in both its old and new buckets.
+ *
+ * 3 - Once all old buckets are moved, they are freed.
+ *
+ * As the buckets are doubled when there are more values than buckets, the
+ * old buckets are all moved before the new ones fill up, so at most two sets
+ * of buckets exist at any time. If the new buckets cannot be allocated, the
+ * table keeps its buckets (its chains only get longer).
+ */
+
+/**
+ * @def HASH_TABLE_INITIAL_BUCKETS
+ *
+ * @brief The initial number of buckets (a power of two).
+ */
+#define HASH_TABLE_INITIAL_BUCKETS 8
+
+/**
+ * @def HASH_TABLE_MIGRATED_BUCKETS
+ *
+ * @brief The number of old buckets moved by every operation during a resize.
+ */
+#define HASH_TABLE_MIGRATED_BUCKETS 2
+
+/**
+ * @struct HashTable
+ *
+ * @brief A chained hash table of unidirectional lists.
+ */
+typedef struct HashTable {
+    /**
+     * @brief The buckets (the new ones during a resize).
+     */
+    UniNode **buckets;
+
+    /**
+     * @brief The number of buckets (a power of two).
+     */
+    size_t numBuckets;
+
+    /**
+     * @brief The old buckets during a resize and NULL otherwise.
+     */
+    UniNode **oldBuckets;
+
+    /**
+     * @brief The number of old buckets.
+     */
+    size_t numOldBuckets;
+
+    /**
+     * @brief The index of the next old bucket to be moved.
+     */
+    size_t migrateIndex;
+
+    /**
+     * @brief The number of values in the table.
+     */
+    size_t count;
+} HashTable;
+
+/**
+ * @brief Displays the values of a hash table (in no particular order).
+ *
+ * @param table Pointer to the hash table.
+ */
+void displayHashTable(HashTable *table);
+
+/**
+ * @brief Converts a hash table to a string representation (in no particular
+ *        order).
+ *
+ * @param table Pointer to the hash table.
+ *
+ * @return A string representation of the table.
+ */
+char *hashTableToString(HashTable *table);
+
+/**
+ * @brief Adds a value to a hash table in O(1) on average.
+ *
+ * @param table A pointer to a pointer to the hash table, which is created if
+ *              it is NULL.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (NULL table pointer,
+ *         already existing value or allocation failure).
+ */
+bool addHashNode(HashTable **table, int value);
+
+/**
+ * @brief Finds the node holding the given value in a hash table in O(1) on
+ *        average.
+ *
+ * @param table Pointer to the hash table.
+ *
+ * @param value The value to search for.
+ *
+ * @return Pointer to the found node or NULL if not found.
+ */
+UniNode *findHashNode(HashTable *table, int value);
+
+/**
+ * @brief Updates a value of a hash table in O(1) on average, moving its node
+ *        to the bucket of the new value.
+ *
+ * @param table Pointer to the hash table.
+ *
+ * @param value The value to be updated.
+ *
+ * @param newValue The new value to set.
+ *
+ * @return True if the value got updated and false otherwise (not existing
+ *         value or already existing new value).
+ */
+bool updateHashNode(HashTable *table, int value, int newValue);
+
+/**
+ * @brief Deletes a value from a hash table in O(1) on average. The table is
+ *        freed once it gets empty.
+ *
+ * @param table A pointer to a pointer to the hash table, which is set to NULL
+ *              if the deleted value was the last one.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value got deleted and false otherwise.
+ */
+bool deleteHashNode(HashTable **table, int value);
+
+/**
+ * @brief Deletes the entire hash table (all its nodes and buckets).
+ *
+ * @param table A pointer to a pointer to the hash table, which is set to NULL.
+ */
+void deleteEntireHashTable(HashTable **table);
+
+/**
+ * @brief Retrieves the number of values in a hash table in O(1).
+ *
+ * @param table Pointer to the hash table.
+ *
+ * @return The number of values.
+ */
+size_t getHashNodesCount(HashTable *table);
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file indexed_bidirectional.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        ordered bidirectional lists having an express lane index.
+ */
+
+#ifndef INDEXED_BIDIRECTIONAL_H
+#define INDEXED_BIDIRECTIONAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "linked_list/bidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * The ordered bidirectional list (see "bidirectional.h") needs O(n) steps to
+ * find a value. The indexed list keeps the very same nodes (BiNode is left
+ * unchanged), and adds a side array of express lanes: every lane records one
+ * node of the list (its sample) along with its value and the length of the
+ * segment starting at it. The samples are taken about every stride nodes:
+ *
+ * 1 - A search binary-searches the lane values for the last sample smaller
+ *     than the searched value and scans its segment from there, hence it takes
+ *     O(log(n / stride) + stride) steps.
+ *
+ * 2 - Adding a node lengthens its segment. A segment reaching 2 * stride nodes
+ *     is split into two lanes in its middle.
+ *
+ * 3 - Deleting a node shortens its segment. If it is a sample, the next node
+ *     of the segment becomes the sample (or the lane is removed if the segment
+ *     gets empty), and neighbouring segments fitting within stride nodes are
+ *     merged.
+ *
+ * As the lane values are copies, the values of the nodes must not be updated
+ * in place, which is the case of any ordered list. Duplicates are allowed and,
+ * like addOrderedBiNode and deleteOrderedBiNode, a value is added before and
+ * deleted at its first occurrence.
+ */
+
+/**
+ * @struct BiExpressLane
+ *
+ * @brief An express lane of an indexed bidirectional list.
+ */
+typedef struct BiExpressLane {
+    /**
+     * @brief The value of the sample node (kept here to binary-search lanes
+     *        without visiting the nodes).
+     */
+    int value;
+
+    /**
+     * @brief The number of nodes of the segment, starting at the sample node.
+     */
+    size_t length;
+
+    /**
+     * @brief Pointer to the sample node.
+     */
+    BiNode *node;
+} BiExpressLane;
+
+/**
+ * @struct IndexedBiList
+ *
+ * @brief An ordered bidirectional list along with its express lane index.
+ */
+typedef struct IndexedBiList {
+    /**
+     * @brief Pointer to the root node of the ordered bidirectional list.
+     */
+    BiNode *root;
+
+    /**
+     * @brief The express lanes in list order.
+     */
+    BiExpressLane *lanes;
+
+    /**
+     * @brief The number of express lanes.
+     */
+    size_t numLanes;
+
+    /**
+     * @brief The number of express lanes that fit in the lanes array.
+     */
+    size_t capacity;
+
+    /**
+     * @brief The targeted number of nodes between two samples.
+     */
+    size_t stride;
+
+    /**
+     * @brief The number of nodes in the list.
+     */
+    size_t count;
+} IndexedBiList;
+
+/**
+ * @brief Initializes an indexed list out of an ordered bidirectional list,
+ *        building its index in O(n).
+ *
+ * @param list Pointer to the indexed list to be initialized.
+ *
+ * @param root A pointer to the root node of an ordered bidirectional list
+ *             (NULL for an empty list). The indexed list takes it over, hence
+ *             it should be modified through the indexed list only.
+ *
+ * @param stride The targeted number of nodes between two samples (at least 1).
+ *
+ * @return True if the list got initialized and false otherwise (NULL list,
+ *         zero stride or allocation failure).
+ */
+bool initIndexedBiList(IndexedBiList *list, BiNode *root, size_t stride);
+
+/**
+ * @brief Adds a node to an indexed list in ascending order, updating its
+ *        index.
+ *
+ * @param list Pointer to the indexed list.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (NULL list or
+ *         allocation failure).
+ */
+bool addIndexedBiNode(IndexedBiList *list, int value);
+
+/**
+ * @brief Finds the first node holding the given value in an indexed list in
+ *        O(log(n / stride) + stride).
+ *
+ * @param list Pointer to the indexed list.
+ *
+ * @param value The value to search for.
+ *
+ * @return Pointer to the found node or NULL if not found.
+ */
+BiNode *findIndexedBiNode(const IndexedBiList *list, int value);
+
+/**
+ * @brief Deletes the first node holding the given value from an indexed list,
+ *        updating its index.
+ *
+ * @param list Pointer to the indexed list.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value got deleted and false otherwise.
+ */
+bool deleteIndexedBiNode(IndexedBiList *list, int value);
+
+/**
+ * @brief Deletes the entire indexed list (all its nodes and its index).
+ *
+ * @param list Pointer to the indexed list.
+ */
+void deleteEntireIndexedBiList(IndexedBiList *list);
+
+/**
+ * @brief Retrieves the number of nodes in an indexed list in O(1).
+ *
+ * @param list Pointer to the indexed list.
+ *
+ * @return The number of nodes.
+ */
+size_t getIndexedBiNodesCount(const IndexedBiList *list);
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file k_way_merge.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the functions merging many ordered unidirectional
+ *        or bidirectional lists into a single ordered one.
+ */
+
+#ifndef K_WAY_MERGE_H
+#define K_WAY_MERGE_H
+
+#include <stddef.h>
+
+#include "linked_list/unidirectional.h"
+#include "linked_list/bidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * Merging k lists pairwise, one after the other, walks the growing result
+ * again and again, which costs O(k * N) for N nodes in total. Here, a binary
+ * min-heap holds the first node of every list, so the next smallest node is
+ * found in O(log(k)) and the whole merge takes O(N log(k)).
+ *
+ * The nodes are spliced (relinked) into the result: no node is allocated,
+ * copied or freed. Ties are broken by list index, so equal values keep the
+ * order of the lists they come from and the merge is stable.
+ *
+ * The heap needs k entries. If they cannot be allocated, the lists are merged
+ * pairwise in balanced rounds (1 with 2, 3 with 4, ... then the results
+ * together), which is also O(N log(k)) and stable, so the merge never fails.
+ */
+
+/**
+ * @brief Merges the given ordered unidirectional lists into a single ordered
+ *        list, relinking their nodes.
+ *
+ * @param lists An array of pointers to the root nodes of the ordered lists
+ *              (NULL for empty lists). It is used as working space and all its
+ *              entries are NULL on return.
+ *
+ * @param numLists The number of lists in the array.
+ *
+ * @param root A pointer to where the root node of the merged list is stored.
+ *             It must not point into the array. The value of root should not
+ *             be NULL (neither that of lists unless numLists is zero).
+ *             Otherwise, nothing is done.
+ */
+void mergeOrderedUniLists(UniNode **lists, size_t numLists, UniNode **root);
+
+/**
+ * @brief Merges the given ordered bidirectional lists into a single ordered
+ *        list, relinking their nodes and fixing their prev pointers.
+ *
+ * @param lists An array of pointers to the root nodes of the ordered lists
+ *              (NULL for empty lists). It is used as working space and all its
+ *              entries are NULL on return.
+ *
+ * @param numLists The number of lists in the array.
+ *
+ * @param root A pointer to where the root node of the merged list is stored.
+ *             It must not point into the array. The value of root should not
+ *             be NULL (neither that of lists unless numLists is zero).
+ *             Otherwise, nothing is done.
+ */
+void mergeOrderedBiLists(BiNode **lists, size_t numLists, BiNode **root);
+
+#endif
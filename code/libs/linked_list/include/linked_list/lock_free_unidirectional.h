@@ -0,0 +1,170 @@
+/**
+ * @file lock_free_unidirectional.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        lock-free (thread-safe) ordered unidirectional linked lists.
+ */
+
+#ifndef LOCK_FREE_UNIDIRECTIONAL_H
+#define LOCK_FREE_UNIDIRECTIONAL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * REMARK:
+ *
+ * The ordered unidirectional list (see "unidirectional.h") can only be shared
+ * by several threads behind a lock, which serializes all of them. The list
+ * below follows Harris' design, where threads never lock:
+ *
+ * 1 - A node is added by a single compare-and-swap (CAS) on the next pointer
+ *     of its predecessor, which fails (and is retried) if that pointer changed
+ *     meanwhile.
+ *
+ * 2 - A node is deleted in two steps. First, the lowest bit of its own next
+ *     pointer is set (marked), which logically deletes it and prevents any
+ *     node from being added right after it. Then, it is unlinked by a CAS on
+ *     the next pointer of its predecessor. Any thread passing by a marked
+ *     node helps unlinking it.
+ *
+ * 3 - The thread whose CAS unlinks a node retires it using epoch-based
+ *     reclamation (see "reclamation/ebr.h"), as other threads may still be
+ *     visiting it.
+ *
+ * As in the ordered unidirectional list, values are kept in ascending order
+ * and duplicates are allowed.
+ */
+
+/**
+ * @struct LockFreeUniNode
+ *
+ * @brief A lock-free unidirectional list node.
+ */
+typedef struct LockFreeUniNode {
+    /**
+     * @brief The value stored in the node.
+     */
+    int value;
+
+    /**
+     * @brief The next node as a pointer whose lowest bit tells if this node is
+     *        deleted (marked).
+     */
+    _Atomic uintptr_t next;
+
+    /**
+     * @brief Pointer to the next node in the retired list (in case it could
+     *        not be retired).
+     */
+    struct LockFreeUniNode *nextRetired;
+} LockFreeUniNode;
+
+/**
+ * @struct LockFreeUniList
+ *
+ * @brief A lock-free ordered unidirectional list.
+ */
+typedef struct LockFreeUniList {
+    /**
+     * @brief The head node holding no value, whose next node is the first one
+     *        of the list.
+     */
+    LockFreeUniNode head;
+
+    /**
+     * @brief The list of unlinked nodes that could not be retired (allocation
+     *        failure), to be freed upon deletion of the entire list.
+     */
+    LockFreeUniNode *_Atomic retired;
+
+    /**
+     * @brief The number of values in the list.
+     */
+    atomic_size_t count;
+} LockFreeUniList;
+
+/**
+ * @brief Initializes an empty lock-free list.
+ *
+ * @param list Pointer to the list to be initialized.
+ */
+void initLockFreeUniList(LockFreeUniList *list);
+
+/**
+ * @brief Displays the values of a lock-free list.
+ *
+ * @param list Pointer to the list.
+ */
+void displayLockFreeUniList(LockFreeUniList *list);
+
+/**
+ * @brief Converts a lock-free list to a string representation.
+ *
+ * @param list Pointer to the list.
+ *
+ * @return A string representation of the list.
+ */
+char *lockFreeUniListToString(LockFreeUniList *list);
+
+/**
+ * @brief Adds a new node with the specified value to a lock-free list in
+ *        ascending order. It is thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedLockFreeUniNode(LockFreeUniList *list, int value);
+
+/**
+ * @brief Tells if a value exists in a lock-free list. It is thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return True if the value exists and false otherwise.
+ *
+ * @note Unlike findOrderedUniNode, no node pointer is returned as the node
+ *       might be deleted and freed by another thread right after.
+ */
+bool findOrderedLockFreeUniNode(LockFreeUniList *list, int value);
+
+/**
+ * @brief Deletes a node with the specified value from a lock-free list. It is
+ *        thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedLockFreeUniNode(LockFreeUniList *list, int value);
+
+/**
+ * @brief Deletes the entire lock-free list. It should only be called once no
+ *        other thread uses the list.
+ *
+ * @param list Pointer to the list.
+ */
+void deleteEntireLockFreeUniList(LockFreeUniList *list);
+
+/**
+ * @brief Retrieves the number of values in a lock-free list.
+ *
+ * @param list Pointer to the list.
+ *
+ * @return The number of values.
+ */
+size_t getLockFreeUniNodesCount(LockFreeUniList *list);
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * @file packed_array.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        packed memory arrays, i.e. ordered lists kept in a gapped sorted
+ *        array.
+ */
+
+#ifndef PACKED_ARRAY_H
+#define PACKED_ARRAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * REMARK:
+ *
+ * The ordered unidirectional list (see "unidirectional.h") walks node after
+ * node to find a value, and every step is a dependent load from anywhere in
+ * memory. A packed memory array keeps the values sorted in a single array
+ * split into segments of PACKED_ARRAY_SEGMENT_SIZE slots. Every segment keeps
+ * its values at its beginning, leaving the rest of its slots as gaps. Hence:
+ *
+ * - A value is found by a binary search over the first values of the
+ *   segments, then within a segment, in O(log(n)).
+ *
+ * - A value is added by shifting the values of its segment only, unless the
+ *   segment is full.
+ *
+ * - An ordered scan reads the array sequentially.
+ *
+ * The segments are the leaves of an implicit complete binary tree, every
+ * tree node standing for the window of segments below it. The density of a
+ * window (values over slots) has to stay within bounds that get tighter
+ * moving up the tree, from [1 / 8, 1] for a segment to [1 / 4, 3 / 4] for the
+ * whole array. Once a segment gets full (or below its lower bound), the
+ * smallest enclosing window within its own bounds gets its values spread
+ * evenly over its segments. If no such window exists, the array is doubled
+ * (or halved). This gives an amortized O(log²(n)) cost per addition or
+ * deletion, and all segments are never empty (unless the array has a single
+ * one), which the binary search relies on.
+ *
+ * Like the ordered list, duplicates are allowed.
+ */
+
+/**
+ * @def PACKED_ARRAY_SEGMENT_SIZE
+ *
+ * @brief The number of slots of a segment (a power of two, at least 8 so that
+ *        the lower density bound of a segment is at least one value).
+ */
+#define PACKED_ARRAY_SEGMENT_SIZE 64
+
+/**
+ * @struct PackedArray
+ *
+ * @brief A packed memory array.
+ */
+typedef struct PackedArray {
+    /**
+     * @brief The slots of the segments, one segment after the other.
+     */
+    int *values;
+
+    /**
+     * @brief The number of values of every segment.
+     */
+    size_t *counts;
+
+    /**
+     * @brief The number of segments (a power of two).
+     */
+    size_t numSegments;
+
+    /**
+     * @brief The number of values in the array.
+     */
+    size_t count;
+} PackedArray;
+
+/**
+ * @brief Initializes an empty packed memory array having a single segment.
+ *
+ * @param array Pointer to the array to be initialized.
+ *
+ * @return True if the array got initialized and false otherwise (NULL array
+ *         or allocation failure).
+ */
+bool initPackedArray(PackedArray *array);
+
+/**
+ * @brief Displays the values of a packed memory array in ascending order.
+ *
+ * @param array Pointer to the array.
+ */
+void displayPackedArray(PackedArray *array);
+
+/**
+ * @brief Converts a packed memory array to a string representation (in
+ *        ascending order).
+ *
+ * @param array Pointer to the array.
+ *
+ * @return A string representation of the array.
+ */
+char *packedArrayToString(PackedArray *array);
+
+/**
+ * @brief Adds a value to a packed memory array in ascending order, in
+ *        amortized O(log²(n)).
+ *
+ * @param array Pointer to the array.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (NULL or deleted
+ *         array, or allocation failure while growing).
+ */
+bool addOrderedPackedValue(PackedArray *array, int value);
+
+/**
+ * @brief Tells if a value exists in a packed memory array in O(log(n)).
+ *
+ * @param array Pointer to the array.
+ *
+ * @param value The value to search for.
+ *
+ * @return True if the value exists and false otherwise.
+ */
+bool findOrderedPackedValue(PackedArray *array, int value);
+
+/**
+ * @brief Deletes an occurrence of a value from a packed memory array, in
+ *        amortized O(log²(n)).
+ *
+ * @param array Pointer to the array.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value got deleted and false otherwise.
+ */
+bool deleteOrderedPackedValue(PackedArray *array, int value);
+
+/**
+ * @brief Deletes the entire packed memory array (frees its slots). It has to
+ *        be initialized again before being reused.
+ *
+ * @param array Pointer to the array.
+ */
+void deleteEntirePackedArray(PackedArray *array);
+
+/**
+ * @brief Retrieves the number of values in a packed memory array in O(1).
+ *
+ * @param array Pointer to the array.
+ *
+ * @return The number of values.
+ */
+size_t getPackedValuesCount(PackedArray *array);
+
+/**
+ * @brief Copies, in ascending order, the values of a packed memory array that
+ *        are within [minValue, maxValue]. The scan starts with a binary search
+ *        and then reads the array sequentially.
+ *
+ * @param array Pointer to the array.
+ *
+ * @param minValue The lowest value of the range.
+ *
+ * @param maxValue The highest value of the range.
+ *
+ * @param[out] values The array where the values are copied.
+ *
+ * @param maxValues The maximum number of values to copy.
+ *
+ * @return The number of copied values.
+ */
+size_t getOrderedPackedRange(PackedArray *array,
+                             int minValue,
+                             int maxValue,
+                             int *values,
+                             size_t maxValues);
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file parallel_sort.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the functions sorting unidirectional and
+ *        bidirectional lists using several threads.
+ */
+
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include <stddef.h>
+
+#include "linked_list/unidirectional.h"
+#include "linked_list/bidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * The parallel sort works in three steps:
+ *
+ * 1 - The list is cut into numThreads segments of (almost) equal lengths.
+ *
+ * 2 - Every segment is sorted by its own thread using the sequential sort
+ *     (sortUniList / sortBiList), the calling thread sorting the first one.
+ *
+ * 3 - The sorted segments are merged by the calling thread in a single pass
+ *     using the k-way merge of "k_way_merge.h": a binary min-heap holds the
+ *     first node of every segment, so the next smallest node is found in
+ *     O(log(numThreads)).
+ *
+ * Ties are broken by segment index, so equal values keep their relative order
+ * and the result is identical to the one of the sequential (stable) sort.
+ * Step 2 takes O((n / numThreads) log(n / numThreads)) and step 3 takes
+ * O(n log(numThreads)), hence the sort scales with the number of cores until
+ * the merge dominates.
+ *
+ * Short lists (below PARALLEL_SORT_MIN_SEGMENT_LENGTH nodes per segment) are
+ * sorted sequentially as the cost of starting threads would outweigh the gain.
+ * The same holds if threads cannot be started or memory cannot be allocated,
+ * so the list always ends up sorted.
+ */
+
+/**
+ * @def PARALLEL_SORT_MIN_SEGMENT_LENGTH
+ *
+ * @brief The minimum number of nodes sorted by each thread.
+ */
+#define PARALLEL_SORT_MIN_SEGMENT_LENGTH 4096
+
+/**
+ * @brief Sorts the given unidirectional list in ascending order using up to
+ *        numThreads threads (including the calling one).
+ *
+ * @param root A pointer to a pointer to the root node of the unidirectional
+ *             list to sort, which is set to the new first node.
+ *
+ * @param numThreads The maximum number of threads sorting at the same time.
+ *                   Values 0 and 1 sort sequentially.
+ */
+void sortUniListInParallel(UniNode **root, size_t numThreads);
+
+/**
+ * @brief Sorts the given bidirectional list in ascending order using up to
+ *        numThreads threads (including the calling one). The prev pointers
+ *        are fixed up while merging.
+ *
+ * @param root A pointer to a pointer to the root node of the bidirectional
+ *             list to sort, which is set to the new first node.
+ *
+ * @param numThreads The maximum number of threads sorting at the same time.
+ *                   Values 0 and 1 sort sequentially.
+ */
+void sortBiListInParallel(BiNode **root, size_t numThreads);
+
+#endif
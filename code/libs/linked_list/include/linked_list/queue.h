@@ -0,0 +1,169 @@
+/**
+ * @file queue.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structures and functions associated with
+ *        lock-free (thread-safe) queues built out of unidirectional nodes.
+ */
+
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/**
+ * REMARK:
+ *
+ * Using a unidirectional list as a queue by adding at its end (addUniNode)
+ * costs O(n) per addition, and sharing it among threads needs a lock. The two
+ * queues below add at the end and remove from the front in O(1) without locks:
+ *
+ * 1 - The multi-producer multi-consumer (MPMC) queue follows Michael and
+ *     Scott's design. The queue always holds a dummy node at its front, and
+ *     both its front and its back are moved forward by compare-and-swap (CAS).
+ *     A thread finding the back lagging behind helps moving it. Removed dummy
+ *     nodes are retired using epoch-based reclamation (see
+ *     "reclamation/ebr.h") as other threads may still be visiting them.
+ *
+ * 2 - The multi-producer single-consumer (MPSC) queue follows Vyukov's design
+ *     and is cheaper: a producer adds with a single atomic exchange (which
+ *     never fails) and the only consumer removes without any atomic
+ *     read-modify-write operation. It is intrusive: the nodes are allocated
+ *     and freed by the caller, and the queue never frees nor allocates.
+ *
+ * The nodes have the same layout as UniNode (see "unidirectional.h"), except
+ * that the next pointer is atomic.
+ */
+
+/**
+ * @struct QueueNode
+ *
+ * @brief A queue node.
+ */
+typedef struct QueueNode {
+    /**
+     * @brief The value stored in the node.
+     */
+    int value;
+
+    /**
+     * @brief Pointer to the next node in the queue (the one added after).
+     */
+    struct QueueNode *_Atomic next;
+} QueueNode;
+
+/**
+ * @struct MPMCQueue
+ *
+ * @brief A lock-free multi-producer multi-consumer queue.
+ */
+typedef struct MPMCQueue {
+    /**
+     * @brief The dummy node at the front, whose next node holds the oldest
+     *        value.
+     */
+    QueueNode *_Atomic head;
+
+    /**
+     * @brief The last node (or the one before it while a node is being added).
+     */
+    QueueNode *_Atomic tail;
+} MPMCQueue;
+
+/**
+ * @struct MPSCQueue
+ *
+ * @brief A lock-free intrusive multi-producer single-consumer queue.
+ */
+typedef struct MPSCQueue {
+    /**
+     * @brief The last added node, which producers exchange.
+     */
+    QueueNode *_Atomic head;
+
+    /**
+     * @brief The oldest node, which only the consumer reads and writes.
+     */
+    QueueNode *tail;
+
+    /**
+     * @brief The stub node put back in the queue whenever it gets empty.
+     */
+    QueueNode stub;
+} MPSCQueue;
+
+/**
+ * @brief Initializes an empty MPMC queue.
+ *
+ * @param queue Pointer to the queue to be initialized.
+ *
+ * @return True if the queue got initialized and false otherwise (NULL queue
+ *         or allocation failure).
+ */
+bool initMPMCQueue(MPMCQueue *queue);
+
+/**
+ * @brief Adds a value at the back of an MPMC queue. It is thread-safe.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (NULL queue or
+ *         allocation failure).
+ */
+bool enqueueMPMC(MPMCQueue *queue, int value);
+
+/**
+ * @brief Removes the value at the front of an MPMC queue. It is thread-safe.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @param valuePtr Pointer to the variable storing the removed value.
+ *
+ * @return True if a value got removed and false if the queue is empty.
+ */
+bool dequeueMPMC(MPMCQueue *queue, int *valuePtr);
+
+/**
+ * @brief Deletes all the nodes of an MPMC queue. It should only be called once
+ *        no other thread uses the queue.
+ *
+ * @param queue Pointer to the queue.
+ */
+void deleteEntireMPMCQueue(MPMCQueue *queue);
+
+/**
+ * @brief Initializes an empty MPSC queue.
+ *
+ * @param queue Pointer to the queue to be initialized.
+ */
+void initMPSCQueue(MPSCQueue *queue);
+
+/**
+ * @brief Adds a node at the back of an MPSC queue. It can be called by any
+ *        number of threads at the same time.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @param node The node to be added, whose value is set by the caller. It
+ *             belongs to the queue until it is dequeued.
+ */
+void enqueueMPSC(MPSCQueue *queue, QueueNode *node);
+
+/**
+ * @brief Removes the node at the front of an MPSC queue. It should only be
+ *        called by one thread at a time (the consumer).
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return The removed node (given back to the caller) or NULL if the queue is
+ *         empty. NULL is also returned if a producer is in the middle of
+ *         adding the only remaining node, in which case trying again later
+ *         succeeds.
+ */
+QueueNode *dequeueMPSC(MPSCQueue *queue);
+
+#endif
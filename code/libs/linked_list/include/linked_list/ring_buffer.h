@@ -0,0 +1,185 @@
+/**
+ * @file ring_buffer.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        a bounded single-producer single-consumer (SPSC) ring buffer.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * REMARK:
+ *
+ * A ring buffer is the array counterpart of a circular list: the slot after
+ * the last one is the first one again. It holds at most capacity values, and
+ * values are added at its back and removed from its front (first in, first
+ * out). Unlike the circular lists, adding never allocates.
+ *
+ * The buffer can be shared by exactly two threads without locks: one producer
+ * (the only one adding) and one consumer (the only one deleting). Both
+ * operations are wait-free, as each index is written by a single thread:
+ *
+ * 1 - The producer owns the tail index and the consumer owns the head index.
+ *     Each of them is published by a release store and read by the other
+ *     thread with an acquire load, which makes the value in the slot visible.
+ *
+ * 2 - The indices keep increasing and are mapped to slots using a mask (the
+ *     capacity is rounded up to a power of two). Hence, the buffer is empty
+ *     when head == tail and full when tail - head == capacity.
+ *
+ * 3 - The producer fields, the consumer fields and the shared read-only fields
+ *     are kept on separate cache lines (false sharing would otherwise bounce
+ *     the line between both threads on every operation). Each thread also
+ *     keeps a cached copy of the other index and only reloads it when the
+ *     buffer looks full (producer) or empty (consumer).
+ *
+ * As the struct is over-aligned, it should be declared as a global or local
+ * variable (malloc does not guarantee such alignment).
+ */
+
+/**
+ * @def RING_BUFFER_CACHE_LINE_SIZE
+ *
+ * @brief The cache line size used to separate producer and consumer fields.
+ */
+#define RING_BUFFER_CACHE_LINE_SIZE 64
+
+/**
+ * @struct RingBuffer
+ *
+ * @brief A bounded single-producer single-consumer ring buffer of integers.
+ */
+typedef struct RingBuffer {
+    /**
+     * @brief The index of the next value to delete (written by the consumer).
+     */
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t head;
+
+    /**
+     * @brief The consumer copy of the tail index (last value it loaded).
+     */
+    size_t cachedTail;
+
+    /**
+     * @brief The index of the next slot to fill (written by the producer).
+     */
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t tail;
+
+    /**
+     * @brief The producer copy of the head index (last value it loaded).
+     */
+    size_t cachedHead;
+
+    /**
+     * @brief The slots of the buffer.
+     */
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) int *values;
+
+    /**
+     * @brief The number of slots (a power of two).
+     */
+    size_t capacity;
+
+    /**
+     * @brief The mask mapping an index to its slot (capacity - 1).
+     */
+    size_t mask;
+} RingBuffer;
+
+/**
+ * @brief Initializes an empty ring buffer.
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @param capacity The minimum number of values the buffer can hold, which is
+ *                 rounded up to a power of two. It should not be zero.
+ *
+ * @return True if the buffer is initialized and false otherwise (invalid
+ *         arguments or allocation failure).
+ */
+bool initRingBuffer(RingBuffer *buffer, size_t capacity);
+
+/**
+ * @brief Displays the values of the ring buffer from its front to its back.
+ *        It should not run concurrently with the producer nor the consumer.
+ *
+ * @param buffer Pointer to the ring buffer.
+ */
+void displayRingBuffer(RingBuffer *buffer);
+
+/**
+ * @brief Converts the ring buffer to a string representation (from its front
+ *        to its back). It should not run concurrently with the producer nor
+ *        the consumer.
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @return A string representation of the buffer.
+ */
+char *ringBufferToString(RingBuffer *buffer);
+
+/**
+ * @brief Adds a value to the back of the ring buffer in O(1). It should only
+ *        be called by the producer thread.
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @param value The value to add.
+ *
+ * @return True if the value is added and false if the buffer is full (or in
+ *         case of NULL buffer).
+ */
+bool addRingBufferValue(RingBuffer *buffer, int value);
+
+/**
+ * @brief Checks if a value is present in the ring buffer. It should only be
+ *        called by the consumer thread (the values it sees cannot be
+ *        overwritten as long as it does not delete them).
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @param value The value to search for.
+ *
+ * @return True if the value is found and false otherwise.
+ */
+bool findRingBufferValue(RingBuffer *buffer, int value);
+
+/**
+ * @brief Deletes the value at the front of the ring buffer (the oldest one) in
+ *        O(1). It should only be called by the consumer thread.
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @param valuePtr Pointer to where the deleted value is stored.
+ *
+ * @return True if a value is deleted and false if the buffer is empty (or in
+ *         case of NULL arguments).
+ */
+bool deleteRingBufferValue(RingBuffer *buffer, int *valuePtr);
+
+/**
+ * @brief Frees the slots of the ring buffer. It should not run concurrently
+ *        with the producer nor the consumer.
+ *
+ * @param buffer Pointer to the ring buffer.
+ */
+void deleteEntireRingBuffer(RingBuffer *buffer);
+
+/**
+ * @brief Returns the number of values in the ring buffer. When called while
+ *        the producer and consumer are working, it is only a snapshot.
+ *
+ * @param buffer Pointer to the ring buffer.
+ *
+ * @return The number of values in the buffer.
+ */
+size_t getRingBufferCount(RingBuffer *buffer);
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file skip_list.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        lock-free (thread-safe) skip lists.
+ */
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * REMARK:
+ *
+ * The ordered unidirectional list (see "unidirectional.h") needs O(n) steps to
+ * find, add or delete a value, and it cannot be shared by several threads. A
+ * skip list keeps the same values in order, but every node also belongs to a
+ * random number of upper levels (a node belongs to level i + 1 with a
+ * probability of 1 / 2 once it belongs to level i). Upper levels act as
+ * express lanes and a search needs O(log n) expected steps:
+ *
+ * 1 - A search starts at the top level of the head node, moves forward while
+ *     the next value is smaller and goes one level down otherwise.
+ *
+ * 2 - Links are updated by compare-and-swap (CAS) only, so no thread ever
+ *     waits for a lock. A node is added at level 0 first (which makes it part
+ *     of the list) and then linked to its upper levels.
+ *
+ * 3 - A node is deleted by marking its next pointers (lowest pointer bit) from
+ *     top to bottom. The thread marking level 0 is the one deleting it. Marked
+ *     nodes are then unlinked by any thread passing by.
+ *
+ * 4 - Unlinked nodes are retired using epoch-based reclamation (see
+ *     "reclamation/ebr.h") as other threads may still be visiting them.
+ *
+ * Like the ordered lists, values are kept in ascending order. However,
+ * duplicates are not allowed (set semantics).
+ */
+
+/**
+ * @def SKIP_LIST_MAX_LEVEL
+ *
+ * @brief The maximum number of levels of a node, which suits lists of up to
+ *        2^SKIP_LIST_MAX_LEVEL values.
+ */
+#define SKIP_LIST_MAX_LEVEL 24
+
+/**
+ * @struct SkipNode
+ *
+ * @brief A skip list node.
+ */
+typedef struct SkipNode {
+    /**
+     * @brief The value stored in the node.
+     */
+    int value;
+
+    /**
+     * @brief The number of levels the node belongs to.
+     */
+    int numLevels;
+
+    /**
+     * @brief The number of threads (adding and deleting ones) that still need
+     *        the node before it can be retired.
+     */
+    atomic_int numOwners;
+
+    /**
+     * @brief Pointer to the next node in the retired list (in case it could
+     *        not be retired).
+     */
+    struct SkipNode *nextRetired;
+
+    /**
+     * @brief The next nodes per level as pointers whose lowest bit tells if
+     *        the node is deleted (marked) at that level.
+     */
+    _Atomic uintptr_t next[];
+} SkipNode;
+
+/**
+ * @struct SkipList
+ *
+ * @brief A lock-free skip list.
+ */
+typedef struct SkipList {
+    /**
+     * @brief The head node holding no value, which belongs to all levels.
+     */
+    SkipNode *head;
+
+    /**
+     * @brief The list of unlinked nodes that could not be retired (allocation
+     *        failure), to be freed upon deletion of the entire list.
+     */
+    SkipNode *_Atomic retired;
+
+    /**
+     * @brief The number of values in the list.
+     */
+    atomic_size_t count;
+} SkipList;
+
+/**
+ * @brief Initializes an empty skip list.
+ *
+ * @param list Pointer to the list to be initialized.
+ *
+ * @return True if the list got initialized and false otherwise (NULL list or
+ *         allocation failure).
+ */
+bool initSkipList(SkipList *list);
+
+/**
+ * @brief Displays the values of a skip list in ascending order.
+ *
+ * @param list Pointer to the list.
+ */
+void displaySkipList(SkipList *list);
+
+/**
+ * @brief Converts a skip list to a string representation.
+ *
+ * @param list Pointer to the list.
+ *
+ * @return A string representation of the list.
+ */
+char *skipListToString(SkipList *list);
+
+/**
+ * @brief Adds a value to a skip list in ascending order. It is thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (already existing
+ *         value or allocation failure).
+ */
+bool addSkipNode(SkipList *list, int value);
+
+/**
+ * @brief Tells if a value exists in a skip list. It is thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return True if the value exists and false otherwise.
+ */
+bool findSkipNode(SkipList *list, int value);
+
+/**
+ * @brief Deletes a value from a skip list. It is thread-safe.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value got deleted and false otherwise.
+ */
+bool deleteSkipNode(SkipList *list, int value);
+
+/**
+ * @brief Deletes the entire skip list (all its nodes including the head). It
+ *        should only be called once no other thread uses the list.
+ *
+ * @param list Pointer to the list.
+ */
+void deleteEntireSkipList(SkipList *list);
+
+/**
+ * @brief Retrieves the number of values in a skip list.
+ *
+ * @param list Pointer to the list.
+ *
+ * @return The number of values.
+ */
+size_t getSkipNodesCount(SkipList *list);
+
+#endif
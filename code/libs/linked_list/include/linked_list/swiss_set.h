@@ -0,0 +1,161 @@
+/**
+ * @file swiss_set.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        open-addressing integer sets probed a group of slots at a time
+ *        (Swiss tables).
+ */
+
+#ifndef SWISS_SET_H
+#define SWISS_SET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * REMARK:
+ *
+ * The chained hash table (see "hash_table.h") allocates a node per value and
+ * follows pointers from node to node. A Swiss table instead stores the values
+ * in a flat array of slots (no allocation per value), along with a control
+ * byte per slot:
+ *
+ * - EMPTY (0x80) for a slot that was never used since the last rehash.
+ *
+ * - DELETED (0xFE) for a slot whose value got deleted (tombstone).
+ *
+ * - The 7 lowest bits of the hash of the value (H2) for a full slot.
+ *
+ * The slots are split into groups of SWISS_SET_GROUP_SIZE. The other hash
+ * bits (H1) choose the first group to probe, and groups are probed one after
+ * the other (triangular probing) until the value is found or a group has an
+ * EMPTY slot. Within a group, the 16 control bytes are compared against H2 at
+ * once using SSE2 instructions (a portable loop is used otherwise), so only
+ * the slots whose H2 matches (1 / 128 of the others on average) have their
+ * value compared.
+ *
+ * The table is rehashed into twice as many groups once 7 / 8 of its slots are
+ * full or deleted (or into the same number if mostly deleted), hence probes
+ * stay short.
+ */
+
+/**
+ * @def SWISS_SET_GROUP_SIZE
+ *
+ * @brief The number of slots (control bytes) of a group.
+ */
+#define SWISS_SET_GROUP_SIZE 16
+
+/**
+ * @struct SwissSet
+ *
+ * @brief An open-addressing integer set.
+ */
+typedef struct SwissSet {
+    /**
+     * @brief The control bytes of the slots.
+     */
+    int8_t *controls;
+
+    /**
+     * @brief The values of the slots.
+     */
+    int *values;
+
+    /**
+     * @brief The number of groups (a power of two).
+     */
+    size_t numGroups;
+
+    /**
+     * @brief The number of values in the set.
+     */
+    size_t count;
+
+    /**
+     * @brief The number of DELETED slots.
+     */
+    size_t numDeleted;
+} SwissSet;
+
+/**
+ * @brief Initializes an empty set having a single group.
+ *
+ * @param set Pointer to the set to be initialized.
+ *
+ * @return True if the set got initialized and false otherwise (NULL set or
+ *         allocation failure).
+ */
+bool initSwissSet(SwissSet *set);
+
+/**
+ * @brief Displays the values of a set (in no particular order).
+ *
+ * @param set Pointer to the set.
+ */
+void displaySwissSet(SwissSet *set);
+
+/**
+ * @brief Converts a set to a string representation (in no particular order).
+ *
+ * @param set Pointer to the set.
+ *
+ * @return A string representation of the set.
+ */
+char *swissSetToString(SwissSet *set);
+
+/**
+ * @brief Adds a value to a set in O(1) on average.
+ *
+ * @param set Pointer to the set.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the value got added and false otherwise (NULL set, already
+ *         existing value or allocation failure while rehashing).
+ */
+bool addSwissValue(SwissSet *set, int value);
+
+/**
+ * @brief Tells if a value exists in a set in O(1) on average.
+ *
+ * @param set Pointer to the set.
+ *
+ * @param value The value to search for.
+ *
+ * @return True if the value exists and false otherwise.
+ */
+bool findSwissValue(SwissSet *set, int value);
+
+/**
+ * @brief Deletes a value from a set in O(1) on average.
+ *
+ * @param set Pointer to the set.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value got deleted and false otherwise.
+ */
+bool deleteSwissValue(SwissSet *set, int value);
+
+/**
+ * @brief Deletes the entire set (frees its slots). It has to be initialized
+ *        again before being reused.
+ *
+ * @param set Pointer to the set.
+ */
+void deleteEntireSwissSet(SwissSet *set);
+
+/**
+ * @brief Retrieves the number of values in a set in O(1).
+ *
+ * @param set Pointer to the set.
+ *
+ * @return The number of values.
+ */
+size_t getSwissValuesCount(SwissSet *set);
+
+#endif
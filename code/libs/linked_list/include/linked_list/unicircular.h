@@ -0,0 +1,288 @@
+/**
+ * @file unicircular.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the functions associated with unidirectional
+ *        circular linked lists, embracing both unordered and ordered versions.
+ */
+
+#ifndef UNICIRCULAR_H
+#define UNICIRCULAR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "linked_list/unidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * A unidirectional circular list is made of UniNode nodes, where the next
+ * pointer of the last node points back to the first node. The list is kept by
+ * a pointer to its last node (rather than its first one): the first node is
+ * then root->next, which gives O(1) access to both ends. Hence, adding to the
+ * end of the list (and, for ordered lists, adding a value not smaller than the
+ * maximum one) takes O(1) instead of O(n). An empty list has a NULL root.
+ */
+
+// Task 1: Textual Description
+/**
+ * @brief Displays the elements of a unidirectional circular list starting from
+ *        its first node.
+ *
+ * @param root Pointer to the last node of the list.
+ */
+void displayUniCircularList(UniNode *root);
+
+/**
+ * @brief Converts a unidirectional circular list to a string representation.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @return A string representation of the list.
+ */
+char *uniCircularListToString(UniNode *root);
+
+// Task 2: Creation Operation
+/**
+ * @brief Adds a new node with the specified value to the end of the
+ *        unidirectional circular list in O(1).
+ *
+ * @param root Pointer to a pointer to the last node of the list, which is set
+ *             to the new node. If the list is empty, *root should be NULL. The
+ *             value of root should not be NULL. Otherwise, nothing is done.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addUniCircularNode(UniNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to the end of the
+ *        unidirectional circular list. As the end is reached in O(1), there
+ *        is nothing to recurse on, and it behaves as addUniCircularNode (it is
+ *        kept for the sake of having the same functions as other lists).
+ *
+ * @param root Pointer to a pointer to the last node of the list.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addUniCircularNodeRecursively(UniNode **root, int value);
+
+// Task 3: Read / Find Operations
+/**
+ * @brief Finds the first node with specified value in the given unidirectional
+ *        circular list.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the first node found with the specified value, or NULL
+ *         in case of non-existing value.
+ */
+UniNode *findUniCircularNode(UniNode *root, int value);
+
+/**
+ * @brief Finds recursively the first node with specified value in the given
+ *        unidirectional circular list.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the first node found with the specified value, or NULL
+ *         in case of non-existing value.
+ */
+UniNode *findUniCircularNodeRecursively(UniNode *root, int value);
+
+// Task 4: Update Operation
+/**
+ * @brief Updates the value of the first node with the given original value.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param originalValue The original value to search for.
+ *
+ * @param newValue The new value to set for the first found node.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateUniCircularNode(UniNode *root, int originalValue, int newValue);
+
+/**
+ * @brief Updates the value of the first node with the given original value. It
+ *        is based on recursive approach.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param originalValue The original value to search for.
+ *
+ * @param newValue The new value to set for the first found node.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateUniCircularNodeRecursively(UniNode *root,
+                                      int originalValue,
+                                      int newValue);
+
+// Task 5: Delete Operation
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        unidirectional circular list.
+ *
+ * @param root Pointer to a pointer to the last node of the list (updated if
+ *             the last node is deleted).
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteUniCircularNode(UniNode **root, int value);
+
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        unidirectional circular list. It is based on recursion.
+ *
+ * @param root Pointer to a pointer to the last node of the list (updated if
+ *             the last node is deleted).
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteUniCircularNodeRecursively(UniNode **root, int value);
+
+// Task 6: Delete Entire List
+/**
+ * @brief Deletes the entire unidirectional circular list.
+ *
+ * @param root A pointer to a pointer to the last node of the list, which is
+ *             set to NULL.
+ */
+void deleteEntireUniCircularList(UniNode **root);
+
+/**
+ * @brief Deletes the entire unidirectional circular list. It is based on
+ *        recursion.
+ *
+ * @param root A pointer to a pointer to the last node of the list, which is
+ *             set to NULL.
+ */
+void deleteEntireUniCircularListRecursively(UniNode **root);
+
+// Task 7: Getting List Length / UniNodes Count
+/**
+ * @brief Counts the number of nodes in the given unidirectional circular list.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getUniCircularNodesCount(UniNode *root);
+
+/**
+ * @brief Counts the number of nodes in the given unidirectional circular list.
+ *        It is based on recursion.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getUniCircularNodesCountRecursively(UniNode *root);
+
+// Task 8: Ordered Unidirectional Circular List
+/**
+ * @brief Adds a new node with the specified value to the given unidirectional
+ *        circular list in ascending order. Adding a value that is not smaller
+ *        than the last (maximum) one takes O(1).
+ *
+ * @param root A pointer to a pointer to the last node of the list.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedUniCircularNode(UniNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to the given unidirectional
+ *        circular list in ascending order. It utilizes recursion.
+ *
+ * @param root A pointer to a pointer to the last node of the list.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedUniCircularNodeRecursively(UniNode **root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered unidirectional
+ *        circular list. Values greater than the last (maximum) one are
+ *        rejected in O(1).
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+UniNode *findOrderedUniCircularNode(UniNode *root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered unidirectional
+ *        circular list. It is based on recursion.
+ *
+ * @param root Pointer to the last node of the list.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+UniNode *findOrderedUniCircularNodeRecursively(UniNode *root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered
+ *        unidirectional circular list.
+ *
+ * @param root A pointer to a pointer to the last node of the list.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedUniCircularNode(UniNode **root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered
+ *        unidirectional circular list. It is based on recursion.
+ *
+ * @param root A pointer to a pointer to the last node of the list.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedUniCircularNodeRecursively(UniNode **root, int value);
+
+// Task 9: Sorting
+/**
+ * @brief Sorts the given unidirectional circular list in ascending order in
+ *        O(n log(n)). It breaks the circle, sorts the nodes in place using
+ *        sortUniList and closes the circle again.
+ *
+ * @param root A pointer to a pointer to the last node of the list, which
+ *             is set to the new last node.
+ */
+void sortUniCircularList(UniNode **root);
+
+#endif
@@ -282,4 +282,215 @@ bool deleteOrderedUniNode(UniNode **root, int value);
  */
 bool deleteOrderedUniNodeRecursively(UniNode **root, int value);
 
+// Task 9: Sorting
+/**
+ * @brief Sorts the given unidirectional list in ascending order, turning it
+ *        into an ordered list in O(n log(n)) instead of the O(n^2) of adding
+ *        every value with addOrderedUniNode. It is an in-place iterative
+ *        bottom-up merge sort: nodes are relinked (never allocated nor
+ *        copied) and equal values keep their relative order (stable sort).
+ *
+ * @param root A pointer to a pointer to the root node of the unidirectional
+ *             list to sort, which is set to the new first node.
+ */
+void sortUniList(UniNode **root);
+
+// Task 10: Bulk Operations
+/**
+ * @brief Adds a batch of values to the given ordered unidirectional list in a
+ *        single O(n + count) pass, instead of the O(n * count) of calling
+ *        addOrderedUniNode for every value. The new nodes are allocated
+ *        first, and nothing is added if any allocation fails.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered
+ *             unidirectional list to add to.
+ *
+ * @param values The values to add (can be NULL if count is zero).
+ *
+ * @param count The number of values to add.
+ *
+ * @param areSorted Tells if the values are given in ascending order. If not,
+ *                  the new nodes are sorted first using sortUniList, which
+ *                  makes the whole operation O(n + count log(count)).
+ *
+ * @return True if all the values are added and false otherwise (in which case
+ *         the list is left unchanged).
+ */
+bool addOrderedUniNodes(UniNode **root,
+                        const int *values,
+                        size_t count,
+                        bool areSorted);
+
+/**
+ * @brief Looks up a batch of keys in the given ordered unidirectional list in a
+ *        single O(n + count) merge-join pass, instead of the O(n * count) of
+ *        calling findOrderedUniNode for every key. The scan for a key
+ *        resumes where the scan for the previous key stopped.
+ *
+ * @param root A pointer to the root node of the ordered unidirectional list to
+ *             search.
+ *
+ * @param keys The keys to search for, in ascending order (duplicates are
+ *             allowed). A key smaller than the previous one is still found
+ *             correctly, but restarts the scan from the root.
+ *
+ * @param count The number of keys.
+ *
+ * @param nodes An array of count entries receiving, for every key, a pointer
+ *              to the first node holding it or NULL if it does not exist. It
+ *              can be NULL if only the number of found keys is needed.
+ *
+ * @return The number of keys found in the list.
+ */
+size_t findOrderedUniNodes(UniNode *root,
+                           const int *keys,
+                           size_t count,
+                           UniNode **nodes);
+
+// Task 11: Set Operations
+/**
+ * @brief Builds a new ordered unidirectional list holding the values present in
+ *        either list, in a single O(n + m) pass over the two given ordered
+ *        lists (which are left unchanged). As the lists represent sets, every
+ *        value appears once in the result even if it is repeated in the given
+ *        lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedUniListsUnion(UniNode *first,
+                             UniNode *second,
+                             UniNode **result);
+
+/**
+ * @brief Builds a new ordered unidirectional list holding the values present in
+ *        both lists, in a single O(n + m) pass over the two given ordered lists
+ *        (which are left unchanged). As the lists represent sets, every value
+ *        appears once in the result even if it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedUniListsIntersection(UniNode *first,
+                                    UniNode *second,
+                                    UniNode **result);
+
+/**
+ * @brief Builds a new ordered unidirectional list holding the values of the
+ *        first list that are not in the second one, in a single O(n + m) pass
+ *        over the two given ordered lists (which are left unchanged). As the
+ *        lists represent sets, every value appears once in the result even if
+ *        it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedUniListsDifference(UniNode *first,
+                                  UniNode *second,
+                                  UniNode **result);
+
+// Task 12: Positional Operations
+/**
+ * REMARK:
+ *
+ * The functions above locate the node to work on by value, searching from the
+ * root node. The positional functions below work right after a node the
+ * caller already holds (typically while traversing the list), in O(1). As a
+ * UniNode has no link to its previous node, they cannot work before it.
+ */
+
+/**
+ * @brief Adds a node right after the given node of a unidirectional list in
+ *        O(1).
+ *
+ * @param node Pointer to a node of the list.
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the node got added and false otherwise (NULL node or
+ *         allocation failure).
+ */
+bool addUniNodeAfter(UniNode *node, int value);
+
+/**
+ * @brief Deletes the node right after the given node of a unidirectional list
+ *        in O(1).
+ *
+ * @param node Pointer to a node of the list.
+ *
+ * @return True if a node got deleted and false otherwise (NULL node or last
+ *         node).
+ */
+bool deleteUniNodeAfter(UniNode *node);
+
+// Task 13: Self-Organizing Search
+/**
+ * REMARK:
+ *
+ * When some values are searched for far more often than others, an unordered
+ * list can reorganize itself so that these values end up near the root node:
+ *
+ * 1 - Move-to-front: the found node is moved to the front of the list, so a
+ *     value searched for again soon is found in a few steps. It adapts fast to
+ *     changing access patterns.
+ *
+ * 2 - Transpose: the found node is swapped with the node before it, so
+ *     frequently searched values move up one step at a time. It adapts more
+ *     slowly but is not disturbed by a value searched for only once.
+ *
+ * Both cost the same as findUniNode plus O(1) relinking. They reorder the
+ * nodes, hence they only suit unordered lists.
+ */
+
+/**
+ * @brief Finds the first node holding the given value in an unordered
+ *        unidirectional list and moves it to the front of the list.
+ *
+ * @param root A pointer to a pointer to the root node of the unordered
+ *             unidirectional list, which is set to the found node.
+ *
+ * @param value The value to search for.
+ *
+ * @return Pointer to the found node or NULL if not found.
+ */
+UniNode *findUniNodeMovingToFront(UniNode **root, int value);
+
+/**
+ * @brief Finds the first node holding the given value in an unordered
+ *        unidirectional list and swaps it with the node before it.
+ *
+ * @param root A pointer to a pointer to the root node of the unordered
+ *             unidirectional list, which is updated if the found node becomes
+ *             the first one.
+ *
+ * @param value The value to search for.
+ *
+ * @return Pointer to the found node or NULL if not found.
+ */
+UniNode *findUniNodeTransposing(UniNode **root, int value);
+
 #endif
@@ -0,0 +1,461 @@
+/**
+ * @file xor_bidirectional.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        XOR-linked bidirectional lists, embracing both unordered and ordered
+ *        versions.
+ */
+
+#ifndef XOR_BIDIRECTIONAL_H
+#define XOR_BIDIRECTIONAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * REMARK:
+ *
+ * A BiNode spends two pointers per value (24 bytes on 64-bit platforms, due
+ * to padding). An XorNode keeps a single field instead, being the XOR of the
+ * addresses of its previous and next nodes (NULL counting as zero), hence 16
+ * bytes, i.e. two thirds of the memory of a BiNode.
+ *
+ * Coming from one neighbor, the other one is obtained by XOR-ing the field
+ * with the address of the neighbor we come from. As the first node has no
+ * previous node, its field is the address of the second one, and walking can
+ * start from it. The same holds for the last node, so the list can be walked
+ * backward starting from it: the last node is the root of the reversed list.
+ * Hence, all the functions below work from either end, as long as the given
+ * root is an end of the list (the ordered functions then assume the list is
+ * ordered from that end). However, a node in the middle of the list is not
+ * enough to walk it, as its neighbors cannot be told apart, which is why the
+ * finger search and the cursor of "bidirectional.h" have no XOR counterpart.
+ *
+ * An empty list has a NULL root.
+ */
+
+// Task 1: Data Structure Declaration and Textual Description
+/**
+ * @struct XorNode
+ *
+ * @brief An XOR-linked bidirectional list node.
+ */
+typedef struct XorNode {
+    /**
+     * @brief The value stored in the node. It can be of any type.
+     *        In case of ordered list, the type should be comparable.
+     */
+    int value;
+
+    /**
+     * @brief The address of the previous node XOR-ed with the address of the
+     *        next node.
+     */
+    uintptr_t link;
+} XorNode;
+
+/**
+ * @brief Displays the elements of an XOR-linked list starting from the given
+ *        end node.
+ *
+ * @param root Pointer to the end node of the list to start from.
+ */
+void displayXorList(XorNode *root);
+
+/**
+ * @brief Converts an XOR-linked list to a string representation, starting
+ *        from the given end node.
+ *
+ * @param root Pointer to the end node of the list to start from.
+ *
+ * @return A string representation of the list.
+ */
+char *xorListToString(XorNode *root);
+
+// Task 2: Creation Operation
+/**
+ * @brief Adds a new node with the specified value to the end of the
+ *        XOR-linked list.
+ *
+ * @param root Pointer to a pointer to the first node of the list. If the list
+ *             is empty, *root should be NULL. The value of root should not
+ *             be NULL. Otherwise, nothing is done.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addXorNode(XorNode **root, int value);
+
+/**
+ * @brief Recursively adds a new node with the specified value to the end of
+ *        the XOR-linked list.
+ *
+ * @param root Pointer to a pointer to the first node of the list. If the list
+ *             is empty, *root should be NULL. The value of root should not
+ *             be NULL. Otherwise, nothing is done.
+ *
+ * @param value Value to be stored in the new node.
+ *
+ * @return True if the node was added successfully and false otherwise.
+ */
+bool addXorNodeRecursively(XorNode **root, int value);
+
+// Task 3: Read / Find Operations
+/**
+ * @brief Finds the first node with the specified value in the given
+ *        XOR-linked list.
+ *
+ * @param root A pointer to the root node of the list to search.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist. Note that the node alone cannot be used
+ *         to walk the list.
+ */
+XorNode *findXorNode(XorNode *root, int value);
+
+/**
+ * @brief Finds the first node with the specified value in the given
+ *        XOR-linked list. It is based on recursion.
+ *
+ * @param root A pointer to the root node of the list to search.
+ *
+ * @param value The value to search for.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+XorNode *findXorNodeRecursively(XorNode *root, int value);
+
+// Task 4: Update Operation
+/**
+ * @brief Updates the value of the first node with the specified value in the
+ *        given XOR-linked list.
+ *
+ * @param root A pointer to the root node of the list to search.
+ *
+ * @param originalValue The value to search for.
+ *
+ * @param newValue The new value to replace the original one.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateXorNode(XorNode *root, int originalValue, int newValue);
+
+/**
+ * @brief Updates the value of the first node with the specified value in the
+ *        given XOR-linked list. It is based on recursion.
+ *
+ * @param root A pointer to the root node of the list to search.
+ *
+ * @param originalValue The value to search for.
+ *
+ * @param newValue The new value to replace the original one.
+ *
+ * @return True if a node is found and updated and false otherwise.
+ */
+bool updateXorNodeRecursively(XorNode *root, int originalValue, int newValue);
+
+// Task 5: Delete Operation
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        XOR-linked list.
+ *
+ * @param root A pointer to a pointer to the root node of the list to search.
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteXorNode(XorNode **root, int value);
+
+/**
+ * @brief Deletes the first node with the specified value from the given
+ *        XOR-linked list. It is based on recursion.
+ *
+ * @param root A pointer to a pointer to the root node of the list to search.
+ *
+ * @param value The value to search for and delete.
+ *
+ * @return True if a node is found and deleted and false otherwise.
+ */
+bool deleteXorNodeRecursively(XorNode **root, int value);
+
+// Task 6: Delete Entire List
+/**
+ * @brief Deletes the XOR-linked list starting from the given root node.
+ *
+ * @param root A pointer to a pointer to the root node of the list to delete
+ *             entirely.
+ */
+void deleteEntireXorList(XorNode **root);
+
+/**
+ * @brief Deletes the XOR-linked list starting from the given root node. It is
+ *        based on recursion.
+ *
+ * @param root A pointer to a pointer to the root node of the list to delete
+ *             entirely.
+ */
+void deleteEntireXorListRecursively(XorNode **root);
+
+// Task 7: Getting List Length / XorNodes Count
+/**
+ * @brief Counts the number of nodes in the given XOR-linked list.
+ *
+ * @param root A pointer to the root node of the list to count.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getXorNodesCount(XorNode *root);
+
+/**
+ * @brief Counts the number of nodes in the given XOR-linked list. It is based
+ *        on recursion.
+ *
+ * @param root A pointer to the root node of the list to count.
+ *
+ * @return The total number of nodes in the list.
+ */
+size_t getXorNodesCountRecursively(XorNode *root);
+
+// Task 8: Ordered XOR-Linked List
+/**
+ * @brief Adds a new node with the specified value to the given XOR-linked
+ *        list in ascending order.
+ *
+ * @param root A pointer to a pointer to the root node of the list to add to.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedXorNode(XorNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to the given XOR-linked
+ *        list in ascending order. It utilizes recursion.
+ *
+ * @param root A pointer to a pointer to the root node of the list to add to.
+ *
+ * @param value The value to add to the list.
+ *
+ * @return True if a new node is added to the list and false otherwise.
+ */
+bool addOrderedXorNodeRecursively(XorNode **root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered XOR-linked
+ *        list.
+ *
+ * @param root A pointer to the root node of the ordered list to search.
+ *
+ * @param value The value to search for in the list.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+XorNode *findOrderedXorNode(XorNode *root, int value);
+
+/**
+ * @brief Finds the node with the specified value in an ordered XOR-linked
+ *        list. It is based on recursion.
+ *
+ * @param root A pointer to the root node of the ordered list to search.
+ *
+ * @param value The value to search for in the list.
+ *
+ * @return A pointer to the node that contains the specified value, or NULL if
+ *         the value does not exist.
+ */
+XorNode *findOrderedXorNodeRecursively(XorNode *root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered XOR-linked
+ *        list.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered list to
+ *             delete from.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedXorNode(XorNode **root, int value);
+
+/**
+ * @brief Deletes the node with the specified value from an ordered XOR-linked
+ *        list. It is based on recursion.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered list to
+ *             delete from.
+ *
+ * @param value The value to delete from the list.
+ *
+ * @return True if a node with the specified value is found and deleted from
+ *         the list and false otherwise.
+ */
+bool deleteOrderedXorNodeRecursively(XorNode **root, int value);
+
+// Task 9: Sorting
+/**
+ * @brief Sorts the given XOR-linked list in ascending order in O(n log(n)),
+ *        using the same stable bottom-up merge sort as sortBiList. The link
+ *        fields temporarily hold plain next addresses while merging, and are
+ *        turned back into XOR links in a single final pass.
+ *
+ * @param root A pointer to a pointer to the root node of the list to sort,
+ *             which is set to the new first node.
+ */
+void sortXorList(XorNode **root);
+
+// Task 10: Bulk Operations
+/**
+ * @brief Adds a batch of values to the given ordered XOR-linked list in a
+ *        single O(n + count) pass, instead of the O(n * count) of calling
+ *        addOrderedXorNode for every value. The new nodes are allocated
+ *        first, and nothing is added if any allocation fails.
+ *
+ * @param root A pointer to a pointer to the root node of the ordered list to
+ *             add to.
+ *
+ * @param values The values to add (can be NULL if count is zero).
+ *
+ * @param count The number of values to add.
+ *
+ * @param areSorted Tells if the values are given in ascending order. If not,
+ *                  the new nodes are sorted first, which makes the whole
+ *                  operation O(n + count log(count)).
+ *
+ * @return True if all the values are added and false otherwise (in which case
+ *         the list is left unchanged).
+ */
+bool addOrderedXorNodes(XorNode **root,
+                        const int *values,
+                        size_t count,
+                        bool areSorted);
+
+/**
+ * @brief Looks up a batch of keys in the given ordered XOR-linked list in a
+ *        single O(n + count) merge-join pass, instead of the O(n * count) of
+ *        calling findOrderedXorNode for every key.
+ *
+ * @param root A pointer to the root node of the ordered list to search.
+ *
+ * @param keys The keys to search for, in ascending order (duplicates are
+ *             allowed). A key smaller than the previous one is still found
+ *             correctly, but restarts the scan from the root.
+ *
+ * @param count The number of keys.
+ *
+ * @param nodes An array of count entries receiving, for every key, a pointer
+ *              to the first node holding it or NULL if it does not exist. It
+ *              can be NULL if only the number of found keys is needed.
+ *
+ * @return The number of keys found in the list.
+ */
+size_t findOrderedXorNodes(XorNode *root,
+                           const int *keys,
+                           size_t count,
+                           XorNode **nodes);
+
+// Task 11: Set Operations
+/**
+ * @brief Builds a new ordered XOR-linked list holding the values present in
+ *        either list, in a single O(n + m) pass over the two given ordered
+ *        lists (which are left unchanged). Every value appears once in the
+ *        result even if it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedXorListsUnion(XorNode *first,
+                             XorNode *second,
+                             XorNode **result);
+
+/**
+ * @brief Builds a new ordered XOR-linked list holding the values present in
+ *        both lists, in a single O(n + m) pass over the two given ordered
+ *        lists (which are left unchanged). Every value appears once in the
+ *        result even if it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedXorListsIntersection(XorNode *first,
+                                    XorNode *second,
+                                    XorNode **result);
+
+/**
+ * @brief Builds a new ordered XOR-linked list holding the values of the first
+ *        list that are not in the second one, in a single O(n + m) pass over
+ *        the two given ordered lists (which are left unchanged). Every value
+ *        appears once in the result even if it is repeated in the given lists.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored
+ *               (NULL for an empty result). Its previous content is
+ *               overwritten, so it should not hold an existing list.
+ *
+ * @return True if the new list is built and false otherwise (NULL result or
+ *         allocation failure, in which case *result is set to NULL).
+ */
+bool getOrderedXorListsDifference(XorNode *first,
+                                  XorNode *second,
+                                  XorNode **result);
+
+// Task 12: Traversal From Either End
+/**
+ * @brief Retrieves the other end of an XOR-linked list, i.e. its last node
+ *        when given its first one (and vice versa).
+ *
+ * @param root A pointer to an end node of the list.
+ *
+ * @return A pointer to the other end node (NULL for an empty list).
+ */
+XorNode *getXorListOtherEnd(XorNode *root);
+
+/**
+ * @brief Visits the values of an XOR-linked list starting from the given end,
+ *        i.e. forward from its first node or backward from its last one.
+ *
+ * @param root A pointer to the end node of the list to start from.
+ *
+ * @param visit The function called with every value and context. It returns
+ *              true to go on and false to stop the traversal.
+ *
+ * @param context The pointer passed as is to visit (it can be NULL).
+ *
+ * @return True if all values were visited and false if visit stopped the
+ *         traversal.
+ */
+bool traverseXorList(XorNode *root,
+                     bool (*visit)(int value, void *context),
+                     void *context);
+
+#endif
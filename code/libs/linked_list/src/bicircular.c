@@ -0,0 +1,474 @@
+/**
+ * @file bicircular.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated with
+ *        bidirectional circular linked lists, embracing both unordered and
+ *        ordered versions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linked_list/bicircular.h"
+#include "linked_list/common.h"
+
+/**
+ * @brief Unlinks and frees the given node.
+ *
+ * @param root Pointer to a pointer to the first node of the list.
+ *
+ * @param itemPtr The node to be deleted.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void deleteNode(BiNode **root, BiNode *itemPtr) {
+    if(itemPtr->next == itemPtr) {
+        // The only node of the list
+        *root = NULL;
+    }
+    else {
+        itemPtr->prev->next = itemPtr->next;
+        itemPtr->next->prev = itemPtr->prev;
+
+        if(itemPtr == *root) {
+            // The first node is deleted, so its successor becomes the first
+            *root = itemPtr->next;
+        }
+    }
+
+    free(itemPtr);
+}
+
+/**
+ * @brief Inserts a new node before the given one.
+ *
+ * @param root Pointer to a pointer to the first node of the list.
+ *
+ * @param nextPtr The node before which to insert (NULL for an empty list).
+ *
+ * @param value The value of the new node.
+ *
+ * @param isFirst Tells if the new node becomes the first one.
+ *
+ * @return True if the node was added and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool insertNode(BiNode **root, BiNode *nextPtr, int value, bool isFirst) {
+    bool added = false;
+    BiNode *newItemPtr = malloc(sizeof(BiNode));
+
+    if(newItemPtr) {
+        newItemPtr->value = value;
+
+        if(nextPtr) {
+            newItemPtr->next = nextPtr;
+            newItemPtr->prev = nextPtr->prev;
+            nextPtr->prev->next = newItemPtr;
+            nextPtr->prev = newItemPtr;
+        }
+        else {
+            // The single node points to itself in both directions
+            newItemPtr->next = newItemPtr->prev = newItemPtr;
+            isFirst = true;
+        }
+
+        if(isFirst) {
+            *root = newItemPtr;
+        }
+
+        added = true;
+    }
+
+    return added;
+}
+
+// Task 1: Textual Description
+void displayBiCircularList(BiNode *root) {
+    printf("\n< ");
+
+    if(root) {
+        BiNode *itemPtr = root;
+
+        do {
+            if(itemPtr->next != root) {
+                printf("%d | ", itemPtr->value);
+            }
+            else {
+                printf("%d ", itemPtr->value);
+            }
+
+            itemPtr = itemPtr->next;
+        } while(itemPtr != root);
+    }
+
+    printf(">\n");
+}
+
+char *biCircularListToString(BiNode *root) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len;
+
+    if (!root) {
+        str = initialize("< >");
+    }
+    else {
+        BiNode *itemPtr = root;
+        tmp_str = initialize("");
+
+        do {
+            if (itemPtr->next != root) {
+                len = snprintf(NULL, 0, " %d |", itemPtr->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, " %d |", itemPtr->value);
+            }
+            else {
+                len = snprintf(NULL, 0, " %d ", itemPtr->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, " %d ", itemPtr->value);
+            }
+
+            str = concatenate(tmp_str, item);
+            freeCharPtrs(2, tmp_str, item);
+            tmp_str = str;
+            itemPtr = itemPtr->next;
+        } while(itemPtr != root);
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+// Task 2: Creation Operation
+bool addBiCircularNode(BiNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        // Inserting before the first node is adding after the last one
+        added = insertNode(root, *root, value, false);
+    }
+
+    return added;
+}
+
+bool addBiCircularNodeRecursively(BiNode **root, int value) {
+    // The end is reached in O(1), so there is nothing to recurse on
+    return addBiCircularNode(root, value);
+}
+
+// Task 3: Read / Find Operations
+BiNode *findBiCircularNode(BiNode *root, int value) {
+    BiNode *itemPtr = NULL;
+
+    if(root) {
+        BiNode *currentPtr = root;
+
+        do {
+            if(currentPtr->value == value) {
+                itemPtr = currentPtr;
+            }
+
+            currentPtr = currentPtr->next;
+        } while(!itemPtr && currentPtr != root);
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Finds recursively the first node with the specified value starting
+ *        from a given node up to the last one.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static BiNode *findFromNode(BiNode *node, BiNode *firstPtr, int value) {
+    BiNode *itemPtr = NULL;
+
+    if(node->value == value) {
+        itemPtr = node;
+    }
+    else if(node->next != firstPtr) {
+        itemPtr = findFromNode(node->next, firstPtr, value);
+    }
+
+    return itemPtr;
+}
+
+BiNode *findBiCircularNodeRecursively(BiNode *root, int value) {
+    return root ? findFromNode(root, root, value) : NULL;
+}
+
+// Task 4: Update Operation
+bool updateBiCircularNode(BiNode *root, int originalValue, int newValue) {
+    bool updated = false;
+    BiNode *itemPtr = findBiCircularNode(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+        updated = true;
+    }
+
+    return updated;
+}
+
+bool updateBiCircularNodeRecursively(BiNode *root,
+                                     int originalValue,
+                                     int newValue) {
+    bool updated = false;
+    BiNode *itemPtr = findBiCircularNodeRecursively(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+        updated = true;
+    }
+
+    return updated;
+}
+
+// Task 5: Delete Operation
+bool deleteBiCircularNode(BiNode **root, int value) {
+    bool deleted = false;
+    BiNode *itemPtr = root ? findBiCircularNode(*root, value) : NULL;
+
+    if(itemPtr) {
+        // Knowing its previous node, the found node is unlinked in O(1)
+        deleteNode(root, itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+bool deleteBiCircularNodeRecursively(BiNode **root, int value) {
+    bool deleted = false;
+    BiNode *itemPtr = root ? findBiCircularNodeRecursively(*root, value) : NULL;
+
+    if(itemPtr) {
+        deleteNode(root, itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+// Task 6: Delete Entire List
+void deleteEntireBiCircularList(BiNode **root) {
+    if(root && *root) {
+        // Breaking the circle turns it into a bidirectional list
+        BiNode *firstPtr = *root;
+        firstPtr->prev->next = NULL;
+        firstPtr->prev = NULL;
+        *root = NULL;
+
+        deleteEntireBiList(&firstPtr);
+    }
+}
+
+void deleteEntireBiCircularListRecursively(BiNode **root) {
+    if(root && *root) {
+        BiNode *firstPtr = *root;
+        firstPtr->prev->next = NULL;
+        firstPtr->prev = NULL;
+        *root = NULL;
+
+        deleteEntireBiListRecursively(&firstPtr);
+    }
+}
+
+// Task 7: Getting List Length / BiNodes Count
+size_t getBiCircularNodesCount(BiNode *root) {
+    size_t count = 0;
+
+    if(root) {
+        BiNode *itemPtr = root;
+
+        do {
+            count += 1;
+            itemPtr = itemPtr->next;
+        } while(itemPtr != root);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Counts recursively the nodes starting from a given node up to the
+ *        last one.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t countFromNode(BiNode *node, BiNode *firstPtr) {
+    return 1 + (node->next != firstPtr ? countFromNode(node->next, firstPtr) : 0);
+}
+
+size_t getBiCircularNodesCountRecursively(BiNode *root) {
+    return root ? countFromNode(root, root) : 0;
+}
+
+// Task 8: Ordered Bidirectional Circular List
+bool addOrderedBiCircularNode(BiNode **root, int value) {
+    /**
+     * We assume the current list is ordered and duplicates are allowed. As in
+     * the ordered bidirectional list, the new node goes before the first node
+     * whose value is greater than or equal to the given one.
+     */
+    bool added = false;
+
+    if(root) {
+        if(!*root || (*root)->prev->value < value) {
+            // Becoming the last node in O(1)
+            added = insertNode(root, *root, value, false);
+        }
+        else {
+            // The last value is not smaller, so the loop stops before wrapping
+            BiNode *nextPtr = *root;
+
+            while(nextPtr->value < value) {
+                nextPtr = nextPtr->next;
+            }
+
+            added = insertNode(root, nextPtr, value, nextPtr == *root);
+        }
+    }
+
+    return added;
+}
+
+/**
+ * @brief Adds recursively a value in order before node or further.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addOrderedBeforeNode(BiNode **root, BiNode *node, int value) {
+    bool added;
+
+    if(node->value >= value) {
+        added = insertNode(root, node, value, node == *root);
+    }
+    else {
+        added = addOrderedBeforeNode(root, node->next, value);
+    }
+
+    return added;
+}
+
+bool addOrderedBiCircularNodeRecursively(BiNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        if(!*root || (*root)->prev->value < value) {
+            added = insertNode(root, *root, value, false);
+        }
+        else {
+            added = addOrderedBeforeNode(root, *root, value);
+        }
+    }
+
+    return added;
+}
+
+BiNode *findOrderedBiCircularNode(BiNode *root, int value) {
+    // We assume ordered bidirectional circular list
+    BiNode *itemPtr = NULL;
+
+    if(root && root->value <= value && root->prev->value >= value) {
+        // The last value is not smaller, so the loop stops before wrapping
+        BiNode *currentPtr = root;
+
+        while(currentPtr->value < value) {
+            currentPtr = currentPtr->next;
+        }
+
+        if(currentPtr->value == value) {
+            itemPtr = currentPtr;
+        }
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Finds recursively a value in order starting from a given node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static BiNode *findOrderedFromNode(BiNode *node, int value) {
+    BiNode *itemPtr = NULL;
+
+    if(node->value == value) {
+        itemPtr = node;
+    }
+    else if(node->value < value) {
+        itemPtr = findOrderedFromNode(node->next, value);
+    }
+
+    return itemPtr;
+}
+
+BiNode *findOrderedBiCircularNodeRecursively(BiNode *root, int value) {
+    BiNode *itemPtr = NULL;
+
+    if(root && root->value <= value && root->prev->value >= value) {
+        itemPtr = findOrderedFromNode(root, value);
+    }
+
+    return itemPtr;
+}
+
+bool deleteOrderedBiCircularNode(BiNode **root, int value) {
+    bool deleted = false;
+    BiNode *itemPtr = root ? findOrderedBiCircularNode(*root, value) : NULL;
+
+    if(itemPtr) {
+        deleteNode(root, itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+bool deleteOrderedBiCircularNodeRecursively(BiNode **root, int value) {
+    bool deleted = false;
+    BiNode *itemPtr = root ? findOrderedBiCircularNodeRecursively(*root, value)
+                           : NULL;
+
+    if(itemPtr) {
+        deleteNode(root, itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+// Task 9: Sorting
+void sortBiCircularList(BiNode **root) {
+    if(root && *root) {
+        (*root)->prev->next = NULL;
+        (*root)->prev = NULL;
+
+        sortBiList(root);
+
+        // The last node of the sorted nodes closes the circle
+        BiNode *lastPtr = *root;
+
+        while(lastPtr->next) {
+            lastPtr = lastPtr->next;
+        }
+
+        lastPtr->next = *root;
+        (*root)->prev = lastPtr;
+    }
+}
@@ -14,6 +14,7 @@
 
 #include "linked_list/bidirectional.h"
 #include "linked_list/common.h"
+#include "merge.h"
 
 // Task 1: Data Structure Declaration and Textual Description
 void displayBiList(BiNode *root) {
@@ -479,3 +480,517 @@ bool deleteOrderedBiNodeRecursively(BiNode **root, int value) {
 
     return deleted;
 }
+
+// Task 9: Sorting
+BiNode *internalMergeBiLists(BiNode *left, BiNode *right) {
+    BiNode *head = NULL, **tailPtr = &head;
+
+    while(left && right) {
+        if(left->value <= right->value) {
+            *tailPtr = left;
+            left = left->next;
+        }
+        else {
+            *tailPtr = right;
+            right = right->next;
+        }
+
+        tailPtr = &(*tailPtr)->next;
+    }
+
+    *tailPtr = left ? left : right;
+
+    return head;
+}
+
+void sortBiList(BiNode **root) {
+    if(root && *root) {
+        /**
+         * Bottom-up merge sort using a binary counter: runs[i] is either empty
+         * or holds a sorted run of 2^i nodes. Every node taken from the list
+         * is a run of 1 node that is merged with runs[0], runs[1], ... as long
+         * as they are occupied (like carrying when adding 1 to a binary
+         * number). Unlike merging runs of width 1, 2, 4, ... over the whole
+         * list, recently merged nodes are merged again while they are still
+         * in the cache. The array covers lists of up to 2^64 - 1 nodes.
+         */
+        BiNode *runs[64] = {NULL};
+        size_t numRuns = 0, i;
+        BiNode *itemPtr = *root;
+
+        while(itemPtr) {
+            BiNode *run = itemPtr;
+            itemPtr = itemPtr->next;
+            run->next = NULL;
+
+            // runs[i] holds older nodes, so it goes first (stable sort)
+            for(i = 0; i < numRuns && runs[i]; ++i) {
+                run = internalMergeBiLists(runs[i], run);
+                runs[i] = NULL;
+            }
+
+            runs[i] = run;
+
+            if(i == numRuns) {
+                numRuns += 1;
+            }
+        }
+
+        // Merging the remaining runs, from the most recent to the oldest
+        *root = NULL;
+
+        for(i = 0; i < numRuns; ++i) {
+            if(runs[i]) {
+                *root = internalMergeBiLists(runs[i], *root);
+            }
+        }
+
+        // The prev pointers are only fixed up once, after the last merge
+        BiNode *prevPtr = NULL;
+
+        for(itemPtr = *root; itemPtr; itemPtr = itemPtr->next) {
+            itemPtr->prev = prevPtr;
+            prevPtr = itemPtr;
+        }
+    }
+}
+
+// Task 10: Bulk Operations
+bool addOrderedBiNodes(BiNode **root,
+                       const int *values,
+                       size_t count,
+                       bool areSorted) {
+    bool added = root && (values || count == 0);
+    BiNode *batch = NULL, **batchTailPtr = &batch;
+
+    // Allocating all the new nodes first (in the given order)
+    for(size_t i = 0; added && i < count; ++i) {
+        *batchTailPtr = malloc(sizeof(BiNode));
+
+        if(*batchTailPtr) {
+            (*batchTailPtr)->value = values[i];
+            (*batchTailPtr)->next = NULL;
+            batchTailPtr = &(*batchTailPtr)->next;
+        }
+        else {
+            deleteEntireBiList(&batch);
+            added = false;
+        }
+    }
+
+    if(added) {
+        if(!areSorted) {
+            sortBiList(&batch);
+        }
+
+        /**
+         * Merging the batch into the list in one pass: the scan for the next
+         * new node resumes right after the previous one. As in
+         * addOrderedBiNode, a new node goes before the existing nodes that
+         * are equal to it.
+         */
+        BiNode **linkPtr = root, *prevPtr = NULL;
+
+        while(batch) {
+            while(*linkPtr && (*linkPtr)->value < batch->value) {
+                prevPtr = *linkPtr;
+                linkPtr = &(*linkPtr)->next;
+            }
+
+            BiNode *newItemPtr = batch;
+            batch = batch->next;
+
+            newItemPtr->prev = prevPtr;
+            newItemPtr->next = *linkPtr;
+
+            if(*linkPtr) {
+                (*linkPtr)->prev = newItemPtr;
+            }
+
+            *linkPtr = newItemPtr;
+            prevPtr = newItemPtr;
+            linkPtr = &newItemPtr->next;
+        }
+    }
+
+    return added;
+}
+
+size_t findOrderedBiNodes(BiNode *root,
+                          const int *keys,
+                          size_t count,
+                          BiNode **nodes) {
+    size_t numFound = 0;
+    BiNode *itemPtr = root;
+
+    for(size_t i = 0; keys && i < count; ++i) {
+        if(i > 0 && keys[i] < keys[i - 1]) {
+            // Unsorted keys: the key may be behind, so the scan restarts
+            itemPtr = root;
+        }
+
+        while(itemPtr && itemPtr->value < keys[i]) {
+            itemPtr = itemPtr->next;
+        }
+
+        // The scan does not go past a found node, as the next key may be equal
+        BiNode *foundPtr = itemPtr && itemPtr->value == keys[i] ? itemPtr : NULL;
+
+        if(nodes) {
+            nodes[i] = foundPtr;
+        }
+
+        if(foundPtr) {
+            numFound += 1;
+        }
+    }
+
+    return numFound;
+}
+
+// Task 11: Set Operations
+/**
+ * @brief The set operations combining two ordered lists.
+ */
+typedef enum SetOperation {
+    SET_UNION,
+    SET_INTERSECTION,
+    SET_DIFFERENCE
+} SetOperation;
+
+/**
+ * @brief Builds a new ordered list out of two ordered ones, according to the
+ *        given set operation, in a single O(n + m) pass.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored.
+ *
+ * @param operation The set operation to perform.
+ *
+ * @return True if the new list is built and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool combineOrderedBiLists(BiNode *first,
+                                  BiNode *second,
+                                  BiNode **result,
+                                  SetOperation operation) {
+    bool built = result != NULL;
+    BiNode *root = NULL, **tailPtr = &root, *lastPtr = NULL;
+
+    /**
+     * The loop stops as soon as no more values can make it to the result: for
+     * an intersection, when one of the lists is exhausted, and for a
+     * difference, when the first list is exhausted.
+     */
+    while(built &&
+          (operation == SET_UNION ? first || second :
+           operation == SET_INTERSECTION ? first && second : first != NULL)) {
+        // The smallest value not handled yet and the lists it belongs to
+        bool inFirst = first && (!second || first->value <= second->value);
+        bool inSecond = second && (!first || second->value <= first->value);
+        int value = inFirst ? first->value : second->value;
+
+        // Skipping the duplicates of value in both lists
+        while(first && first->value == value) {
+            first = first->next;
+        }
+
+        while(second && second->value == value) {
+            second = second->next;
+        }
+
+        if(operation == SET_UNION ||
+           (operation == SET_INTERSECTION && inFirst && inSecond) ||
+           (operation == SET_DIFFERENCE && inFirst && !inSecond)) {
+            *tailPtr = malloc(sizeof(BiNode));
+
+            if(*tailPtr) {
+                (*tailPtr)->value = value;
+                (*tailPtr)->next = NULL;
+                (*tailPtr)->prev = lastPtr;
+                lastPtr = *tailPtr;
+                tailPtr = &(*tailPtr)->next;
+            }
+            else {
+                deleteEntireBiList(&root);
+                built = false;
+            }
+        }
+    }
+
+    if(result) {
+        *result = root;
+    }
+
+    return built;
+}
+
+bool getOrderedBiListsUnion(BiNode *first,
+                            BiNode *second,
+                            BiNode **result) {
+    return combineOrderedBiLists(first, second, result, SET_UNION);
+}
+
+bool getOrderedBiListsIntersection(BiNode *first,
+                                   BiNode *second,
+                                   BiNode **result) {
+    return combineOrderedBiLists(first, second, result, SET_INTERSECTION);
+}
+
+bool getOrderedBiListsDifference(BiNode *first,
+                                 BiNode *second,
+                                 BiNode **result) {
+    return combineOrderedBiLists(first, second, result, SET_DIFFERENCE);
+}
+
+// Task 12: Finger Search
+/**
+ * @brief Walks from the finger to the first node whose value is not smaller
+ *        than the given one, forward or backward depending on the value of the
+ *        finger.
+ *
+ * @param root A pointer to the root node of the ordered bidirectional list.
+ *
+ * @param finger A pointer to a node of the list, or NULL to start at the root.
+ *
+ * @param value The searched value.
+ *
+ * @param prevPtr A pointer to where the node preceding the returned one is
+ *                stored (NULL if the returned node is the root).
+ *
+ * @return The first node not smaller than value, or NULL if there is none.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static BiNode *seekFromFinger(BiNode *root,
+                              BiNode *finger,
+                              int value,
+                              BiNode **prevPtr) {
+    BiNode *itemPtr = finger ? finger : root;
+
+    if(!itemPtr) {
+        *prevPtr = NULL;
+    }
+    else if(itemPtr->value < value) {
+        // Walking forward
+        while(itemPtr->next && itemPtr->next->value < value) {
+            itemPtr = itemPtr->next;
+        }
+
+        *prevPtr = itemPtr;
+        itemPtr = itemPtr->next;
+    }
+    else {
+        // Walking backward (the first occurrence is wanted)
+        while(itemPtr->prev && itemPtr->prev->value >= value) {
+            itemPtr = itemPtr->prev;
+        }
+
+        *prevPtr = itemPtr->prev;
+    }
+
+    return itemPtr;
+}
+
+BiNode *findOrderedBiNodeFromFinger(BiNode *root, BiNode **finger, int value) {
+    BiNode *itemPtr = NULL, *prevPtr, *nextPtr;
+
+    if(finger) {
+        nextPtr = seekFromFinger(root, *finger, value, &prevPtr);
+
+        if(nextPtr && nextPtr->value == value) {
+            itemPtr = nextPtr;
+        }
+
+        *finger = nextPtr ? nextPtr : prevPtr;
+    }
+
+    return itemPtr;
+}
+
+bool addOrderedBiNodeFromFinger(BiNode **root, BiNode **finger, int value) {
+    bool added = false;
+    BiNode *newItemPtr;
+
+    if(root && finger) {
+        newItemPtr = malloc(sizeof(BiNode));
+
+        if(newItemPtr) {
+            newItemPtr->value = value;
+            newItemPtr->next = seekFromFinger(*root,
+                                              *finger,
+                                              value,
+                                              &newItemPtr->prev);
+
+            if(newItemPtr->prev) {
+                newItemPtr->prev->next = newItemPtr;
+            }
+            else {
+                *root = newItemPtr;
+            }
+
+            if(newItemPtr->next) {
+                newItemPtr->next->prev = newItemPtr;
+            }
+
+            *finger = newItemPtr;
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool deleteOrderedBiNodeFromFinger(BiNode **root, BiNode **finger, int value) {
+    bool deleted = false;
+    BiNode *itemPtr, *prevPtr;
+
+    if(root && finger) {
+        itemPtr = seekFromFinger(*root, *finger, value, &prevPtr);
+
+        if(itemPtr && itemPtr->value == value) {
+            if(prevPtr) {
+                prevPtr->next = itemPtr->next;
+            }
+            else {
+                *root = itemPtr->next;
+            }
+
+            if(itemPtr->next) {
+                itemPtr->next->prev = prevPtr;
+            }
+
+            *finger = itemPtr->next ? itemPtr->next : prevPtr;
+            free(itemPtr);
+            deleted = true;
+        }
+        else {
+            *finger = itemPtr ? itemPtr : prevPtr;
+        }
+    }
+
+    return deleted;
+}
+
+// Task 13: Cursor
+bool initBiCursor(BiCursor *cursor, BiNode **root) {
+    bool initialized = false;
+
+    if(cursor && root) {
+        cursor->root = root;
+        cursor->prev = NULL;
+        cursor->node = *root;
+        initialized = true;
+    }
+
+    return initialized;
+}
+
+bool moveBiCursorNext(BiCursor *cursor) {
+    bool moved = false;
+
+    if(cursor && cursor->node) {
+        cursor->prev = cursor->node;
+        cursor->node = cursor->node->next;
+        moved = true;
+    }
+
+    return moved;
+}
+
+bool moveBiCursorPrev(BiCursor *cursor) {
+    bool moved = false;
+
+    if(cursor && cursor->prev) {
+        cursor->node = cursor->prev;
+        cursor->prev = cursor->prev->prev;
+        moved = true;
+    }
+
+    return moved;
+}
+
+bool addBiNodeBeforeCursor(BiCursor *cursor, int value) {
+    bool added = false;
+    BiNode *newItemPtr;
+
+    if(cursor) {
+        newItemPtr = malloc(sizeof(BiNode));
+
+        if(newItemPtr) {
+            newItemPtr->value = value;
+            newItemPtr->prev = cursor->prev;
+            newItemPtr->next = cursor->node;
+
+            if(cursor->prev) {
+                cursor->prev->next = newItemPtr;
+            }
+            else {
+                *cursor->root = newItemPtr;
+            }
+
+            if(cursor->node) {
+                cursor->node->prev = newItemPtr;
+            }
+
+            cursor->prev = newItemPtr;
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool addBiNodeAfterCursor(BiCursor *cursor, int value) {
+    bool added = false;
+    BiNode *newItemPtr;
+
+    if(cursor && cursor->node) {
+        newItemPtr = malloc(sizeof(BiNode));
+
+        if(newItemPtr) {
+            newItemPtr->value = value;
+            newItemPtr->prev = cursor->node;
+            newItemPtr->next = cursor->node->next;
+
+            if(cursor->node->next) {
+                cursor->node->next->prev = newItemPtr;
+            }
+
+            cursor->node->next = newItemPtr;
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool deleteBiNodeAtCursor(BiCursor *cursor) {
+    bool deleted = false;
+    BiNode *itemPtr;
+
+    if(cursor && cursor->node) {
+        itemPtr = cursor->node;
+        cursor->node = itemPtr->next;
+
+        if(cursor->prev) {
+            cursor->prev->next = cursor->node;
+        }
+        else {
+            *cursor->root = cursor->node;
+        }
+
+        if(cursor->node) {
+            cursor->node->prev = cursor->prev;
+        }
+
+        free(itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
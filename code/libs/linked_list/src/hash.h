@@ -0,0 +1,40 @@
+/**
+ * @file hash.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This internal file defines the hash function of integer values that
+ *        is shared between the hash tables and the swiss sets. It is not
+ *        installed with the public headers.
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Hashes a value, mixing all its bits so that close values end up in
+ *        far apart buckets or groups.
+ *
+ * @param value The value to be hashed.
+ *
+ * @return The hash of the value.
+ *
+ * @note The function is statically typed and inlined so that every file gets
+ *       its own copy of this single definition, keeping the hot hashing free
+ *       of calls across files.
+ */
+static inline uint32_t hashValue(int value) {
+    uint32_t hash = (uint32_t) value;
+
+    hash ^= hash >> 16;
+    hash *= 0x7feb352dU;
+    hash ^= hash >> 15;
+    hash *= 0x846ca68bU;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+#endif
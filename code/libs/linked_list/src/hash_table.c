@@ -0,0 +1,314 @@
+/**
+ * @file hash_table.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with chained hash tables whose buckets are unidirectional lists.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_list/common.h"
+#include "linked_list/hash_table.h"
+#include "hash.h"
+
+/**
+ * @brief Retrieves the chain of the given bucket, old buckets coming first.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static UniNode *getChain(HashTable *table, size_t index) {
+    return index < table->numOldBuckets
+           ? table->oldBuckets[index]
+           : table->buckets[index - table->numOldBuckets];
+}
+
+/**
+ * @brief Finds the link (bucket or next pointer) pointing to the node holding
+ *        the given value, searching the old buckets too during a resize.
+ *
+ * @return The found link or NULL if the value does not exist.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static UniNode **findLink(HashTable *table, int value) {
+    size_t hash = hashValue(value);
+    UniNode **linkPtr = NULL;
+
+    if(table->oldBuckets) {
+        linkPtr = &table->oldBuckets[hash & (table->numOldBuckets - 1)];
+
+        while(*linkPtr && (*linkPtr)->value != value) {
+            linkPtr = &(*linkPtr)->next;
+        }
+    }
+
+    if(!linkPtr || !*linkPtr) {
+        linkPtr = &table->buckets[hash & (table->numBuckets - 1)];
+
+        while(*linkPtr && (*linkPtr)->value != value) {
+            linkPtr = &(*linkPtr)->next;
+        }
+    }
+
+    return *linkPtr ? linkPtr : NULL;
+}
+
+/**
+ * @brief Links a node at the front of its (new) bucket.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void linkNode(HashTable *table, UniNode *node) {
+    UniNode **bucket = &table->buckets[hashValue(node->value) &
+                                       (table->numBuckets - 1)];
+
+    node->next = *bucket;
+    *bucket = node;
+}
+
+/**
+ * @brief Moves the chains of the next HASH_TABLE_MIGRATED_BUCKETS old buckets
+ *        to the new ones, and frees the old buckets once they are all moved.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void migrateBuckets(HashTable *table) {
+    for(size_t i = 0; table->oldBuckets && i < HASH_TABLE_MIGRATED_BUCKETS;
+        ++i) {
+        UniNode *itemPtr = table->oldBuckets[table->migrateIndex], *nextPtr;
+
+        table->oldBuckets[table->migrateIndex] = NULL;
+
+        while(itemPtr) {
+            nextPtr = itemPtr->next;
+            linkNode(table, itemPtr);
+            itemPtr = nextPtr;
+        }
+
+        if(++table->migrateIndex == table->numOldBuckets) {
+            free(table->oldBuckets);
+            table->oldBuckets = NULL;
+            table->numOldBuckets = 0;
+        }
+    }
+}
+
+/**
+ * @brief Starts a resize doubling the number of buckets if there are more
+ *        values than buckets (and no resize is in progress).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void growIfNeeded(HashTable *table) {
+    if(!table->oldBuckets && table->count > table->numBuckets) {
+        UniNode **buckets = calloc(2 * table->numBuckets, sizeof(UniNode *));
+
+        if(buckets) {
+            table->oldBuckets = table->buckets;
+            table->numOldBuckets = table->numBuckets;
+            table->migrateIndex = 0;
+            table->buckets = buckets;
+            table->numBuckets *= 2;
+        }
+    }
+}
+
+void displayHashTable(HashTable *table) {
+    size_t numDisplayed = 0;
+
+    printf("\n< ");
+
+    if(table) {
+        size_t numChains = table->numOldBuckets + table->numBuckets;
+
+        for(size_t i = 0; i < numChains; ++i) {
+            for(UniNode *itemPtr = getChain(table, i); itemPtr;
+                itemPtr = itemPtr->next) {
+                if(++numDisplayed < table->count) {
+                    printf("%d | ", itemPtr->value);
+                }
+                else {
+                    printf("%d ", itemPtr->value);
+                }
+            }
+        }
+    }
+
+    printf(">\n");
+}
+
+char *hashTableToString(HashTable *table) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len, numConverted = 0;
+
+    if(!table || table->count == 0) {
+        str = initialize("< >");
+    }
+    else {
+        size_t numChains = table->numOldBuckets + table->numBuckets;
+
+        tmp_str = initialize("");
+
+        for(size_t i = 0; i < numChains; ++i) {
+            for(UniNode *itemPtr = getChain(table, i); itemPtr;
+                itemPtr = itemPtr->next) {
+                const char *format = ++numConverted < table->count ? " %d |"
+                                                                   : " %d ";
+
+                len = snprintf(NULL, 0, format, itemPtr->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, format, itemPtr->value);
+
+                str = concatenate(tmp_str, item);
+                freeCharPtrs(2, tmp_str, item);
+                tmp_str = str;
+            }
+        }
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+bool addHashNode(HashTable **table, int value) {
+    bool added = false;
+    UniNode *newItemPtr;
+
+    if(table && !*table) {
+        // Creating the table upon the first addition
+        *table = malloc(sizeof(HashTable));
+
+        if(*table) {
+            (*table)->buckets = calloc(HASH_TABLE_INITIAL_BUCKETS,
+                                       sizeof(UniNode *));
+
+            if((*table)->buckets) {
+                (*table)->numBuckets = HASH_TABLE_INITIAL_BUCKETS;
+                (*table)->oldBuckets = NULL;
+                (*table)->numOldBuckets = 0;
+                (*table)->migrateIndex = 0;
+                (*table)->count = 0;
+            }
+            else {
+                free(*table);
+                *table = NULL;
+            }
+        }
+    }
+
+    if(table && *table) {
+        migrateBuckets(*table);
+
+        if(!findLink(*table, value)) {
+            newItemPtr = malloc(sizeof(UniNode));
+
+            if(newItemPtr) {
+                newItemPtr->value = value;
+                linkNode(*table, newItemPtr);
+                (*table)->count += 1;
+                growIfNeeded(*table);
+                added = true;
+            }
+        }
+    }
+
+    return added;
+}
+
+UniNode *findHashNode(HashTable *table, int value) {
+    UniNode *itemPtr = NULL, **linkPtr;
+
+    if(table) {
+        migrateBuckets(table);
+        linkPtr = findLink(table, value);
+
+        if(linkPtr) {
+            itemPtr = *linkPtr;
+        }
+    }
+
+    return itemPtr;
+}
+
+bool updateHashNode(HashTable *table, int value, int newValue) {
+    bool updated = false;
+    UniNode *itemPtr, **linkPtr;
+
+    if(table) {
+        migrateBuckets(table);
+        linkPtr = findLink(table, value);
+
+        if(linkPtr && value == newValue) {
+            updated = true;
+        }
+        else if(linkPtr && !findLink(table, newValue)) {
+            // Moving the node to the bucket of the new value
+            itemPtr = *linkPtr;
+            *linkPtr = itemPtr->next;
+            itemPtr->value = newValue;
+            linkNode(table, itemPtr);
+            updated = true;
+        }
+    }
+
+    return updated;
+}
+
+bool deleteHashNode(HashTable **table, int value) {
+    bool deleted = false;
+    UniNode *itemPtr, **linkPtr;
+
+    if(table && *table) {
+        migrateBuckets(*table);
+        linkPtr = findLink(*table, value);
+
+        if(linkPtr) {
+            itemPtr = *linkPtr;
+            *linkPtr = itemPtr->next;
+            free(itemPtr);
+            (*table)->count -= 1;
+            deleted = true;
+
+            // An empty table is freed, as NULL is the empty table
+            if((*table)->count == 0) {
+                deleteEntireHashTable(table);
+            }
+        }
+    }
+
+    return deleted;
+}
+
+void deleteEntireHashTable(HashTable **table) {
+    if(table && *table) {
+        for(size_t i = 0; i < (*table)->numOldBuckets; ++i) {
+            deleteEntireUniList(&(*table)->oldBuckets[i]);
+        }
+
+        for(size_t i = 0; i < (*table)->numBuckets; ++i) {
+            deleteEntireUniList(&(*table)->buckets[i]);
+        }
+
+        free((*table)->oldBuckets);
+        free((*table)->buckets);
+        free(*table);
+        *table = NULL;
+    }
+}
+
+size_t getHashNodesCount(HashTable *table) {
+    return table ? table->count : 0;
+}
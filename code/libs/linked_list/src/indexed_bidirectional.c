@@ -0,0 +1,321 @@
+/**
+ * @file indexed_bidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with ordered bidirectional lists having an express lane index.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "linked_list/indexed_bidirectional.h"
+
+/**
+ * @brief Counts the lanes whose value is smaller than the given one using a
+ *        binary search.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t countLanesBefore(const IndexedBiList *list, int value) {
+    size_t low = 0, high = list->numLanes;
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+
+        if(list->lanes[middle].value < value) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * @brief Inserts a lane at the given index, growing the lanes array if needed.
+ *
+ * @return True if the lane got inserted and false otherwise (allocation
+ *         failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool insertLane(IndexedBiList *list,
+                       size_t index,
+                       BiNode *node,
+                       size_t length) {
+    bool inserted = true;
+
+    if(list->numLanes == list->capacity) {
+        size_t capacity = list->capacity ? 2 * list->capacity : 4;
+        BiExpressLane *lanes = realloc(list->lanes,
+                                       capacity * sizeof(BiExpressLane));
+
+        if(lanes) {
+            list->lanes = lanes;
+            list->capacity = capacity;
+        }
+        else {
+            inserted = false;
+        }
+    }
+
+    if(inserted) {
+        memmove(&list->lanes[index + 1],
+                &list->lanes[index],
+                (list->numLanes - index) * sizeof(BiExpressLane));
+
+        list->lanes[index].value = node->value;
+        list->lanes[index].length = length;
+        list->lanes[index].node = node;
+        list->numLanes += 1;
+    }
+
+    return inserted;
+}
+
+/**
+ * @brief Removes the lane at the given index.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void removeLane(IndexedBiList *list, size_t index) {
+    list->numLanes -= 1;
+
+    memmove(&list->lanes[index],
+            &list->lanes[index + 1],
+            (list->numLanes - index) * sizeof(BiExpressLane));
+}
+
+/**
+ * @brief Splits the segment of the given lane in its middle if it reached
+ *        2 * stride nodes.
+ *
+ * @note The segment is left as it is if the new lane cannot be allocated,
+ *       which only slows down searches within it.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void splitLane(IndexedBiList *list, size_t index) {
+    if(list->lanes[index].length >= 2 * list->stride) {
+        BiNode *itemPtr = list->lanes[index].node;
+
+        for(size_t i = 0; i < list->stride; ++i) {
+            itemPtr = itemPtr->next;
+        }
+
+        if(insertLane(list,
+                      index + 1,
+                      itemPtr,
+                      list->lanes[index].length - list->stride)) {
+            list->lanes[index].length = list->stride;
+        }
+    }
+}
+
+/**
+ * @brief Merges the segments of the given lane and the next one if they fit
+ *        within stride nodes.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void mergeLanes(IndexedBiList *list, size_t index) {
+    if(index + 1 < list->numLanes &&
+       list->lanes[index].length + list->lanes[index + 1].length <=
+       list->stride) {
+        list->lanes[index].length += list->lanes[index + 1].length;
+        removeLane(list, index + 1);
+    }
+}
+
+bool initIndexedBiList(IndexedBiList *list, BiNode *root, size_t stride) {
+    bool initialized = false;
+
+    if(list && stride > 0) {
+        size_t count = getBiNodesCount(root);
+        size_t capacity = count / stride + 1;
+        BiExpressLane *lanes = malloc(capacity * sizeof(BiExpressLane));
+
+        if(lanes) {
+            list->root = root;
+            list->lanes = lanes;
+            list->numLanes = 0;
+            list->capacity = capacity;
+            list->stride = stride;
+            list->count = count;
+
+            // Sampling every stride-th node (the last segment may be shorter)
+            for(size_t i = 0; root; ++i, root = root->next) {
+                if(i % stride == 0) {
+                    size_t length = count - i < stride ? count - i : stride;
+                    insertLane(list, list->numLanes, root, length);
+                }
+            }
+
+            initialized = true;
+        }
+    }
+
+    return initialized;
+}
+
+bool addIndexedBiNode(IndexedBiList *list, int value) {
+    bool added = false;
+    BiNode *newItemPtr = list ? malloc(sizeof(BiNode)) : NULL;
+
+    if(newItemPtr) {
+        size_t index = countLanesBefore(list, value);
+
+        newItemPtr->value = value;
+
+        if(index == 0) {
+            // The new node comes first and becomes the sample of lane 0
+            newItemPtr->prev = NULL;
+            newItemPtr->next = list->root;
+
+            if(list->numLanes > 0) {
+                list->lanes[0].value = value;
+                list->lanes[0].length += 1;
+                list->lanes[0].node = newItemPtr;
+                added = true;
+            }
+            else {
+                added = insertLane(list, 0, newItemPtr, 1);
+            }
+        }
+        else {
+            /**
+             * The new node goes into the segment of the last lane whose sample
+             * is smaller, right before the first node that is not (which is at
+             * the latest the sample of the next lane).
+             */
+            index -= 1;
+
+            BiNode *prevPtr = list->lanes[index].node;
+
+            while(prevPtr->next && prevPtr->next->value < value) {
+                prevPtr = prevPtr->next;
+            }
+
+            newItemPtr->prev = prevPtr;
+            newItemPtr->next = prevPtr->next;
+            list->lanes[index].length += 1;
+            added = true;
+        }
+
+        if(added) {
+            // Linking the new node
+            if(newItemPtr->prev) {
+                newItemPtr->prev->next = newItemPtr;
+            }
+            else {
+                list->root = newItemPtr;
+            }
+
+            if(newItemPtr->next) {
+                newItemPtr->next->prev = newItemPtr;
+            }
+
+            list->count += 1;
+            splitLane(list, index);
+        }
+        else {
+            free(newItemPtr);
+        }
+    }
+
+    return added;
+}
+
+BiNode *findIndexedBiNode(const IndexedBiList *list, int value) {
+    BiNode *itemPtr = NULL;
+
+    if(list) {
+        size_t index = countLanesBefore(list, value);
+
+        // The scan stops at the latest at the sample of the next lane
+        itemPtr = findOrderedBiNode(index ? list->lanes[index - 1].node
+                                          : list->root,
+                                    value);
+    }
+
+    return itemPtr;
+}
+
+bool deleteIndexedBiNode(IndexedBiList *list, int value) {
+    bool deleted = false;
+
+    if(list && list->root) {
+        size_t index = countLanesBefore(list, value);
+        size_t offset = 0;
+        BiNode *itemPtr = index ? list->lanes[--index].node : list->root;
+
+        while(itemPtr && itemPtr->value < value) {
+            itemPtr = itemPtr->next;
+            offset += 1;
+        }
+
+        if(itemPtr && itemPtr->value == value) {
+            if(offset == list->lanes[index].length) {
+                // The node is the sample of the next lane
+                index += 1;
+                offset = 0;
+            }
+
+            // Unlinking the node
+            if(itemPtr->prev) {
+                itemPtr->prev->next = itemPtr->next;
+            }
+            else {
+                list->root = itemPtr->next;
+            }
+
+            if(itemPtr->next) {
+                itemPtr->next->prev = itemPtr->prev;
+            }
+
+            list->lanes[index].length -= 1;
+
+            if(offset == 0 && list->lanes[index].length > 0) {
+                // The next node of the segment becomes the sample
+                list->lanes[index].node = itemPtr->next;
+                list->lanes[index].value = itemPtr->next->value;
+            }
+            else if(offset == 0) {
+                removeLane(list, index);
+            }
+
+            // Merging short neighbouring segments
+            mergeLanes(list, index);
+
+            if(index > 0) {
+                mergeLanes(list, index - 1);
+            }
+
+            free(itemPtr);
+            list->count -= 1;
+            deleted = true;
+        }
+    }
+
+    return deleted;
+}
+
+void deleteEntireIndexedBiList(IndexedBiList *list) {
+    if(list) {
+        deleteEntireBiList(&list->root);
+        free(list->lanes);
+
+        list->lanes = NULL;
+        list->numLanes = 0;
+        list->capacity = 0;
+        list->count = 0;
+    }
+}
+
+size_t getIndexedBiNodesCount(const IndexedBiList *list) {
+    return list ? list->count : 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file k_way_merge.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions merging many
+ *        ordered unidirectional or bidirectional lists into a single one.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "linked_list/k_way_merge.h"
+#include "merge.h"
+
+/**
+ * @struct HeapEntry
+ *
+ * @brief An entry of the k-way merge heap: the value of the first node of an
+ *        ordered list and the index of that list.
+ */
+typedef struct HeapEntry {
+    int value;
+    size_t list;
+} HeapEntry;
+
+/**
+ * @brief Tells if the first heap entry comes before the second one. Ties are
+ *        broken by list index, which keeps the merge stable.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool isBefore(const HeapEntry *first, const HeapEntry *second) {
+    return first->value < second->value ||
+           (first->value == second->value && first->list < second->list);
+}
+
+/**
+ * @brief Moves the entry at the given index down the min-heap until both its
+ *        children come after it.
+ *
+ * @param heap The heap entries.
+ *
+ * @param size The number of entries in the heap.
+ *
+ * @param index The index of the entry to move down.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void siftDown(HeapEntry *heap, size_t size, size_t index) {
+    HeapEntry entry = heap[index];
+    bool done = false;
+
+    while(!done) {
+        size_t child = 2 * index + 1;
+
+        if(child + 1 < size && isBefore(&heap[child + 1], &heap[child])) {
+            child += 1;
+        }
+
+        if(child < size && isBefore(&heap[child], &entry)) {
+            heap[index] = heap[child];
+            index = child;
+        }
+        else {
+            done = true;
+        }
+    }
+
+    heap[index] = entry;
+}
+
+/**
+ * @brief Arranges the given entries into a min-heap in O(size).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void buildHeap(HeapEntry *heap, size_t size) {
+    for(size_t i = size / 2; i > 0; --i) {
+        siftDown(heap, size, i - 1);
+    }
+}
+
+void mergeOrderedUniLists(UniNode **lists, size_t numLists, UniNode **root) {
+    if(root && (lists || numLists == 0)) {
+        HeapEntry *heap = numLists > 1 ? malloc(numLists * sizeof(HeapEntry))
+                                       : NULL;
+
+        if(!heap) {
+            // Single list (or allocation failure): merging in balanced rounds
+            for(size_t step = 1; step < numLists; step *= 2) {
+                for(size_t i = 0; i + step < numLists; i += 2 * step) {
+                    lists[i] = internalMergeUniLists(lists[i], lists[i + step]);
+                    lists[i + step] = NULL;
+                }
+            }
+
+            *root = numLists ? lists[0] : NULL;
+
+            if(numLists) {
+                lists[0] = NULL;
+            }
+        }
+        else {
+            // Only the non-empty lists enter the heap
+            size_t heapSize = 0;
+            UniNode **tailPtr = root;
+
+            for(size_t l = 0; l < numLists; ++l) {
+                if(lists[l]) {
+                    heap[heapSize].value = lists[l]->value;
+                    heap[heapSize].list = l;
+                    heapSize += 1;
+                }
+            }
+
+            buildHeap(heap, heapSize);
+
+            while(heapSize > 1) {
+                size_t l = heap[0].list;
+
+                *tailPtr = lists[l];
+                tailPtr = &lists[l]->next;
+                lists[l] = lists[l]->next;
+
+                if(lists[l]) {
+                    heap[0].value = lists[l]->value;
+                }
+                else {
+                    // The list is exhausted
+                    heap[0] = heap[--heapSize];
+                }
+
+                siftDown(heap, heapSize, 0);
+            }
+
+            // The rest of the last list is already ordered
+            *tailPtr = heapSize ? lists[heap[0].list] : NULL;
+
+            if(heapSize) {
+                lists[heap[0].list] = NULL;
+            }
+        }
+
+        free(heap);
+    }
+}
+
+void mergeOrderedBiLists(BiNode **lists, size_t numLists, BiNode **root) {
+    if(root && (lists || numLists == 0)) {
+        HeapEntry *heap = numLists > 1 ? malloc(numLists * sizeof(HeapEntry))
+                                       : NULL;
+
+        if(!heap) {
+            // Single list (or allocation failure): merging in balanced rounds
+            for(size_t step = 1; step < numLists; step *= 2) {
+                for(size_t i = 0; i + step < numLists; i += 2 * step) {
+                    lists[i] = internalMergeBiLists(lists[i], lists[i + step]);
+                    lists[i + step] = NULL;
+                }
+            }
+
+            *root = numLists ? lists[0] : NULL;
+
+            if(numLists) {
+                lists[0] = NULL;
+            }
+
+            // Fixing the prev pointers in a final pass
+            BiNode *lastPtr = NULL;
+
+            for(BiNode *itemPtr = *root; itemPtr; itemPtr = itemPtr->next) {
+                itemPtr->prev = lastPtr;
+                lastPtr = itemPtr;
+            }
+        }
+        else {
+            // Only the non-empty lists enter the heap
+            size_t heapSize = 0;
+            BiNode **tailPtr = root, *lastPtr = NULL;
+
+            for(size_t l = 0; l < numLists; ++l) {
+                if(lists[l]) {
+                    heap[heapSize].value = lists[l]->value;
+                    heap[heapSize].list = l;
+                    heapSize += 1;
+                }
+            }
+
+            buildHeap(heap, heapSize);
+
+            while(heapSize > 1) {
+                size_t l = heap[0].list;
+
+                *tailPtr = lists[l];
+                lists[l]->prev = lastPtr;
+                lastPtr = lists[l];
+                tailPtr = &lists[l]->next;
+                lists[l] = lists[l]->next;
+
+                if(lists[l]) {
+                    heap[0].value = lists[l]->value;
+                }
+                else {
+                    // The list is exhausted
+                    heap[0] = heap[--heapSize];
+                }
+
+                siftDown(heap, heapSize, 0);
+            }
+
+            // The rest of the last list is already ordered (and linked back)
+            *tailPtr = heapSize ? lists[heap[0].list] : NULL;
+
+            if(heapSize) {
+                (*tailPtr)->prev = lastPtr;
+                lists[heap[0].list] = NULL;
+            }
+        }
+
+        free(heap);
+    }
+}
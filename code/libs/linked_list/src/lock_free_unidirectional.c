@@ -0,0 +1,320 @@
+/**
+ * @file lock_free_unidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with lock-free ordered unidirectional linked lists.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_list/common.h"
+#include "linked_list/lock_free_unidirectional.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def MARK_BIT
+ *
+ * @brief The lowest bit of a next pointer telling that the node owning it is
+ *        deleted.
+ */
+#define MARK_BIT ((uintptr_t) 1)
+
+/**
+ * @brief Retrieves the node out of a (possibly marked) next pointer.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static LockFreeUniNode *getNode(uintptr_t link) {
+    return (LockFreeUniNode *) (link & ~MARK_BIT);
+}
+
+/**
+ * @brief Tells if a next pointer is marked.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool isMarked(uintptr_t link) {
+    return (link & MARK_BIT) != 0;
+}
+
+/**
+ * @brief Retires a node unlinked by the calling thread. If it cannot be
+ *        retired (allocation failure), it is added to the retired list.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void retire(LockFreeUniList *list, LockFreeUniNode *node) {
+    if(!retireEBRPointer(node, free)) {
+        LockFreeUniNode *head = atomic_load(&list->retired);
+
+        do {
+            node->nextRetired = head;
+        } while(!atomic_compare_exchange_weak(&list->retired, &head, node));
+    }
+}
+
+/**
+ * @brief Searches for the first unmarked node whose value is greater than or
+ *        equal to the given one, unlinking the marked nodes found on the way.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to search for.
+ *
+ * @param[out] predPtr Pointer to the variable storing the node before.
+ *
+ * @param[out] currPtr Pointer to the variable storing the node found (NULL if
+ *                     all values are smaller).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void search(LockFreeUniList *list,
+                   int value,
+                   LockFreeUniNode **predPtr,
+                   LockFreeUniNode **currPtr) {
+    bool retry = true;
+
+    while(retry) {
+        LockFreeUniNode *pred = &list->head;
+        LockFreeUniNode *curr = getNode(atomic_load(&pred->next));
+        bool advancing = true;
+        retry = false;
+
+        while(curr && advancing && !retry) {
+            uintptr_t succLink = atomic_load(&curr->next);
+
+            if(isMarked(succLink)) {
+                uintptr_t expected = (uintptr_t) curr;
+
+                // Restarting if pred got deleted or changed meanwhile
+                if(atomic_compare_exchange_strong(&pred->next,
+                                                  &expected,
+                                                  succLink & ~MARK_BIT)) {
+                    retire(list, curr);
+                    curr = getNode(succLink);
+                }
+                else {
+                    retry = true;
+                }
+            }
+            else if(curr->value < value) {
+                pred = curr;
+                curr = getNode(succLink);
+            }
+            else {
+                advancing = false;
+            }
+        }
+
+        *predPtr = pred;
+        *currPtr = curr;
+    }
+}
+
+void initLockFreeUniList(LockFreeUniList *list) {
+    if(list) {
+        list->head.value = 0;
+        atomic_init(&list->head.next, 0);
+        list->head.nextRetired = NULL;
+        atomic_init(&list->retired, NULL);
+        atomic_init(&list->count, 0);
+    }
+}
+
+void displayLockFreeUniList(LockFreeUniList *list) {
+    printf("\n< ");
+
+    if(list && enterEBRCriticalSection()) {
+        bool first = true;
+        LockFreeUniNode *node = getNode(atomic_load(&list->head.next));
+
+        while(node) {
+            uintptr_t link = atomic_load(&node->next);
+
+            if(!isMarked(link)) {
+                printf(first ? "%d " : "| %d ", node->value);
+                first = false;
+            }
+
+            node = getNode(link);
+        }
+
+        exitEBRCriticalSection();
+    }
+
+    printf(">\n");
+}
+
+char *lockFreeUniListToString(LockFreeUniList *list) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = initialize("<"), *tmp_str, *item;
+    size_t len;
+
+    if(list && enterEBRCriticalSection()) {
+        bool first = true;
+        LockFreeUniNode *node = getNode(atomic_load(&list->head.next));
+
+        while(node) {
+            uintptr_t link = atomic_load(&node->next);
+
+            if(!isMarked(link)) {
+                len = snprintf(NULL, 0, first ? " %d" : " | %d", node->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, first ? " %d" : " | %d", node->value);
+
+                tmp_str = str;
+                str = concatenate(tmp_str, item);
+                freeCharPtrs(2, tmp_str, item);
+                first = false;
+            }
+
+            node = getNode(link);
+        }
+
+        exitEBRCriticalSection();
+    }
+
+    tmp_str = str;
+    str = concatenate(tmp_str, " >");
+    free(tmp_str);
+
+    return str;
+}
+
+bool addOrderedLockFreeUniNode(LockFreeUniList *list, int value) {
+    bool added = false;
+    bool entered = list && enterEBRCriticalSection();
+    LockFreeUniNode *newNode = entered ? malloc(sizeof(LockFreeUniNode)) : NULL;
+
+    if(newNode) {
+        newNode->value = value;
+        newNode->nextRetired = NULL;
+
+        /**
+         * Counting before linking avoids a transient negative count in case
+         * another thread deletes the node right away.
+         */
+        atomic_fetch_add(&list->count, 1);
+
+        while(!added) {
+            LockFreeUniNode *pred, *curr;
+            search(list, value, &pred, &curr);
+
+            // The node is not published yet, so a plain store is enough
+            atomic_store_explicit(&newNode->next,
+                                  (uintptr_t) curr,
+                                  memory_order_relaxed);
+
+            uintptr_t expected = (uintptr_t) curr;
+            added = atomic_compare_exchange_strong(&pred->next,
+                                                   &expected,
+                                                   (uintptr_t) newNode);
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return added;
+}
+
+bool findOrderedLockFreeUniNode(LockFreeUniList *list, int value) {
+    bool found = false;
+
+    if(list && enterEBRCriticalSection()) {
+        // Wait-free: marked nodes are passed through instead of unlinked
+        LockFreeUniNode *node = getNode(atomic_load(&list->head.next));
+
+        while(node && node->value <= value && !found) {
+            uintptr_t link = atomic_load(&node->next);
+
+            found = node->value == value && !isMarked(link);
+            node = getNode(link);
+        }
+
+        exitEBRCriticalSection();
+    }
+
+    return found;
+}
+
+bool deleteOrderedLockFreeUniNode(LockFreeUniList *list, int value) {
+    bool deleted = false;
+    bool entered = list && enterEBRCriticalSection();
+    bool done = !entered;
+
+    while(!done) {
+        LockFreeUniNode *pred, *curr;
+        search(list, value, &pred, &curr);
+
+        if(!curr || curr->value != value) {
+            // Not found
+            done = true;
+        }
+        else {
+            uintptr_t link = atomic_load(&curr->next);
+
+            /**
+             * Marking logically deletes the node. It fails if the node got
+             * marked by another thread (then another duplicate is looked for)
+             * or got a new successor (then it is tried again).
+             */
+            if(!isMarked(link) &&
+               atomic_compare_exchange_strong(&curr->next,
+                                              &link,
+                                              link | MARK_BIT)) {
+                uintptr_t expected = (uintptr_t) curr;
+
+                // Unlinking it right away or letting a search do it
+                if(atomic_compare_exchange_strong(&pred->next, &expected, link)) {
+                    retire(list, curr);
+                }
+                else {
+                    search(list, value, &pred, &curr);
+                }
+
+                atomic_fetch_sub(&list->count, 1);
+                deleted = done = true;
+            }
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return deleted;
+}
+
+void deleteEntireLockFreeUniList(LockFreeUniList *list) {
+    if(list) {
+        LockFreeUniNode *node = getNode(atomic_load(&list->head.next));
+
+        while(node) {
+            LockFreeUniNode *next = getNode(atomic_load(&node->next));
+            free(node);
+            node = next;
+        }
+
+        node = atomic_load(&list->retired);
+
+        while(node) {
+            LockFreeUniNode *next = node->nextRetired;
+            free(node);
+            node = next;
+        }
+
+        initLockFreeUniList(list);
+    }
+}
+
+size_t getLockFreeUniNodesCount(LockFreeUniList *list) {
+    return list ? atomic_load(&list->count) : 0;
+}
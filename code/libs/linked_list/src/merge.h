@@ -0,0 +1,56 @@
+/**
+ * @file merge.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This internal file declares the two-way mergers of ordered lists that
+ *        are shared between the sorting and the k-way merge functions. It is
+ *        not installed with the public headers.
+ */
+
+#ifndef MERGE_H
+#define MERGE_H
+
+#include "linked_list/unidirectional.h"
+#include "linked_list/bidirectional.h"
+
+/**
+ * REMARK:
+ *
+ * These functions are only meant to be called from within the library. Their
+ * names carry the internal prefix and, where the compiler supports it, they
+ * are hidden from the symbols exported by the shared library.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+    #define INTERNAL_FUNCTION __attribute__((visibility("hidden")))
+#else
+    #define INTERNAL_FUNCTION
+#endif
+
+/**
+ * @brief Merges two ordered unidirectional lists (their last nodes point to
+ *        NULL). Equal values of left come first, which keeps merges stable.
+ *
+ * @param left The first node of the first ordered list.
+ *
+ * @param right The first node of the second ordered list.
+ *
+ * @return The first node of the merged list.
+ */
+INTERNAL_FUNCTION UniNode *internalMergeUniLists(UniNode *left,
+                                                 UniNode *right);
+
+/**
+ * @brief Merges two ordered bidirectional lists (their last nodes point to
+ *        NULL). Equal values of left come first, which keeps merges stable.
+ *
+ * @param left The first node of the first ordered list.
+ *
+ * @param right The first node of the second ordered list.
+ *
+ * @return The first node of the merged list, whose prev pointers are NOT
+ *         fixed.
+ */
+INTERNAL_FUNCTION BiNode *internalMergeBiLists(BiNode *left, BiNode *right);
+
+#endif
@@ -0,0 +1,526 @@
+/**
+ * @file packed_array.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with packed memory arrays.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linked_list/common.h"
+#include "linked_list/packed_array.h"
+
+/**
+ * REMARK:
+ *
+ * The density bounds of a window at the given level of the implicit tree
+ * (zero for a segment and height for the whole array) are interpolated
+ * linearly between the ones of a segment and the ones of the whole array:
+ *
+ *   upper = 1 - (1 / 4) * level / height
+ *   lower = 1 / 8 + (1 / 8) * level / height
+ *
+ * They are compared in integers, after multiplying both sides by 8 * height.
+ */
+
+/**
+ * @brief Retrieves the height of the implicit tree of numSegments segments
+ *        (a power of two).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t getHeight(size_t numSegments) {
+    size_t height = 0;
+
+    while(((size_t) 1 << height) < numSegments) {
+        height += 1;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Retrieves the index of the first of count sorted values that is not
+ *        less than the given value (count if there is none).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t findLowerBound(const int *values, size_t count, int value) {
+    size_t begin = 0, end = count;
+
+    while(begin < end) {
+        size_t middle = begin + (end - begin) / 2;
+
+        if(values[middle] < value) {
+            begin = middle + 1;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief Finds the last segment whose first value is less than the given
+ *        value (the first segment if there is none). As segments are never
+ *        empty, the values before the given one are all in this segment or in
+ *        the previous ones.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t findSegment(const PackedArray *array, int value) {
+    size_t begin = 0, end = array->numSegments;
+
+    while(end - begin > 1) {
+        size_t middle = begin + (end - begin) / 2;
+
+        if(array->values[middle * PACKED_ARRAY_SEGMENT_SIZE] < value) {
+            begin = middle;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief Finds the position of the first value that is not less than the
+ *        given one.
+ *
+ * @param[out] segmentPtr Pointer to the variable that will store the segment
+ *                        of the position.
+ *
+ * @return The index of the position within its segment (the number of values
+ *         of the segment if all the values are less than the given one).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t findPosition(const PackedArray *array,
+                           int value,
+                           size_t *segmentPtr) {
+    size_t segment = findSegment(array, value);
+    size_t index = findLowerBound(&array->values[segment *
+                                                 PACKED_ARRAY_SEGMENT_SIZE],
+                                  array->counts[segment],
+                                  value);
+
+    // The position is then the beginning of the next segment
+    if(index == array->counts[segment] &&
+       segment + 1 < array->numSegments) {
+        segment += 1;
+        index = 0;
+    }
+
+    *segmentPtr = segment;
+
+    return index;
+}
+
+/**
+ * @brief Inserts a value among count sorted values, shifting the greater ones
+ *        (the room for one more value is assumed).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void insertSorted(int *values, size_t count, int value) {
+    size_t index = findLowerBound(values, count, value);
+
+    memmove(&values[index + 1], &values[index], (count - index) * sizeof(int));
+    values[index] = value;
+}
+
+/**
+ * @brief Retrieves the number of values of a window of segments.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t countWindow(const PackedArray *array,
+                          size_t first,
+                          size_t numSegments) {
+    size_t count = 0;
+
+    for(size_t i = first; i < first + numSegments; ++i) {
+        count += array->counts[i];
+    }
+
+    return count;
+}
+
+/**
+ * @brief Moves the values of a window of segments to the beginning of the
+ *        window, one after the other (the segment counts are left as is).
+ *
+ * @return The number of values of the window.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t packWindow(PackedArray *array, size_t first, size_t numSegments) {
+    int *window = &array->values[first * PACKED_ARRAY_SEGMENT_SIZE];
+    size_t count = 0;
+
+    // Values only move to the left, so none is overwritten before being moved
+    for(size_t i = first; i < first + numSegments; ++i) {
+        memmove(&window[count],
+                &array->values[i * PACKED_ARRAY_SEGMENT_SIZE],
+                array->counts[i] * sizeof(int));
+        count += array->counts[i];
+    }
+
+    return count;
+}
+
+/**
+ * @brief Spreads count values packed at the beginning of a window evenly over
+ *        its segments.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void spreadWindow(PackedArray *array,
+                         size_t first,
+                         size_t numSegments,
+                         size_t count) {
+    int *window = &array->values[first * PACKED_ARRAY_SEGMENT_SIZE];
+    size_t end = count;
+
+    /**
+     * Segments are filled from the last one, as their values only move to
+     * the right, so none is overwritten before being moved.
+     */
+    for(size_t i = numSegments; i > 0; --i) {
+        size_t segmentCount = count / numSegments +
+                              (i - 1 < count % numSegments);
+
+        end -= segmentCount;
+        memmove(&window[(i - 1) * PACKED_ARRAY_SEGMENT_SIZE],
+                &window[end],
+                segmentCount * sizeof(int));
+        array->counts[first + i - 1] = segmentCount;
+    }
+}
+
+/**
+ * @brief Spreads the values of the whole array (along with the given value
+ *        unless NULL) evenly over numSegments segments.
+ *
+ * @return True if the array got resized and false otherwise (allocation
+ *         failure while growing, in which case the array is left unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool resize(PackedArray *array, size_t numSegments, const int *value) {
+    size_t oldNumSegments = array->numSegments;
+    bool resized = true;
+
+    if(numSegments > oldNumSegments) {
+        int *values = realloc(array->values, numSegments *
+                                             PACKED_ARRAY_SEGMENT_SIZE *
+                                             sizeof(int));
+        size_t *counts = NULL;
+
+        if(values) {
+            array->values = values;
+            counts = realloc(array->counts, numSegments * sizeof(size_t));
+        }
+
+        if(counts) {
+            array->counts = counts;
+        }
+
+        resized = counts != NULL;
+    }
+
+    if(resized) {
+        size_t count = packWindow(array, 0, oldNumSegments);
+
+        if(value) {
+            insertSorted(array->values, count, *value);
+            count += 1;
+        }
+
+        array->numSegments = numSegments;
+        spreadWindow(array, 0, numSegments, count);
+
+        /**
+         * Shrinking the memory is only attempted, as the extra slots can stay
+         * unused if it fails.
+         */
+        if(numSegments < oldNumSegments) {
+            int *values = realloc(array->values, numSegments *
+                                                 PACKED_ARRAY_SEGMENT_SIZE *
+                                                 sizeof(int));
+            size_t *counts = realloc(array->counts,
+                                     numSegments * sizeof(size_t));
+
+            if(values) {
+                array->values = values;
+            }
+
+            if(counts) {
+                array->counts = counts;
+            }
+        }
+    }
+
+    return resized;
+}
+
+bool initPackedArray(PackedArray *array) {
+    bool initialized = false;
+
+    if(array) {
+        array->values = malloc(PACKED_ARRAY_SEGMENT_SIZE * sizeof(int));
+        array->counts = calloc(1, sizeof(size_t));
+        array->numSegments = 1;
+        array->count = 0;
+
+        initialized = array->values && array->counts;
+
+        if(!initialized) {
+            deleteEntirePackedArray(array);
+        }
+    }
+
+    return initialized;
+}
+
+void displayPackedArray(PackedArray *array) {
+    size_t numDisplayed = 0;
+
+    printf("\n< ");
+
+    for(size_t i = 0; array && array->values && i < array->numSegments; ++i) {
+        const int *values = &array->values[i * PACKED_ARRAY_SEGMENT_SIZE];
+
+        for(size_t j = 0; j < array->counts[i]; ++j) {
+            if(++numDisplayed < array->count) {
+                printf("%d | ", values[j]);
+            }
+            else {
+                printf("%d ", values[j]);
+            }
+        }
+    }
+
+    printf(">\n");
+}
+
+char *packedArrayToString(PackedArray *array) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len, numConverted = 0;
+
+    if(!array || array->count == 0) {
+        str = initialize("< >");
+    }
+    else {
+        tmp_str = initialize("");
+
+        for(size_t i = 0; i < array->numSegments; ++i) {
+            const int *values = &array->values[i * PACKED_ARRAY_SEGMENT_SIZE];
+
+            for(size_t j = 0; j < array->counts[i]; ++j) {
+                const char *format = ++numConverted < array->count ? " %d |"
+                                                                   : " %d ";
+
+                len = snprintf(NULL, 0, format, values[j]);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, format, values[j]);
+
+                str = concatenate(tmp_str, item);
+                freeCharPtrs(2, tmp_str, item);
+                tmp_str = str;
+            }
+        }
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+bool addOrderedPackedValue(PackedArray *array, int value) {
+    bool added = false;
+
+    if(array && array->values) {
+        size_t segment = findSegment(array, value);
+
+        if(array->counts[segment] < PACKED_ARRAY_SEGMENT_SIZE) {
+            insertSorted(&array->values[segment * PACKED_ARRAY_SEGMENT_SIZE],
+                         array->counts[segment],
+                         value);
+            array->counts[segment] += 1;
+            added = true;
+        }
+        else {
+            // Looking for the smallest enclosing window taking one more value
+            size_t height = getHeight(array->numSegments);
+            size_t first = segment, numSegments = 1;
+            size_t count = PACKED_ARRAY_SEGMENT_SIZE;
+
+            for(size_t level = 1; !added && level <= height; ++level) {
+                count += countWindow(array, first ^ numSegments, numSegments);
+                first &= ~numSegments;
+                numSegments *= 2;
+
+                if(4 * height * (count + 1) <=
+                   (4 * height - level) * numSegments *
+                   PACKED_ARRAY_SEGMENT_SIZE) {
+                    size_t packed = packWindow(array, first, numSegments);
+
+                    insertSorted(&array->values[first *
+                                                PACKED_ARRAY_SEGMENT_SIZE],
+                                 packed,
+                                 value);
+                    spreadWindow(array, first, numSegments, packed + 1);
+                    added = true;
+                }
+            }
+
+            // Even the whole array is too dense
+            if(!added) {
+                added = resize(array, 2 * array->numSegments, &value);
+            }
+        }
+
+        array->count += added;
+    }
+
+    return added;
+}
+
+bool findOrderedPackedValue(PackedArray *array, int value) {
+    bool found = false;
+
+    if(array && array->values) {
+        size_t segment;
+        size_t index = findPosition(array, value, &segment);
+
+        found = index < array->counts[segment] &&
+                array->values[segment * PACKED_ARRAY_SEGMENT_SIZE + index] ==
+                value;
+    }
+
+    return found;
+}
+
+bool deleteOrderedPackedValue(PackedArray *array, int value) {
+    bool deleted = false;
+
+    if(array && array->values) {
+        size_t segment;
+        size_t index = findPosition(array, value, &segment);
+        int *values = &array->values[segment * PACKED_ARRAY_SEGMENT_SIZE];
+        size_t count = array->counts[segment];
+
+        if(index < count && values[index] == value) {
+            memmove(&values[index],
+                    &values[index + 1],
+                    (count - index - 1) * sizeof(int));
+            array->counts[segment] -= 1;
+            array->count -= 1;
+            deleted = true;
+
+            // A single segment has no lower bound, so that it can get empty
+            if(array->numSegments > 1 &&
+               8 * array->counts[segment] < PACKED_ARRAY_SEGMENT_SIZE) {
+                // Looking for the smallest enclosing window dense enough
+                size_t height = getHeight(array->numSegments);
+                size_t first = segment, numSegments = 1;
+                bool balanced = false;
+
+                count = array->counts[segment];
+
+                for(size_t level = 1; !balanced && level <= height; ++level) {
+                    count += countWindow(array,
+                                         first ^ numSegments,
+                                         numSegments);
+                    first &= ~numSegments;
+                    numSegments *= 2;
+
+                    if(8 * height * count >=
+                       (height + level) * numSegments *
+                       PACKED_ARRAY_SEGMENT_SIZE) {
+                        spreadWindow(array,
+                                     first,
+                                     numSegments,
+                                     packWindow(array, first, numSegments));
+                        balanced = true;
+                    }
+                }
+
+                // Even the whole array is too sparse (halving never fails)
+                if(!balanced) {
+                    resize(array, array->numSegments / 2, NULL);
+                }
+            }
+        }
+    }
+
+    return deleted;
+}
+
+void deleteEntirePackedArray(PackedArray *array) {
+    if(array) {
+        free(array->values);
+        free(array->counts);
+
+        array->values = NULL;
+        array->counts = NULL;
+        array->numSegments = 0;
+        array->count = 0;
+    }
+}
+
+size_t getPackedValuesCount(PackedArray *array) {
+    return array ? array->count : 0;
+}
+
+size_t getOrderedPackedRange(PackedArray *array,
+                             int minValue,
+                             int maxValue,
+                             int *values,
+                             size_t maxValues) {
+    size_t numCopied = 0;
+
+    if(array && array->values && values && minValue <= maxValue) {
+        size_t segment;
+        size_t index = findPosition(array, minValue, &segment);
+        bool done = maxValues == 0;
+
+        while(!done && segment < array->numSegments) {
+            const int *segmentValues = array->values +
+                                       segment * PACKED_ARRAY_SEGMENT_SIZE;
+
+            while(!done && index < array->counts[segment]) {
+                if(segmentValues[index] > maxValue) {
+                    done = true;
+                }
+                else {
+                    values[numCopied++] = segmentValues[index++];
+                    done = numCopied == maxValues;
+                }
+            }
+
+            segment += 1;
+            index = 0;
+        }
+    }
+
+    return numCopied;
+}
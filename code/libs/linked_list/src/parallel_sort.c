@@ -0,0 +1,191 @@
+/**
+ * @file parallel_sort.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions sorting
+ *        unidirectional and bidirectional lists using several threads.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "linked_list/k_way_merge.h"
+#include "linked_list/parallel_sort.h"
+
+/**
+ * @brief Computes the number of segments (hence threads) to use.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t getNumSegments(size_t length, size_t numThreads) {
+    size_t numSegments = length / PARALLEL_SORT_MIN_SEGMENT_LENGTH;
+
+    return numSegments < numThreads ? numSegments : numThreads;
+}
+
+/**
+ * @brief Computes the length of a segment, the lengths of all the segments
+ *        differing by at most 1.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t getSegmentLength(size_t length,
+                               size_t numSegments,
+                               size_t segment) {
+    return length / numSegments + (segment < length % numSegments ? 1 : 0);
+}
+
+/**
+ * @brief Sorts the given segments, each one by its own thread, the calling
+ *        thread sorting the first one. The segments whose thread cannot be
+ *        started (including all of them if the threads cannot be allocated)
+ *        are sorted by the calling thread as well. It returns once all the
+ *        segments are sorted.
+ *
+ * @param segments The array of the pointers to the first nodes of the
+ *                 segments.
+ *
+ * @param segmentSize The size of an entry of the array.
+ *
+ * @param numSegments The number of segments.
+ *
+ * @param sortSegment The thread routine sorting the segment whose entry it is
+ *                    given a pointer to.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void sortSegments(void *segments,
+                         size_t segmentSize,
+                         size_t numSegments,
+                         void *(*sortSegment)(void *)) {
+    pthread_t *threads = malloc(numSegments * sizeof(pthread_t));
+    size_t numStarted = 1;
+
+    while(threads &&
+          numStarted < numSegments &&
+          pthread_create(&threads[numStarted],
+                         NULL,
+                         sortSegment,
+                         (char *) segments + numStarted * segmentSize) == 0) {
+        numStarted += 1;
+    }
+
+    sortSegment(segments);
+
+    for(size_t s = numStarted; s < numSegments; ++s) {
+        sortSegment((char *) segments + s * segmentSize);
+    }
+
+    for(size_t s = 1; s < numStarted; ++s) {
+        pthread_join(threads[s], NULL);
+    }
+
+    free(threads);
+}
+
+/**
+ * @brief The routine of a thread sorting a unidirectional segment.
+ *
+ * @param arg Pointer to the pointer to the first node of the segment.
+ *
+ * @return NULL.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void *sortUniSegment(void *arg) {
+    sortUniList(arg);
+
+    return NULL;
+}
+
+void sortUniListInParallel(UniNode **root, size_t numThreads) {
+    size_t length = root ? getUniNodesCount(*root) : 0;
+    size_t numSegments = getNumSegments(length, numThreads);
+    UniNode **segments = numSegments > 1 ? malloc(numSegments *
+                                                  sizeof(UniNode *))
+                                         : NULL;
+
+    if(!segments) {
+        // Short list (or allocation failure)
+        sortUniList(root);
+    }
+    else {
+        // Cutting the list into segments
+        UniNode *itemPtr = *root;
+
+        for(size_t s = 0; s < numSegments; ++s) {
+            size_t segmentLength = getSegmentLength(length, numSegments, s);
+
+            segments[s] = itemPtr;
+
+            for(size_t i = 1; i < segmentLength; ++i) {
+                itemPtr = itemPtr->next;
+            }
+
+            UniNode *nextPtr = itemPtr->next;
+            itemPtr->next = NULL;
+            itemPtr = nextPtr;
+        }
+
+        sortSegments(segments, sizeof(UniNode *), numSegments, sortUniSegment);
+
+        // K-way merge of the sorted segments
+        mergeOrderedUniLists(segments, numSegments, root);
+    }
+
+    free(segments);
+}
+
+/**
+ * @brief The routine of a thread sorting a bidirectional segment.
+ *
+ * @param arg Pointer to the pointer to the first node of the segment.
+ *
+ * @return NULL.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void *sortBiSegment(void *arg) {
+    sortBiList(arg);
+
+    return NULL;
+}
+
+void sortBiListInParallel(BiNode **root, size_t numThreads) {
+    size_t length = root ? getBiNodesCount(*root) : 0;
+    size_t numSegments = getNumSegments(length, numThreads);
+    BiNode **segments = numSegments > 1 ? malloc(numSegments *
+                                                 sizeof(BiNode *))
+                                        : NULL;
+
+    if(!segments) {
+        // Short list (or allocation failure)
+        sortBiList(root);
+    }
+    else {
+        // Cutting the list into segments
+        BiNode *itemPtr = *root;
+
+        for(size_t s = 0; s < numSegments; ++s) {
+            size_t segmentLength = getSegmentLength(length, numSegments, s);
+
+            segments[s] = itemPtr;
+
+            for(size_t i = 1; i < segmentLength; ++i) {
+                itemPtr = itemPtr->next;
+            }
+
+            BiNode *nextPtr = itemPtr->next;
+            itemPtr->next = NULL;
+            itemPtr = nextPtr;
+        }
+
+        sortSegments(segments, sizeof(BiNode *), numSegments, sortBiSegment);
+
+        // K-way merge of the sorted segments (fixing the prev pointers)
+        mergeOrderedBiLists(segments, numSegments, root);
+    }
+
+    free(segments);
+}
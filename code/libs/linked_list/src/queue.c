@@ -0,0 +1,189 @@
+/**
+ * @file queue.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with lock-free queues.
+ */
+
+#include <stdlib.h>
+
+#include "linked_list/queue.h"
+#include "reclamation/ebr.h"
+
+bool initMPMCQueue(MPMCQueue *queue) {
+    bool initialized = false;
+    QueueNode *dummy = queue ? malloc(sizeof(QueueNode)) : NULL;
+
+    if(dummy) {
+        dummy->value = 0;
+        atomic_init(&dummy->next, NULL);
+        atomic_init(&queue->head, dummy);
+        atomic_init(&queue->tail, dummy);
+        initialized = true;
+    }
+
+    return initialized;
+}
+
+bool enqueueMPMC(MPMCQueue *queue, int value) {
+    bool added = false;
+    QueueNode *newNode = queue ? malloc(sizeof(QueueNode)) : NULL;
+
+    if(newNode && enterEBRCriticalSection()) {
+        newNode->value = value;
+        atomic_init(&newNode->next, NULL);
+
+        while(!added) {
+            QueueNode *tail = atomic_load(&queue->tail);
+            QueueNode *next = atomic_load(&tail->next);
+
+            if(tail == atomic_load(&queue->tail)) {
+                if(next) {
+                    // Helping the thread that added next to move the tail
+                    atomic_compare_exchange_strong(&queue->tail, &tail, next);
+                }
+                else if(atomic_compare_exchange_weak(&tail->next,
+                                                     &next,
+                                                     newNode)) {
+                    // Moving the tail (others help if it fails)
+                    atomic_compare_exchange_strong(&queue->tail, &tail, newNode);
+                    added = true;
+                }
+            }
+        }
+
+        exitEBRCriticalSection();
+    }
+    else {
+        free(newNode);
+    }
+
+    return added;
+}
+
+bool dequeueMPMC(MPMCQueue *queue, int *valuePtr) {
+    bool removed = false;
+    bool done = !queue || !valuePtr || !enterEBRCriticalSection();
+    bool entered = !done;
+
+    while(!done) {
+        QueueNode *head = atomic_load(&queue->head);
+        QueueNode *tail = atomic_load(&queue->tail);
+        QueueNode *next = atomic_load(&head->next);
+
+        if(head == atomic_load(&queue->head)) {
+            if(!next) {
+                // Empty queue
+                done = true;
+            }
+            else if(head == tail) {
+                // Helping a lagging tail before moving the head past it
+                atomic_compare_exchange_strong(&queue->tail, &tail, next);
+            }
+            else {
+                /**
+                 * The value is read before the CAS as, once it succeeds,
+                 * another thread may dequeue next and retire it.
+                 */
+                int value = next->value;
+
+                if(atomic_compare_exchange_weak(&queue->head, &head, next)) {
+                    /**
+                     * The old dummy node is replaced by next. In the unlikely
+                     * case it cannot be retired (allocation failure), it is
+                     * leaked as freeing it right away is not safe.
+                     */
+                    retireEBRPointer(head, free);
+
+                    *valuePtr = value;
+                    removed = done = true;
+                }
+            }
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return removed;
+}
+
+void deleteEntireMPMCQueue(MPMCQueue *queue) {
+    if(queue) {
+        QueueNode *node = atomic_load(&queue->head);
+
+        while(node) {
+            QueueNode *next = atomic_load(&node->next);
+            free(node);
+            node = next;
+        }
+
+        atomic_store(&queue->head, NULL);
+        atomic_store(&queue->tail, NULL);
+    }
+}
+
+void initMPSCQueue(MPSCQueue *queue) {
+    if(queue) {
+        queue->stub.value = 0;
+        atomic_init(&queue->stub.next, NULL);
+        atomic_init(&queue->head, &queue->stub);
+        queue->tail = &queue->stub;
+    }
+}
+
+void enqueueMPSC(MPSCQueue *queue, QueueNode *node) {
+    if(queue && node) {
+        atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+
+        // Claiming the back of the queue (a single exchange that never fails)
+        QueueNode *prev = atomic_exchange_explicit(&queue->head,
+                                                   node,
+                                                   memory_order_acq_rel);
+
+        /**
+         * Between the exchange and this store, the consumer cannot go past
+         * prev (it sees a queue cut at prev until the link is published).
+         */
+        atomic_store_explicit(&prev->next, node, memory_order_release);
+    }
+}
+
+QueueNode *dequeueMPSC(MPSCQueue *queue) {
+    QueueNode *itemPtr = NULL;
+
+    if(queue) {
+        QueueNode *tail = queue->tail;
+        QueueNode *next = atomic_load_explicit(&tail->next,
+                                               memory_order_acquire);
+
+        if(tail == &queue->stub && next) {
+            // Skipping the stub
+            queue->tail = next;
+            tail = next;
+            next = atomic_load_explicit(&tail->next, memory_order_acquire);
+        }
+
+        if(tail != &queue->stub) {
+            if(next) {
+                queue->tail = next;
+                itemPtr = tail;
+            }
+            else if(tail == atomic_load(&queue->head)) {
+                // Putting the stub back to be able to remove the last node
+                enqueueMPSC(queue, &queue->stub);
+                next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+                if(next) {
+                    queue->tail = next;
+                    itemPtr = tail;
+                }
+            }
+        }
+    }
+
+    return itemPtr;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file ring_buffer.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with the bounded single-producer single-consumer ring buffer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_list/ring_buffer.h"
+#include "linked_list/common.h"
+
+bool initRingBuffer(RingBuffer *buffer, size_t capacity) {
+    bool initialized = false;
+
+    if(buffer && capacity > 0 && capacity <= (size_t) -1 / 2 / sizeof(int)) {
+        size_t numSlots = 1;
+
+        while(numSlots < capacity) {
+            numSlots <<= 1;
+        }
+
+        buffer->values = malloc(numSlots * sizeof(int));
+
+        if(buffer->values) {
+            buffer->capacity = numSlots;
+            buffer->mask = numSlots - 1;
+            buffer->cachedHead = buffer->cachedTail = 0;
+            atomic_init(&buffer->head, 0);
+            atomic_init(&buffer->tail, 0);
+            initialized = true;
+        }
+    }
+
+    return initialized;
+}
+
+void displayRingBuffer(RingBuffer *buffer) {
+    printf("\n< ");
+
+    if(buffer && buffer->values) {
+        size_t head = atomic_load(&buffer->head);
+        size_t tail = atomic_load(&buffer->tail);
+
+        for(size_t i = head; i != tail; ++i) {
+            if(i + 1 != tail) {
+                printf("%d | ", buffer->values[i & buffer->mask]);
+            }
+            else {
+                printf("%d ", buffer->values[i & buffer->mask]);
+            }
+        }
+    }
+
+    printf(">\n");
+}
+
+char *ringBufferToString(RingBuffer *buffer) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len, head = 0, tail = 0;
+
+    if(buffer && buffer->values) {
+        head = atomic_load(&buffer->head);
+        tail = atomic_load(&buffer->tail);
+    }
+
+    if(head == tail) {
+        str = initialize("< >");
+    }
+    else {
+        tmp_str = initialize("");
+
+        for(size_t i = head; i != tail; ++i) {
+            int value = buffer->values[i & buffer->mask];
+            const char *format = i + 1 != tail ? " %d |" : " %d ";
+
+            len = snprintf(NULL, 0, format, value);
+            item = malloc((len + 1) * sizeof(char));
+            sprintf(item, format, value);
+
+            str = concatenate(tmp_str, item);
+            freeCharPtrs(2, tmp_str, item);
+            tmp_str = str;
+        }
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+bool addRingBufferValue(RingBuffer *buffer, int value) {
+    bool added = false;
+
+    if(buffer && buffer->values) {
+        // Only the producer writes the tail, so a relaxed load is enough
+        size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+
+        if(tail - buffer->cachedHead == buffer->capacity) {
+            // Looking full: refreshing the copy of the consumer index
+            buffer->cachedHead = atomic_load_explicit(&buffer->head,
+                                                      memory_order_acquire);
+        }
+
+        if(tail - buffer->cachedHead < buffer->capacity) {
+            buffer->values[tail & buffer->mask] = value;
+
+            // Publishing the value to the consumer
+            atomic_store_explicit(&buffer->tail,
+                                  tail + 1,
+                                  memory_order_release);
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool findRingBufferValue(RingBuffer *buffer, int value) {
+    bool found = false;
+
+    if(buffer && buffer->values) {
+        size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+        size_t tail = atomic_load_explicit(&buffer->tail, memory_order_acquire);
+
+        for(size_t i = head; !found && i != tail; ++i) {
+            found = buffer->values[i & buffer->mask] == value;
+        }
+    }
+
+    return found;
+}
+
+bool deleteRingBufferValue(RingBuffer *buffer, int *valuePtr) {
+    bool deleted = false;
+
+    if(buffer && buffer->values && valuePtr) {
+        // Only the consumer writes the head, so a relaxed load is enough
+        size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+
+        if(head == buffer->cachedTail) {
+            // Looking empty: refreshing the copy of the producer index
+            buffer->cachedTail = atomic_load_explicit(&buffer->tail,
+                                                      memory_order_acquire);
+        }
+
+        if(head != buffer->cachedTail) {
+            *valuePtr = buffer->values[head & buffer->mask];
+
+            // Giving the slot back to the producer
+            atomic_store_explicit(&buffer->head,
+                                  head + 1,
+                                  memory_order_release);
+            deleted = true;
+        }
+    }
+
+    return deleted;
+}
+
+void deleteEntireRingBuffer(RingBuffer *buffer) {
+    if(buffer) {
+        free(buffer->values);
+        buffer->values = NULL;
+        buffer->capacity = buffer->mask = 0;
+        buffer->cachedHead = buffer->cachedTail = 0;
+        atomic_store(&buffer->head, 0);
+        atomic_store(&buffer->tail, 0);
+    }
+}
+
+size_t getRingBufferCount(RingBuffer *buffer) {
+    size_t count = 0;
+
+    if(buffer && buffer->values) {
+        // Loading the head first, so the count cannot look negative
+        size_t head = atomic_load(&buffer->head);
+        count = atomic_load(&buffer->tail) - head;
+    }
+
+    return count;
+}
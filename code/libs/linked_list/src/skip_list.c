@@ -0,0 +1,488 @@
+/**
+ * @file skip_list.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with lock-free skip lists.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_list/common.h"
+#include "linked_list/skip_list.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def MARK_BIT
+ *
+ * @brief The lowest bit of a next pointer telling that the node owning it is
+ *        deleted at that level.
+ */
+#define MARK_BIT ((uintptr_t) 1)
+
+/**
+ * @def SEED_STEP
+ *
+ * @brief The step between the random seeds of successive threads (golden
+ *        ratio constant, which spreads the seeds evenly).
+ */
+#define SEED_STEP 0x9E3779B97F4A7C15ULL
+
+// The next seed to be given to a thread
+static _Atomic uint64_t nextSeed = SEED_STEP;
+
+// The random state of the calling thread (zero until first used)
+static _Thread_local uint64_t randomState = 0;
+
+/**
+ * @brief Retrieves the node out of a (possibly marked) next pointer.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static SkipNode *getNode(uintptr_t link) {
+    return (SkipNode *) (link & ~MARK_BIT);
+}
+
+/**
+ * @brief Tells if a next pointer is marked.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool isMarked(uintptr_t link) {
+    return (link & MARK_BIT) != 0;
+}
+
+/**
+ * @brief Draws the number of levels of a new node, where each extra level has
+ *        a probability of 1 / 2. It uses a per-thread xorshift generator so
+ *        that threads do not contend on a shared state.
+ *
+ * @return The number of levels between 1 and SKIP_LIST_MAX_LEVEL.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int getRandomNumLevels(void) {
+    if(!randomState) {
+        randomState = atomic_fetch_add(&nextSeed, SEED_STEP) | 1;
+    }
+
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+
+    uint64_t bits = randomState;
+    int numLevels = 1;
+
+    while((bits & 1) && numLevels < SKIP_LIST_MAX_LEVEL) {
+        ++numLevels;
+        bits >>= 1;
+    }
+
+    return numLevels;
+}
+
+/**
+ * @brief Creates a new node not linked to any other node yet.
+ *
+ * @param value The value of the node.
+ *
+ * @param numLevels The number of levels of the node.
+ *
+ * @return The new node or NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static SkipNode *createNode(int value, int numLevels) {
+    SkipNode *newNode = malloc(sizeof(SkipNode) +
+                               numLevels * sizeof(_Atomic uintptr_t));
+
+    if(newNode) {
+        newNode->value = value;
+        newNode->numLevels = numLevels;
+
+        // Owned by the adding thread and by the future deleting one
+        atomic_init(&newNode->numOwners, 2);
+        newNode->nextRetired = NULL;
+
+        for(int level = 0; level < numLevels; ++level) {
+            atomic_init(&newNode->next[level], 0);
+        }
+    }
+
+    return newNode;
+}
+
+/**
+ * @brief Releases a node by one of its owners. The last owner retires it (it
+ *        is unlinked from all levels by then).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void releaseNode(SkipList *list, SkipNode *node) {
+    if(atomic_fetch_sub(&node->numOwners, 1) == 1 &&
+       !retireEBRPointer(node, free)) {
+        SkipNode *head = atomic_load(&list->retired);
+
+        do {
+            node->nextRetired = head;
+        } while(!atomic_compare_exchange_weak(&list->retired, &head, node));
+    }
+}
+
+/**
+ * @brief Searches for the position of a value at every level, unlinking the
+ *        marked nodes found on the way.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param value The value to search for.
+ *
+ * @param preds The array set to the last node before the value per level.
+ *
+ * @param succs The array set to the first node after or equal to the value per
+ *              level (NULL at the end of the level).
+ *
+ * @return True if an unmarked node holding the value was found at level 0 (it
+ *         is then succs[0]) and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool search(SkipList *list,
+                   int value,
+                   SkipNode **preds,
+                   SkipNode **succs) {
+    bool found = false;
+    bool retry = true;
+
+    while(retry) {
+        SkipNode *pred = list->head;
+        retry = false;
+
+        for(int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0 && !retry; --level) {
+            SkipNode *curr = getNode(atomic_load(&pred->next[level]));
+            bool advancing = true;
+
+            while(curr && advancing && !retry) {
+                uintptr_t succLink = atomic_load(&curr->next[level]);
+
+                if(isMarked(succLink)) {
+                    uintptr_t expected = (uintptr_t) curr;
+
+                    // Restarting if pred got deleted or changed meanwhile
+                    if(atomic_compare_exchange_strong(&pred->next[level],
+                                                      &expected,
+                                                      succLink & ~MARK_BIT)) {
+                        curr = getNode(succLink);
+                    }
+                    else {
+                        retry = true;
+                    }
+                }
+                else if(curr->value < value) {
+                    pred = curr;
+                    curr = getNode(succLink);
+                }
+                else {
+                    advancing = false;
+                }
+            }
+
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+
+        found = !retry && succs[0] && succs[0]->value == value;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Links a node already added at level 0 to its upper levels. Linking
+ *        stops as soon as the node gets deleted.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param node The node to be linked.
+ *
+ * @param preds The predecessors found by the last search.
+ *
+ * @param succs The successors found by the last search.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void linkUpperLevels(SkipList *list,
+                            SkipNode *node,
+                            SkipNode **preds,
+                            SkipNode **succs) {
+    bool linking = true;
+
+    for(int level = 1; level < node->numLevels && linking; ++level) {
+        bool linked = false;
+
+        while(linking && !linked) {
+            uintptr_t link = atomic_load(&node->next[level]);
+
+            // A failing CAS means the node got marked at this level
+            linking = !isMarked(link) &&
+                      (getNode(link) == succs[level] ||
+                       atomic_compare_exchange_strong(&node->next[level],
+                                                      &link,
+                                                      (uintptr_t) succs[level]));
+
+            if(linking) {
+                uintptr_t expected = (uintptr_t) succs[level];
+
+                linked = atomic_compare_exchange_strong(&preds[level]->next[level],
+                                                        &expected,
+                                                        (uintptr_t) node);
+
+                if(!linked) {
+                    // Searching again unless the node is no longer in the list
+                    linking = search(list, node->value, preds, succs) &&
+                              succs[0] == node;
+                }
+            }
+        }
+    }
+
+    /**
+     * If the node got deleted meanwhile, it might have been linked at some
+     * level after the deleting thread unlinked it. Searching again unlinks it
+     * from all levels.
+     */
+    if(isMarked(atomic_load(&node->next[0]))) {
+        search(list, node->value, preds, succs);
+    }
+
+    releaseNode(list, node);
+}
+
+bool initSkipList(SkipList *list) {
+    bool initialized = false;
+
+    if(list) {
+        list->head = createNode(0, SKIP_LIST_MAX_LEVEL);
+        atomic_init(&list->retired, NULL);
+        atomic_init(&list->count, 0);
+        initialized = list->head != NULL;
+    }
+
+    return initialized;
+}
+
+void displaySkipList(SkipList *list) {
+    printf("\n< ");
+
+    if(list && list->head && enterEBRCriticalSection()) {
+        bool first = true;
+        SkipNode *node = getNode(atomic_load(&list->head->next[0]));
+
+        while(node) {
+            uintptr_t link = atomic_load(&node->next[0]);
+
+            if(!isMarked(link)) {
+                printf(first ? "%d " : "| %d ", node->value);
+                first = false;
+            }
+
+            node = getNode(link);
+        }
+
+        exitEBRCriticalSection();
+    }
+
+    printf(">\n");
+}
+
+char *skipListToString(SkipList *list) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = initialize("<"), *tmp_str, *item;
+    size_t len;
+
+    if(list && list->head && enterEBRCriticalSection()) {
+        bool first = true;
+        SkipNode *node = getNode(atomic_load(&list->head->next[0]));
+
+        while(node) {
+            uintptr_t link = atomic_load(&node->next[0]);
+
+            if(!isMarked(link)) {
+                len = snprintf(NULL, 0, first ? " %d" : " | %d", node->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, first ? " %d" : " | %d", node->value);
+
+                tmp_str = str;
+                str = concatenate(tmp_str, item);
+                freeCharPtrs(2, tmp_str, item);
+                first = false;
+            }
+
+            node = getNode(link);
+        }
+
+        exitEBRCriticalSection();
+    }
+
+    tmp_str = str;
+    str = concatenate(tmp_str, " >");
+    free(tmp_str);
+
+    return str;
+}
+
+bool addSkipNode(SkipList *list, int value) {
+    bool added = false;
+    bool entered = list && list->head && enterEBRCriticalSection();
+    bool done = !entered;
+    SkipNode *preds[SKIP_LIST_MAX_LEVEL], *succs[SKIP_LIST_MAX_LEVEL];
+    SkipNode *newNode = NULL;
+
+    while(!done) {
+        if(search(list, value, preds, succs)) {
+            // Already existing
+            done = true;
+        }
+        else {
+            if(!newNode) {
+                newNode = createNode(value, getRandomNumLevels());
+                done = !newNode;
+            }
+
+            if(newNode) {
+                for(int level = 0; level < newNode->numLevels; ++level) {
+                    atomic_store_explicit(&newNode->next[level],
+                                          (uintptr_t) succs[level],
+                                          memory_order_relaxed);
+                }
+
+                /**
+                 * Counting before linking avoids a transient negative count
+                 * in case another thread deletes the node right away.
+                 */
+                atomic_fetch_add(&list->count, 1);
+
+                // Adding the node at level 0 makes it part of the list
+                uintptr_t expected = (uintptr_t) succs[0];
+
+                if(atomic_compare_exchange_strong(&preds[0]->next[0],
+                                                  &expected,
+                                                  (uintptr_t) newNode)) {
+                    linkUpperLevels(list, newNode, preds, succs);
+                    added = done = true;
+                }
+                else {
+                    atomic_fetch_sub(&list->count, 1);
+                }
+            }
+        }
+    }
+
+    if(!added) {
+        // The node never got published, so it can be freed right away
+        free(newNode);
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return added;
+}
+
+bool findSkipNode(SkipList *list, int value) {
+    bool found = false;
+
+    if(list && list->head && enterEBRCriticalSection()) {
+        SkipNode *pred = list->head, *curr = NULL;
+
+        // Wait-free: marked nodes are passed through instead of unlinked
+        for(int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; --level) {
+            curr = getNode(atomic_load(&pred->next[level]));
+
+            while(curr && curr->value < value) {
+                pred = curr;
+                curr = getNode(atomic_load(&curr->next[level]));
+            }
+        }
+
+        found = curr &&
+                curr->value == value &&
+                !isMarked(atomic_load(&curr->next[0]));
+
+        exitEBRCriticalSection();
+    }
+
+    return found;
+}
+
+bool deleteSkipNode(SkipList *list, int value) {
+    bool deleted = false;
+    bool entered = list && list->head && enterEBRCriticalSection();
+    SkipNode *preds[SKIP_LIST_MAX_LEVEL], *succs[SKIP_LIST_MAX_LEVEL];
+
+    if(entered && search(list, value, preds, succs)) {
+        SkipNode *node = succs[0];
+
+        // Marking upper levels from top to bottom prevents further linking
+        for(int level = node->numLevels - 1; level > 0; --level) {
+            atomic_fetch_or(&node->next[level], MARK_BIT);
+        }
+
+        // The thread marking level 0 is the one deleting the node
+        uintptr_t link = atomic_load(&node->next[0]);
+
+        while(!isMarked(link) && !deleted) {
+            deleted = atomic_compare_exchange_weak(&node->next[0],
+                                                   &link,
+                                                   link | MARK_BIT);
+        }
+
+        if(deleted) {
+            atomic_fetch_sub(&list->count, 1);
+
+            // Unlinking the node from all levels
+            search(list, value, preds, succs);
+            releaseNode(list, node);
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return deleted;
+}
+
+void deleteEntireSkipList(SkipList *list) {
+    if(list && list->head) {
+        SkipNode *node = getNode(atomic_load(&list->head->next[0]));
+
+        while(node) {
+            SkipNode *next = getNode(atomic_load(&node->next[0]));
+            free(node);
+            node = next;
+        }
+
+        node = atomic_load(&list->retired);
+
+        while(node) {
+            SkipNode *next = node->nextRetired;
+            free(node);
+            node = next;
+        }
+
+        FREE_PTR(list->head);
+        atomic_store(&list->retired, NULL);
+        atomic_store(&list->count, 0);
+    }
+}
+
+size_t getSkipNodesCount(SkipList *list) {
+    return list ? atomic_load(&list->count) : 0;
+}
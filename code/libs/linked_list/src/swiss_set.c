@@ -0,0 +1,362 @@
+/**
+ * @file swiss_set.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with open-addressing integer sets probed a group of slots at a time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linked_list/common.h"
+#include "linked_list/swiss_set.h"
+#include "hash.h"
+
+/**
+ * REMARK:
+ *
+ * SSE2 is part of every x86-64 processor. Defining SWISS_SET_NO_SIMD forces
+ * the portable group matching (e.g., to compare both).
+ */
+#if !defined(SWISS_SET_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SWISS_SET_USE_SSE2
+#endif
+
+/**
+ * @def EMPTY
+ *
+ * @brief The control byte of a never used slot.
+ */
+#define EMPTY ((int8_t) -128)
+
+/**
+ * @def DELETED
+ *
+ * @brief The control byte of a slot whose value got deleted.
+ */
+#define DELETED ((int8_t) -2)
+
+/**
+ * @brief Builds the mask of the slots of a group whose control byte equals
+ *        the given one (bit i for slot i).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t matchControl(const int8_t *group, int8_t control) {
+#ifdef SWISS_SET_USE_SSE2
+    __m128i controls = _mm_loadu_si128((const __m128i *) group);
+
+    return (uint32_t) _mm_movemask_epi8(
+               _mm_cmpeq_epi8(controls, _mm_set1_epi8(control)));
+#else
+    uint32_t mask = 0;
+
+    for(int i = 0; i < SWISS_SET_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) (group[i] == control) << i;
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Builds the mask of the EMPTY or DELETED slots of a group (the ones
+ *        whose control byte has its highest bit set).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t matchAvailable(const int8_t *group) {
+#ifdef SWISS_SET_USE_SSE2
+    return (uint32_t) _mm_movemask_epi8(
+               _mm_loadu_si128((const __m128i *) group));
+#else
+    uint32_t mask = 0;
+
+    for(int i = 0; i < SWISS_SET_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) (group[i] < 0) << i;
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Retrieves the index of the lowest set bit of a non-zero mask.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int getLowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+
+    while(!(mask & 1)) {
+        mask >>= 1;
+        index += 1;
+    }
+
+    return index;
+#endif
+}
+
+/**
+ * @brief Finds the slot holding the given value.
+ *
+ * @return The index of the slot or SIZE_MAX if the value does not exist.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t findSlot(const SwissSet *set, int value) {
+    uint32_t hash = hashValue(value);
+    int8_t h2 = (int8_t) (hash & 0x7F);
+    size_t groupMask = set->numGroups - 1;
+    size_t group = (hash >> 7) & groupMask, slot = SIZE_MAX;
+    bool done = false;
+
+    // Triangular probing visits every group once
+    for(size_t step = 1; !done && step <= set->numGroups; ++step) {
+        const int8_t *controls = &set->controls[group * SWISS_SET_GROUP_SIZE];
+        uint32_t mask = matchControl(controls, h2);
+
+        while(mask && !done) {
+            size_t index = group * SWISS_SET_GROUP_SIZE + getLowestBit(mask);
+
+            if(set->values[index] == value) {
+                slot = index;
+                done = true;
+            }
+
+            mask &= mask - 1;
+        }
+
+        // A group with an EMPTY slot ends every probe sequence passing by
+        done = done || matchControl(controls, EMPTY);
+        group = (group + step) & groupMask;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Stores a value (known not to exist) in the first EMPTY or DELETED
+ *        slot of its probe sequence.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void insertValue(SwissSet *set, int value) {
+    uint32_t hash = hashValue(value);
+    size_t groupMask = set->numGroups - 1;
+    size_t group = (hash >> 7) & groupMask;
+    uint32_t mask = matchAvailable(&set->controls[group *
+                                                  SWISS_SET_GROUP_SIZE]);
+
+    for(size_t step = 1; !mask; ++step) {
+        group = (group + step) & groupMask;
+        mask = matchAvailable(&set->controls[group * SWISS_SET_GROUP_SIZE]);
+    }
+
+    size_t index = group * SWISS_SET_GROUP_SIZE + getLowestBit(mask);
+
+    set->numDeleted -= set->controls[index] == DELETED;
+    set->controls[index] = (int8_t) (hash & 0x7F);
+    set->values[index] = value;
+    set->count += 1;
+}
+
+/**
+ * @brief Moves all values into numGroups new groups, which drops the DELETED
+ *        slots.
+ *
+ * @return True if the set got rehashed and false otherwise (allocation
+ *         failure, in which case the set is left unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool rehash(SwissSet *set, size_t numGroups) {
+    size_t numSlots = numGroups * SWISS_SET_GROUP_SIZE;
+    int8_t *controls = malloc(numSlots * sizeof(int8_t));
+    int *values = malloc(numSlots * sizeof(int));
+    bool rehashed = controls && values;
+
+    if(rehashed) {
+        SwissSet old = *set;
+
+        memset(controls, EMPTY, numSlots * sizeof(int8_t));
+        set->controls = controls;
+        set->values = values;
+        set->numGroups = numGroups;
+        set->count = 0;
+        set->numDeleted = 0;
+
+        for(size_t i = 0; i < old.numGroups * SWISS_SET_GROUP_SIZE; ++i) {
+            if(old.controls[i] >= 0) {
+                insertValue(set, old.values[i]);
+            }
+        }
+
+        free(old.controls);
+        free(old.values);
+    }
+    else {
+        free(controls);
+        free(values);
+    }
+
+    return rehashed;
+}
+
+bool initSwissSet(SwissSet *set) {
+    bool initialized = false;
+
+    if(set) {
+        set->controls = NULL;
+        set->values = NULL;
+        set->numGroups = 0;
+        set->count = 0;
+        set->numDeleted = 0;
+
+        initialized = rehash(set, 1);
+    }
+
+    return initialized;
+}
+
+void displaySwissSet(SwissSet *set) {
+    size_t numDisplayed = 0;
+
+    printf("\n< ");
+
+    for(size_t i = 0; set && i < set->numGroups * SWISS_SET_GROUP_SIZE; ++i) {
+        if(set->controls[i] >= 0) {
+            if(++numDisplayed < set->count) {
+                printf("%d | ", set->values[i]);
+            }
+            else {
+                printf("%d ", set->values[i]);
+            }
+        }
+    }
+
+    printf(">\n");
+}
+
+char *swissSetToString(SwissSet *set) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len, numConverted = 0;
+
+    if(!set || set->count == 0) {
+        str = initialize("< >");
+    }
+    else {
+        tmp_str = initialize("");
+
+        for(size_t i = 0; i < set->numGroups * SWISS_SET_GROUP_SIZE; ++i) {
+            if(set->controls[i] >= 0) {
+                const char *format = ++numConverted < set->count ? " %d |"
+                                                                 : " %d ";
+
+                len = snprintf(NULL, 0, format, set->values[i]);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, format, set->values[i]);
+
+                str = concatenate(tmp_str, item);
+                freeCharPtrs(2, tmp_str, item);
+                tmp_str = str;
+            }
+        }
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+bool addSwissValue(SwissSet *set, int value) {
+    bool added = false;
+
+    if(set && set->controls && findSlot(set, value) == SIZE_MAX) {
+        size_t numSlots = set->numGroups * SWISS_SET_GROUP_SIZE;
+        bool hasRoom = true;
+
+        if(8 * (set->count + set->numDeleted + 1) > 7 * numSlots) {
+            // Growing unless the DELETED slots make most of the load
+            size_t numGroups = 2 * (set->count + 1) > numSlots
+                               ? 2 * set->numGroups
+                               : set->numGroups;
+
+            hasRoom = rehash(set, numGroups);
+        }
+
+        if(hasRoom) {
+            insertValue(set, value);
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool findSwissValue(SwissSet *set, int value) {
+    return set && set->controls && findSlot(set, value) != SIZE_MAX;
+}
+
+bool deleteSwissValue(SwissSet *set, int value) {
+    bool deleted = false;
+    size_t slot = set && set->controls ? findSlot(set, value) : SIZE_MAX;
+
+    if(slot != SIZE_MAX) {
+        const int8_t *group = &set->controls[slot - slot %
+                                             SWISS_SET_GROUP_SIZE];
+
+        /**
+         * Probe sequences stop at groups having an EMPTY slot, so the slot can
+         * be emptied if its group already has one. Otherwise, it has to stay
+         * DELETED not to cut the probe sequences going through its group.
+         */
+        if(matchControl(group, EMPTY)) {
+            set->controls[slot] = EMPTY;
+        }
+        else {
+            set->controls[slot] = DELETED;
+            set->numDeleted += 1;
+        }
+
+        set->count -= 1;
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+void deleteEntireSwissSet(SwissSet *set) {
+    if(set) {
+        free(set->controls);
+        free(set->values);
+
+        set->controls = NULL;
+        set->values = NULL;
+        set->numGroups = 0;
+        set->count = 0;
+        set->numDeleted = 0;
+    }
+}
+
+size_t getSwissValuesCount(SwissSet *set) {
+    return set ? set->count : 0;
+}
@@ -0,0 +1,515 @@
+/**
+ * @file unicircular.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated with
+ *        unidirectional circular linked lists, embracing both unordered and
+ *        ordered versions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linked_list/unicircular.h"
+#include "linked_list/common.h"
+
+/**
+ * @brief Unlinks and frees the node following the given one.
+ *
+ * @param root Pointer to a pointer to the last node of the list.
+ *
+ * @param prevPtr The node before the one to be deleted.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void deleteNextNode(UniNode **root, UniNode *prevPtr) {
+    UniNode *itemPtr = prevPtr->next;
+
+    if(itemPtr == prevPtr) {
+        // The only node of the list
+        *root = NULL;
+    }
+    else {
+        prevPtr->next = itemPtr->next;
+
+        if(itemPtr == *root) {
+            // The last node is deleted, so its predecessor becomes the last
+            *root = prevPtr;
+        }
+    }
+
+    free(itemPtr);
+}
+
+/**
+ * @brief Inserts a new node after the given one.
+ *
+ * @param root Pointer to a pointer to the last node of the list.
+ *
+ * @param prevPtr The node after which to insert (NULL for an empty list).
+ *
+ * @param value The value of the new node.
+ *
+ * @param isLast Tells if the new node becomes the last one.
+ *
+ * @return True if the node was added and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool insertNode(UniNode **root, UniNode *prevPtr, int value, bool isLast) {
+    bool added = false;
+    UniNode *newItemPtr = malloc(sizeof(UniNode));
+
+    if(newItemPtr) {
+        newItemPtr->value = value;
+
+        if(prevPtr) {
+            newItemPtr->next = prevPtr->next;
+            prevPtr->next = newItemPtr;
+        }
+        else {
+            // The single node points to itself
+            newItemPtr->next = newItemPtr;
+        }
+
+        if(isLast) {
+            *root = newItemPtr;
+        }
+
+        added = true;
+    }
+
+    return added;
+}
+
+// Task 1: Textual Description
+void displayUniCircularList(UniNode *root) {
+    printf("\n< ");
+
+    if(root) {
+        UniNode *itemPtr = root;
+
+        do {
+            itemPtr = itemPtr->next;
+
+            if(itemPtr != root) {
+                printf("%d | ", itemPtr->value);
+            }
+            else {
+                printf("%d ", itemPtr->value);
+            }
+        } while(itemPtr != root);
+    }
+
+    printf(">\n");
+}
+
+char *uniCircularListToString(UniNode *root) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    size_t len;
+
+    if (!root) {
+        str = initialize("< >");
+    }
+    else {
+        UniNode *itemPtr = root;
+        tmp_str = initialize("");
+
+        do {
+            itemPtr = itemPtr->next;
+
+            if (itemPtr != root) {
+                len = snprintf(NULL, 0, " %d |", itemPtr->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, " %d |", itemPtr->value);
+            }
+            else {
+                len = snprintf(NULL, 0, " %d ", itemPtr->value);
+                item = malloc((len + 1) * sizeof(char));
+                sprintf(item, " %d ", itemPtr->value);
+            }
+
+            str = concatenate(tmp_str, item);
+            freeCharPtrs(2, tmp_str, item);
+            tmp_str = str;
+        } while(itemPtr != root);
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+// Task 2: Creation Operation
+bool addUniCircularNode(UniNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        // The new node goes right after the last one and becomes the last
+        added = insertNode(root, *root, value, true);
+    }
+
+    return added;
+}
+
+bool addUniCircularNodeRecursively(UniNode **root, int value) {
+    // The end is reached in O(1), so there is nothing to recurse on
+    return addUniCircularNode(root, value);
+}
+
+// Task 3: Read / Find Operations
+UniNode *findUniCircularNode(UniNode *root, int value) {
+    UniNode *itemPtr = NULL;
+
+    if(root) {
+        UniNode *currentPtr = root;
+
+        do {
+            currentPtr = currentPtr->next;
+
+            if(currentPtr->value == value) {
+                itemPtr = currentPtr;
+            }
+        } while(!itemPtr && currentPtr != root);
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Finds recursively the first node with the specified value starting
+ *        from a given node up to the last one.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static UniNode *findFromNode(UniNode *node, UniNode *lastPtr, int value) {
+    UniNode *itemPtr = NULL;
+
+    if(node->value == value) {
+        itemPtr = node;
+    }
+    else if(node != lastPtr) {
+        itemPtr = findFromNode(node->next, lastPtr, value);
+    }
+
+    return itemPtr;
+}
+
+UniNode *findUniCircularNodeRecursively(UniNode *root, int value) {
+    return root ? findFromNode(root->next, root, value) : NULL;
+}
+
+// Task 4: Update Operation
+bool updateUniCircularNode(UniNode *root, int originalValue, int newValue) {
+    bool updated = false;
+    UniNode *itemPtr = findUniCircularNode(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+        updated = true;
+    }
+
+    return updated;
+}
+
+bool updateUniCircularNodeRecursively(UniNode *root,
+                                      int originalValue,
+                                      int newValue) {
+    bool updated = false;
+    UniNode *itemPtr = findUniCircularNodeRecursively(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+        updated = true;
+    }
+
+    return updated;
+}
+
+// Task 5: Delete Operation
+bool deleteUniCircularNode(UniNode **root, int value) {
+    bool deleted = false;
+
+    if(root && *root) {
+        UniNode *prevPtr = *root, *currentPtr;
+
+        do {
+            currentPtr = prevPtr->next;
+
+            if(currentPtr->value == value) {
+                deleteNextNode(root, prevPtr);
+                deleted = true;
+            }
+            else {
+                prevPtr = currentPtr;
+            }
+        } while(!deleted && currentPtr != *root);
+    }
+
+    return deleted;
+}
+
+/**
+ * @brief Deletes recursively the first node with the specified value starting
+ *        from the node following prevPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool deleteFromNode(UniNode **root, UniNode *prevPtr, int value) {
+    bool deleted = false;
+
+    if(prevPtr->next->value == value) {
+        deleteNextNode(root, prevPtr);
+        deleted = true;
+    }
+    else if(prevPtr->next != *root) {
+        deleted = deleteFromNode(root, prevPtr->next, value);
+    }
+
+    return deleted;
+}
+
+bool deleteUniCircularNodeRecursively(UniNode **root, int value) {
+    return root && *root && deleteFromNode(root, *root, value);
+}
+
+// Task 6: Delete Entire List
+void deleteEntireUniCircularList(UniNode **root) {
+    if(root && *root) {
+        // Breaking the circle turns it into a unidirectional list
+        UniNode *firstPtr = (*root)->next;
+        (*root)->next = NULL;
+        *root = NULL;
+
+        deleteEntireUniList(&firstPtr);
+    }
+}
+
+void deleteEntireUniCircularListRecursively(UniNode **root) {
+    if(root && *root) {
+        UniNode *firstPtr = (*root)->next;
+        (*root)->next = NULL;
+        *root = NULL;
+
+        deleteEntireUniListRecursively(&firstPtr);
+    }
+}
+
+// Task 7: Getting List Length / UniNodes Count
+size_t getUniCircularNodesCount(UniNode *root) {
+    size_t count = 0;
+
+    if(root) {
+        UniNode *itemPtr = root;
+
+        do {
+            count += 1;
+            itemPtr = itemPtr->next;
+        } while(itemPtr != root);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Counts recursively the nodes starting from a given node up to the
+ *        last one.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t countFromNode(UniNode *node, UniNode *lastPtr) {
+    return 1 + (node != lastPtr ? countFromNode(node->next, lastPtr) : 0);
+}
+
+size_t getUniCircularNodesCountRecursively(UniNode *root) {
+    return root ? countFromNode(root->next, root) : 0;
+}
+
+// Task 8: Ordered Unidirectional Circular List
+bool addOrderedUniCircularNode(UniNode **root, int value) {
+    /**
+     * We assume the current list is ordered and duplicates are allowed. As in
+     * the ordered unidirectional list, the new node goes before the first node
+     * whose value is greater than or equal to the given one.
+     */
+    bool added = false;
+
+    if(root) {
+        if(!*root || (*root)->value < value) {
+            // Becoming the last node in O(1)
+            added = insertNode(root, *root, value, true);
+        }
+        else {
+            // The last value is not smaller, so the loop stops before it
+            UniNode *prevPtr = *root;
+
+            while(prevPtr->next->value < value) {
+                prevPtr = prevPtr->next;
+            }
+
+            added = insertNode(root, prevPtr, value, false);
+        }
+    }
+
+    return added;
+}
+
+/**
+ * @brief Adds recursively a value in order after prevPtr or further.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addOrderedAfterNode(UniNode **root, UniNode *prevPtr, int value) {
+    bool added;
+
+    if(prevPtr->next->value >= value) {
+        added = insertNode(root, prevPtr, value, false);
+    }
+    else {
+        added = addOrderedAfterNode(root, prevPtr->next, value);
+    }
+
+    return added;
+}
+
+bool addOrderedUniCircularNodeRecursively(UniNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        if(!*root || (*root)->value < value) {
+            added = insertNode(root, *root, value, true);
+        }
+        else {
+            added = addOrderedAfterNode(root, *root, value);
+        }
+    }
+
+    return added;
+}
+
+UniNode *findOrderedUniCircularNode(UniNode *root, int value) {
+    // We assume ordered unidirectional circular list
+    UniNode *itemPtr = NULL;
+
+    if(root && root->value >= value) {
+        // The last value is not smaller, so the loop stops before wrapping
+        UniNode *currentPtr = root->next;
+
+        while(currentPtr->value < value) {
+            currentPtr = currentPtr->next;
+        }
+
+        if(currentPtr->value == value) {
+            itemPtr = currentPtr;
+        }
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Finds recursively a value in order starting from a given node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static UniNode *findOrderedFromNode(UniNode *node, int value) {
+    UniNode *itemPtr = NULL;
+
+    if(node->value == value) {
+        itemPtr = node;
+    }
+    else if(node->value < value) {
+        itemPtr = findOrderedFromNode(node->next, value);
+    }
+
+    return itemPtr;
+}
+
+UniNode *findOrderedUniCircularNodeRecursively(UniNode *root, int value) {
+    UniNode *itemPtr = NULL;
+
+    if(root && root->value >= value) {
+        itemPtr = findOrderedFromNode(root->next, value);
+    }
+
+    return itemPtr;
+}
+
+bool deleteOrderedUniCircularNode(UniNode **root, int value) {
+    bool deleted = false;
+
+    if(root && *root && (*root)->value >= value) {
+        UniNode *prevPtr = *root;
+
+        while(prevPtr->next->value < value) {
+            prevPtr = prevPtr->next;
+        }
+
+        if(prevPtr->next->value == value) {
+            deleteNextNode(root, prevPtr);
+            deleted = true;
+        }
+    }
+
+    return deleted;
+}
+
+/**
+ * @brief Deletes recursively a value in order after prevPtr or further.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool deleteOrderedAfterNode(UniNode **root, UniNode *prevPtr, int value) {
+    bool deleted = false;
+
+    if(prevPtr->next->value == value) {
+        deleteNextNode(root, prevPtr);
+        deleted = true;
+    }
+    else if(prevPtr->next->value < value) {
+        deleted = deleteOrderedAfterNode(root, prevPtr->next, value);
+    }
+
+    return deleted;
+}
+
+bool deleteOrderedUniCircularNodeRecursively(UniNode **root, int value) {
+    bool deleted = false;
+
+    if(root && *root && (*root)->value >= value) {
+        deleted = deleteOrderedAfterNode(root, *root, value);
+    }
+
+    return deleted;
+}
+
+// Task 9: Sorting
+void sortUniCircularList(UniNode **root) {
+    if(root && *root) {
+        UniNode *firstPtr = (*root)->next;
+        (*root)->next = NULL;
+
+        sortUniList(&firstPtr);
+
+        // The last node of the sorted nodes closes the circle
+        UniNode *lastPtr = firstPtr;
+
+        while(lastPtr->next) {
+            lastPtr = lastPtr->next;
+        }
+
+        lastPtr->next = firstPtr;
+        *root = lastPtr;
+    }
+}
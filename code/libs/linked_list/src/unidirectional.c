@@ -14,6 +14,7 @@
 
 #include "linked_list/unidirectional.h"
 #include "linked_list/common.h"
+#include "merge.h"
 
 // Task 1: Data Structure Declaration and Textual Description
 void displayUniList(UniNode *root) {
@@ -406,3 +407,330 @@ bool deleteOrderedUniNodeRecursively(UniNode **root, int value) {
 
     return deleted;
 }
+
+// Task 9: Sorting
+UniNode *internalMergeUniLists(UniNode *left, UniNode *right) {
+    UniNode *head = NULL, **tailPtr = &head;
+
+    while(left && right) {
+        if(left->value <= right->value) {
+            *tailPtr = left;
+            left = left->next;
+        }
+        else {
+            *tailPtr = right;
+            right = right->next;
+        }
+
+        tailPtr = &(*tailPtr)->next;
+    }
+
+    *tailPtr = left ? left : right;
+
+    return head;
+}
+
+void sortUniList(UniNode **root) {
+    if(root && *root) {
+        /**
+         * Bottom-up merge sort using a binary counter: runs[i] is either empty
+         * or holds a sorted run of 2^i nodes. Every node taken from the list
+         * is a run of 1 node that is merged with runs[0], runs[1], ... as long
+         * as they are occupied (like carrying when adding 1 to a binary
+         * number). Unlike merging runs of width 1, 2, 4, ... over the whole
+         * list, recently merged nodes are merged again while they are still
+         * in the cache. The array covers lists of up to 2^64 - 1 nodes.
+         */
+        UniNode *runs[64] = {NULL};
+        size_t numRuns = 0, i;
+        UniNode *itemPtr = *root;
+
+        while(itemPtr) {
+            UniNode *run = itemPtr;
+            itemPtr = itemPtr->next;
+            run->next = NULL;
+
+            // runs[i] holds older nodes, so it goes first (stable sort)
+            for(i = 0; i < numRuns && runs[i]; ++i) {
+                run = internalMergeUniLists(runs[i], run);
+                runs[i] = NULL;
+            }
+
+            runs[i] = run;
+
+            if(i == numRuns) {
+                numRuns += 1;
+            }
+        }
+
+        // Merging the remaining runs, from the most recent to the oldest
+        *root = NULL;
+
+        for(i = 0; i < numRuns; ++i) {
+            if(runs[i]) {
+                *root = internalMergeUniLists(runs[i], *root);
+            }
+        }
+    }
+}
+
+// Task 10: Bulk Operations
+bool addOrderedUniNodes(UniNode **root,
+                        const int *values,
+                        size_t count,
+                        bool areSorted) {
+    bool added = root && (values || count == 0);
+    UniNode *batch = NULL, **batchTailPtr = &batch;
+
+    // Allocating all the new nodes first (in the given order)
+    for(size_t i = 0; added && i < count; ++i) {
+        *batchTailPtr = malloc(sizeof(UniNode));
+
+        if(*batchTailPtr) {
+            (*batchTailPtr)->value = values[i];
+            (*batchTailPtr)->next = NULL;
+            batchTailPtr = &(*batchTailPtr)->next;
+        }
+        else {
+            deleteEntireUniList(&batch);
+            added = false;
+        }
+    }
+
+    if(added) {
+        if(!areSorted) {
+            sortUniList(&batch);
+        }
+
+        /**
+         * Merging the batch into the list in one pass: the scan for the next
+         * new node resumes right after the previous one. As in
+         * addOrderedUniNode, a new node goes before the existing nodes that
+         * are equal to it.
+         */
+        UniNode **linkPtr = root;
+
+        while(batch) {
+            while(*linkPtr && (*linkPtr)->value < batch->value) {
+                linkPtr = &(*linkPtr)->next;
+            }
+
+            UniNode *newItemPtr = batch;
+            batch = batch->next;
+
+            newItemPtr->next = *linkPtr;
+            *linkPtr = newItemPtr;
+            linkPtr = &newItemPtr->next;
+        }
+    }
+
+    return added;
+}
+
+size_t findOrderedUniNodes(UniNode *root,
+                           const int *keys,
+                           size_t count,
+                           UniNode **nodes) {
+    size_t numFound = 0;
+    UniNode *itemPtr = root;
+
+    for(size_t i = 0; keys && i < count; ++i) {
+        if(i > 0 && keys[i] < keys[i - 1]) {
+            // Unsorted keys: the key may be behind, so the scan restarts
+            itemPtr = root;
+        }
+
+        while(itemPtr && itemPtr->value < keys[i]) {
+            itemPtr = itemPtr->next;
+        }
+
+        // The scan does not go past a found node, as the next key may be equal
+        UniNode *foundPtr = itemPtr && itemPtr->value == keys[i] ? itemPtr : NULL;
+
+        if(nodes) {
+            nodes[i] = foundPtr;
+        }
+
+        if(foundPtr) {
+            numFound += 1;
+        }
+    }
+
+    return numFound;
+}
+
+// Task 11: Set Operations
+/**
+ * @brief The set operations combining two ordered lists.
+ */
+typedef enum SetOperation {
+    SET_UNION,
+    SET_INTERSECTION,
+    SET_DIFFERENCE
+} SetOperation;
+
+/**
+ * @brief Builds a new ordered list out of two ordered ones, according to the
+ *        given set operation, in a single O(n + m) pass.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored.
+ *
+ * @param operation The set operation to perform.
+ *
+ * @return True if the new list is built and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool combineOrderedUniLists(UniNode *first,
+                                   UniNode *second,
+                                   UniNode **result,
+                                   SetOperation operation) {
+    bool built = result != NULL;
+    UniNode *root = NULL, **tailPtr = &root;
+
+    /**
+     * The loop stops as soon as no more values can make it to the result: for
+     * an intersection, when one of the lists is exhausted, and for a
+     * difference, when the first list is exhausted.
+     */
+    while(built &&
+          (operation == SET_UNION ? first || second :
+           operation == SET_INTERSECTION ? first && second : first != NULL)) {
+        // The smallest value not handled yet and the lists it belongs to
+        bool inFirst = first && (!second || first->value <= second->value);
+        bool inSecond = second && (!first || second->value <= first->value);
+        int value = inFirst ? first->value : second->value;
+
+        // Skipping the duplicates of value in both lists
+        while(first && first->value == value) {
+            first = first->next;
+        }
+
+        while(second && second->value == value) {
+            second = second->next;
+        }
+
+        if(operation == SET_UNION ||
+           (operation == SET_INTERSECTION && inFirst && inSecond) ||
+           (operation == SET_DIFFERENCE && inFirst && !inSecond)) {
+            *tailPtr = malloc(sizeof(UniNode));
+
+            if(*tailPtr) {
+                (*tailPtr)->value = value;
+                (*tailPtr)->next = NULL;
+                tailPtr = &(*tailPtr)->next;
+            }
+            else {
+                deleteEntireUniList(&root);
+                built = false;
+            }
+        }
+    }
+
+    if(result) {
+        *result = root;
+    }
+
+    return built;
+}
+
+bool getOrderedUniListsUnion(UniNode *first,
+                             UniNode *second,
+                             UniNode **result) {
+    return combineOrderedUniLists(first, second, result, SET_UNION);
+}
+
+bool getOrderedUniListsIntersection(UniNode *first,
+                                    UniNode *second,
+                                    UniNode **result) {
+    return combineOrderedUniLists(first, second, result, SET_INTERSECTION);
+}
+
+bool getOrderedUniListsDifference(UniNode *first,
+                                  UniNode *second,
+                                  UniNode **result) {
+    return combineOrderedUniLists(first, second, result, SET_DIFFERENCE);
+}
+
+// Task 12: Positional Operations
+bool addUniNodeAfter(UniNode *node, int value) {
+    bool added = false;
+    UniNode *newItemPtr;
+
+    if(node) {
+        newItemPtr = malloc(sizeof(UniNode));
+
+        if(newItemPtr) {
+            newItemPtr->value = value;
+            newItemPtr->next = node->next;
+            node->next = newItemPtr;
+            added = true;
+        }
+    }
+
+    return added;
+}
+
+bool deleteUniNodeAfter(UniNode *node) {
+    bool deleted = false;
+    UniNode *itemPtr;
+
+    if(node && node->next) {
+        itemPtr = node->next;
+        node->next = itemPtr->next;
+        free(itemPtr);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+// Task 13: Self-Organizing Search
+UniNode *findUniNodeMovingToFront(UniNode **root, int value) {
+    UniNode *itemPtr = NULL, **linkPtr = root;
+
+    if(root) {
+        while(*linkPtr && (*linkPtr)->value != value) {
+            linkPtr = &(*linkPtr)->next;
+        }
+
+        itemPtr = *linkPtr;
+
+        if(itemPtr && linkPtr != root) {
+            // Unlinking the found node and linking it back at the front
+            *linkPtr = itemPtr->next;
+            itemPtr->next = *root;
+            *root = itemPtr;
+        }
+    }
+
+    return itemPtr;
+}
+
+UniNode *findUniNodeTransposing(UniNode **root, int value) {
+    UniNode *itemPtr = NULL, *prevPtr, **prevLinkPtr = NULL;
+
+    if(root) {
+        // prevLinkPtr is the link pointing to the node before *root
+        while(*root && (*root)->value != value) {
+            prevLinkPtr = root;
+            root = &(*root)->next;
+        }
+
+        itemPtr = *root;
+
+        if(itemPtr && prevLinkPtr) {
+            // Swapping the found node with the node before it
+            prevPtr = *prevLinkPtr;
+            prevPtr->next = itemPtr->next;
+            itemPtr->next = prevPtr;
+            *prevLinkPtr = itemPtr;
+        }
+    }
+
+    return itemPtr;
+}
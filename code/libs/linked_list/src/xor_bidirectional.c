@@ -0,0 +1,907 @@
+/**
+ * @file xor_bidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated with
+ *        XOR-linked bidirectional lists, embracing both unordered and ordered
+ *        versions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_list/common.h"
+#include "linked_list/xor_bidirectional.h"
+
+/**
+ * @brief Retrieves the neighbor of a node that is not the given one.
+ *
+ * @param itemPtr Pointer to the node (not NULL).
+ *
+ * @param neighborPtr Pointer to a neighbor of the node (NULL standing for the
+ *                    missing neighbor of an end node).
+ *
+ * @return Pointer to the other neighbor (NULL if there is none).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *getNeighbor(const XorNode *itemPtr,
+                            const XorNode *neighborPtr) {
+    return (XorNode *) (itemPtr->link ^ (uintptr_t) neighborPtr);
+}
+
+/**
+ * @brief Moves one node forward, i.e. away from the previous node.
+ *
+ * @param prevPtr Pointer to the pointer to the previous node, which is set to
+ *                the current node.
+ *
+ * @param itemPtr Pointer to the current node (not NULL).
+ *
+ * @return Pointer to the next node (NULL if there is none).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *moveForward(XorNode **prevPtr, XorNode *itemPtr) {
+    XorNode *nextPtr = getNeighbor(itemPtr, *prevPtr);
+
+    *prevPtr = itemPtr;
+
+    return nextPtr;
+}
+
+/**
+ * @brief Replaces a neighbor of a node by another one (nothing is done for a
+ *        NULL node).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void replaceNeighbor(XorNode *itemPtr,
+                            const XorNode *oldNeighborPtr,
+                            const XorNode *newNeighborPtr) {
+    if(itemPtr) {
+        itemPtr->link ^= (uintptr_t) oldNeighborPtr ^
+                         (uintptr_t) newNeighborPtr;
+    }
+}
+
+/**
+ * @brief Links a node between two adjacent nodes of a list (prevPtr being NULL
+ *        for adding first and nextPtr being NULL for adding last).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void linkXorNode(XorNode **root,
+                        XorNode *prevPtr,
+                        XorNode *nextPtr,
+                        XorNode *newItemPtr) {
+    newItemPtr->link = (uintptr_t) prevPtr ^ (uintptr_t) nextPtr;
+    replaceNeighbor(prevPtr, nextPtr, newItemPtr);
+    replaceNeighbor(nextPtr, prevPtr, newItemPtr);
+
+    if(!prevPtr) {
+        *root = newItemPtr;
+    }
+}
+
+/**
+ * @brief Allocates a node holding the given value and links it between two
+ *        adjacent nodes of a list (see linkXorNode).
+ *
+ * @return True if the node got added and false otherwise (allocation failure,
+ *         in which case the list is left unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool insertXorNode(XorNode **root,
+                          XorNode *prevPtr,
+                          XorNode *nextPtr,
+                          int value) {
+    XorNode *newItemPtr = malloc(sizeof(XorNode));
+
+    if(newItemPtr) {
+        newItemPtr->value = value;
+        linkXorNode(root, prevPtr, nextPtr, newItemPtr);
+    }
+
+    return newItemPtr != NULL;
+}
+
+/**
+ * @brief Unlinks a node from a list and frees it.
+ *
+ * @param root Pointer to the pointer to the root node of the list, which is
+ *             updated if the first node is deleted.
+ *
+ * @param prevPtr Pointer to the node preceding the one to delete (NULL if it
+ *                is the first node).
+ *
+ * @param itemPtr Pointer to the node to delete (not NULL).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void removeXorNode(XorNode **root, XorNode *prevPtr, XorNode *itemPtr) {
+    XorNode *nextPtr = getNeighbor(itemPtr, prevPtr);
+
+    replaceNeighbor(prevPtr, itemPtr, nextPtr);
+    replaceNeighbor(nextPtr, itemPtr, prevPtr);
+
+    if(!prevPtr) {
+        *root = nextPtr;
+    }
+
+    free(itemPtr);
+}
+
+// Task 1: Data Structure Declaration and Textual Description
+void displayXorList(XorNode *root) {
+    XorNode *prevPtr = NULL;
+
+    printf("\n< ");
+    while(root) {
+        if(getNeighbor(root, prevPtr)) {
+            printf("%d | ", root->value);
+        }
+        else {
+            printf("%d ", root->value);
+        }
+
+        root = moveForward(&prevPtr, root);
+    }
+
+    printf(">\n");
+}
+
+char *xorListToString(XorNode *root) {
+    /**
+     * We use initialize function with string literals to assure we have
+     * malloc-ed strings that can be free-d.
+     */
+    char *str = NULL, *tmp_str, *item = NULL;
+    XorNode *prevPtr = NULL;
+    size_t len;
+
+    if(!root) {
+        str = initialize("< >");
+    }
+    else {
+        tmp_str = initialize("");
+        do {
+            const char *format = getNeighbor(root, prevPtr) ? " %d |" : " %d ";
+
+            len = snprintf(NULL, 0, format, root->value);
+            item = malloc((len + 1) * sizeof(char));
+            sprintf(item, format, root->value);
+
+            str = concatenate(tmp_str, item);
+            freeCharPtrs(2, tmp_str, item);
+            tmp_str = str;
+
+            root = moveForward(&prevPtr, root);
+        } while(root);
+
+        str = concatenate("<", tmp_str);
+        free(tmp_str);
+
+        tmp_str = str;
+        str = concatenate(tmp_str, ">");
+        free(tmp_str);
+    }
+
+    return str;
+}
+
+// Task 2: Creation Operation
+bool addXorNode(XorNode **root, int value) {
+    bool added = false;
+    XorNode *prevPtr = NULL, *itemPtr;
+
+    if(root) {
+        itemPtr = *root;
+
+        // Moving forward until passing the last node
+        while(itemPtr) {
+            itemPtr = moveForward(&prevPtr, itemPtr);
+        }
+
+        added = insertXorNode(root, prevPtr, NULL, value);
+    }
+
+    return added;
+}
+
+/**
+ * @brief Adds a node holding the given value at the end of the list, the
+ *        current node being itemPtr (NULL once past the last node).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addXorNodeAfter(XorNode **root,
+                            XorNode *prevPtr,
+                            XorNode *itemPtr,
+                            int value) {
+    bool added;
+
+    if(itemPtr) {
+        added = addXorNodeAfter(root,
+                                itemPtr,
+                                getNeighbor(itemPtr, prevPtr),
+                                value);
+    }
+    else {
+        added = insertXorNode(root, prevPtr, NULL, value);
+    }
+
+    return added;
+}
+
+bool addXorNodeRecursively(XorNode **root, int value) {
+    return root && addXorNodeAfter(root, NULL, *root, value);
+}
+
+// Task 3: Read / Find Operations
+XorNode *findXorNode(XorNode *root, int value) {
+    XorNode *prevPtr = NULL;
+
+    while(root && root->value != value) {
+        root = moveForward(&prevPtr, root);
+    }
+
+    return root;
+}
+
+/**
+ * @brief Finds the first node holding the given value, starting from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *findXorNodeAfter(XorNode *prevPtr,
+                                 XorNode *itemPtr,
+                                 int value) {
+    XorNode *foundPtr = NULL;
+
+    if(itemPtr) {
+        if(itemPtr->value == value) {
+            foundPtr = itemPtr;
+        }
+        else {
+            foundPtr = findXorNodeAfter(itemPtr,
+                                        getNeighbor(itemPtr, prevPtr),
+                                        value);
+        }
+    }
+
+    return foundPtr;
+}
+
+XorNode *findXorNodeRecursively(XorNode *root, int value) {
+    return findXorNodeAfter(NULL, root, value);
+}
+
+// Task 4: Update Operation
+bool updateXorNode(XorNode *root, int originalValue, int newValue) {
+    XorNode *itemPtr = findXorNode(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+    }
+
+    return itemPtr != NULL;
+}
+
+bool updateXorNodeRecursively(XorNode *root, int originalValue, int newValue) {
+    XorNode *itemPtr = findXorNodeRecursively(root, originalValue);
+
+    if(itemPtr) {
+        itemPtr->value = newValue;
+    }
+
+    return itemPtr != NULL;
+}
+
+// Task 5: Delete Operation
+bool deleteXorNode(XorNode **root, int value) {
+    bool deleted = false;
+    XorNode *prevPtr = NULL, *itemPtr;
+
+    if(root) {
+        itemPtr = *root;
+
+        while(itemPtr && itemPtr->value != value) {
+            itemPtr = moveForward(&prevPtr, itemPtr);
+        }
+
+        if(itemPtr) {
+            removeXorNode(root, prevPtr, itemPtr);
+            deleted = true;
+        }
+    }
+
+    return deleted;
+}
+
+/**
+ * @brief Deletes the first node holding the given value, starting from
+ *        itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool deleteXorNodeAfter(XorNode **root,
+                               XorNode *prevPtr,
+                               XorNode *itemPtr,
+                               int value) {
+    bool deleted = false;
+
+    if(itemPtr) {
+        if(itemPtr->value == value) {
+            removeXorNode(root, prevPtr, itemPtr);
+            deleted = true;
+        }
+        else {
+            deleted = deleteXorNodeAfter(root,
+                                         itemPtr,
+                                         getNeighbor(itemPtr, prevPtr),
+                                         value);
+        }
+    }
+
+    return deleted;
+}
+
+bool deleteXorNodeRecursively(XorNode **root, int value) {
+    return root && deleteXorNodeAfter(root, NULL, *root, value);
+}
+
+// Task 6: Delete Entire List
+void deleteEntireXorList(XorNode **root) {
+    /**
+     * The address of the previous node is kept as an integer, since the node
+     * is freed before its address is used to get the next node.
+     */
+    uintptr_t prevAddress = 0;
+    XorNode *itemPtr;
+
+    if(root) {
+        while(*root) {
+            itemPtr = *root;
+            *root = (XorNode *) (itemPtr->link ^ prevAddress);
+            prevAddress = (uintptr_t) itemPtr;
+            free(itemPtr);
+        }
+    }
+}
+
+/**
+ * @brief Deletes the nodes of a list starting from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void deleteXorNodesAfter(uintptr_t prevAddress, XorNode *itemPtr) {
+    if(itemPtr) {
+        XorNode *nextPtr = (XorNode *) (itemPtr->link ^ prevAddress);
+
+        prevAddress = (uintptr_t) itemPtr;
+        free(itemPtr);
+        deleteXorNodesAfter(prevAddress, nextPtr);
+    }
+}
+
+void deleteEntireXorListRecursively(XorNode **root) {
+    if(root) {
+        deleteXorNodesAfter(0, *root);
+        *root = NULL;
+    }
+}
+
+// Task 7: Getting List Length / XorNodes Count
+size_t getXorNodesCount(XorNode *root) {
+    XorNode *prevPtr = NULL;
+    size_t count = 0;
+
+    while(root) {
+        count += 1;
+        root = moveForward(&prevPtr, root);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Counts the nodes of a list starting from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t countXorNodesAfter(XorNode *prevPtr, XorNode *itemPtr) {
+    size_t count = 0;
+
+    if(itemPtr) {
+        count += 1 + countXorNodesAfter(itemPtr, getNeighbor(itemPtr, prevPtr));
+    }
+
+    return count;
+}
+
+size_t getXorNodesCountRecursively(XorNode *root) {
+    return countXorNodesAfter(NULL, root);
+}
+
+// Task 8: Ordered XOR-Linked List
+bool addOrderedXorNode(XorNode **root, int value) {
+    /**
+     * We assume the current list is ordered and duplicates are allowed. The
+     * new node goes before the existing nodes that are equal to it.
+     */
+    bool added = false;
+    XorNode *prevPtr = NULL, *itemPtr;
+
+    if(root) {
+        itemPtr = *root;
+
+        while(itemPtr && itemPtr->value < value) {
+            itemPtr = moveForward(&prevPtr, itemPtr);
+        }
+
+        added = insertXorNode(root, prevPtr, itemPtr, value);
+    }
+
+    return added;
+}
+
+/**
+ * @brief Adds a node holding the given value in ascending order, starting
+ *        from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addOrderedXorNodeAfter(XorNode **root,
+                                   XorNode *prevPtr,
+                                   XorNode *itemPtr,
+                                   int value) {
+    bool added;
+
+    if(itemPtr && itemPtr->value < value) {
+        added = addOrderedXorNodeAfter(root,
+                                       itemPtr,
+                                       getNeighbor(itemPtr, prevPtr),
+                                       value);
+    }
+    else {
+        added = insertXorNode(root, prevPtr, itemPtr, value);
+    }
+
+    return added;
+}
+
+bool addOrderedXorNodeRecursively(XorNode **root, int value) {
+    return root && addOrderedXorNodeAfter(root, NULL, *root, value);
+}
+
+XorNode *findOrderedXorNode(XorNode *root, int value) {
+    // We assume ordered list
+    XorNode *prevPtr = NULL;
+
+    while(root && root->value < value) {
+        root = moveForward(&prevPtr, root);
+    }
+
+    return root && root->value == value ? root : NULL;
+}
+
+/**
+ * @brief Finds the first node holding the given value in an ordered list,
+ *        starting from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *findOrderedXorNodeAfter(XorNode *prevPtr,
+                                        XorNode *itemPtr,
+                                        int value) {
+    XorNode *foundPtr = NULL;
+
+    if(itemPtr) {
+        if(itemPtr->value == value) {
+            foundPtr = itemPtr;
+        }
+        else if(itemPtr->value < value) {
+            foundPtr = findOrderedXorNodeAfter(itemPtr,
+                                               getNeighbor(itemPtr, prevPtr),
+                                               value);
+        }
+        // Else it does not exist as the next values are greater than value
+    }
+
+    return foundPtr;
+}
+
+XorNode *findOrderedXorNodeRecursively(XorNode *root, int value) {
+    return findOrderedXorNodeAfter(NULL, root, value);
+}
+
+bool deleteOrderedXorNode(XorNode **root, int value) {
+    // We assume ordered list
+    bool deleted = false;
+    XorNode *prevPtr = NULL, *itemPtr;
+
+    if(root) {
+        itemPtr = *root;
+
+        while(itemPtr && itemPtr->value < value) {
+            itemPtr = moveForward(&prevPtr, itemPtr);
+        }
+
+        if(itemPtr && itemPtr->value == value) {
+            removeXorNode(root, prevPtr, itemPtr);
+            deleted = true;
+        }
+    }
+
+    return deleted;
+}
+
+/**
+ * @brief Deletes the first node holding the given value from an ordered list,
+ *        starting from itemPtr.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool deleteOrderedXorNodeAfter(XorNode **root,
+                                      XorNode *prevPtr,
+                                      XorNode *itemPtr,
+                                      int value) {
+    bool deleted = false;
+
+    if(itemPtr) {
+        if(itemPtr->value == value) {
+            removeXorNode(root, prevPtr, itemPtr);
+            deleted = true;
+        }
+        else if(itemPtr->value < value) {
+            deleted = deleteOrderedXorNodeAfter(root,
+                                                itemPtr,
+                                                getNeighbor(itemPtr, prevPtr),
+                                                value);
+        }
+    }
+
+    return deleted;
+}
+
+bool deleteOrderedXorNodeRecursively(XorNode **root, int value) {
+    return root && deleteOrderedXorNodeAfter(root, NULL, *root, value);
+}
+
+// Task 9: Sorting
+/**
+ * REMARK:
+ *
+ * While sorting, the link field of every node holds the plain address of its
+ * next node (a singly linked list), which is what the merges relink. The XOR
+ * links are restored once all nodes are in place.
+ */
+
+/**
+ * @brief Turns the XOR links of a list into plain next addresses.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void setPlainLinks(XorNode *root) {
+    XorNode *prevPtr = NULL;
+
+    while(root) {
+        XorNode *nextPtr = getNeighbor(root, prevPtr);
+
+        root->link = (uintptr_t) nextPtr;
+        prevPtr = root;
+        root = nextPtr;
+    }
+}
+
+/**
+ * @brief Turns the plain next addresses of a list into XOR links.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void setXorLinks(XorNode *root) {
+    XorNode *prevPtr = NULL;
+
+    while(root) {
+        XorNode *nextPtr = (XorNode *) root->link;
+
+        root->link = (uintptr_t) prevPtr ^ (uintptr_t) nextPtr;
+        prevPtr = root;
+        root = nextPtr;
+    }
+}
+
+/**
+ * @brief Merges two plainly linked ordered lists. Equal values of left come
+ *        first, which keeps the sort stable.
+ *
+ * @return The first node of the merged list.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *mergePlainLists(XorNode *left, XorNode *right) {
+    uintptr_t head = 0, *tailPtr = &head;
+
+    while(left && right) {
+        XorNode **smallestPtr = left->value <= right->value ? &left : &right;
+
+        *tailPtr = (uintptr_t) *smallestPtr;
+        tailPtr = &(*smallestPtr)->link;
+        *smallestPtr = (XorNode *) (*smallestPtr)->link;
+    }
+
+    *tailPtr = (uintptr_t) (left ? left : right);
+
+    return (XorNode *) head;
+}
+
+/**
+ * @brief Sorts a plainly linked list using the bottom-up merge sort of
+ *        sortBiList (runs[i] being either empty or a sorted run of 2^i nodes).
+ *
+ * @return The first node of the sorted list.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static XorNode *sortPlainList(XorNode *itemPtr) {
+    XorNode *runs[64] = {NULL}, *root = NULL;
+    size_t numRuns = 0, i;
+
+    while(itemPtr) {
+        XorNode *run = itemPtr;
+        itemPtr = (XorNode *) itemPtr->link;
+        run->link = 0;
+
+        // runs[i] holds older nodes, so it goes first (stable sort)
+        for(i = 0; i < numRuns && runs[i]; ++i) {
+            run = mergePlainLists(runs[i], run);
+            runs[i] = NULL;
+        }
+
+        runs[i] = run;
+
+        if(i == numRuns) {
+            numRuns += 1;
+        }
+    }
+
+    // Merging the remaining runs, from the most recent to the oldest
+    for(i = 0; i < numRuns; ++i) {
+        if(runs[i]) {
+            root = mergePlainLists(runs[i], root);
+        }
+    }
+
+    return root;
+}
+
+void sortXorList(XorNode **root) {
+    if(root && *root) {
+        setPlainLinks(*root);
+        *root = sortPlainList(*root);
+        setXorLinks(*root);
+    }
+}
+
+// Task 10: Bulk Operations
+bool addOrderedXorNodes(XorNode **root,
+                        const int *values,
+                        size_t count,
+                        bool areSorted) {
+    bool added = root && (values || count == 0);
+    uintptr_t batchHead = 0, *batchTailPtr = &batchHead;
+
+    /**
+     * Allocating all the new nodes first (in the given order), plainly linked
+     * as no node of the batch is walked backward.
+     */
+    for(size_t i = 0; added && i < count; ++i) {
+        XorNode *newItemPtr = malloc(sizeof(XorNode));
+
+        if(newItemPtr) {
+            newItemPtr->value = values[i];
+            newItemPtr->link = 0;
+            *batchTailPtr = (uintptr_t) newItemPtr;
+            batchTailPtr = &newItemPtr->link;
+        }
+        else {
+            while(batchHead) {
+                XorNode *itemPtr = (XorNode *) batchHead;
+                batchHead = itemPtr->link;
+                free(itemPtr);
+            }
+
+            added = false;
+        }
+    }
+
+    if(added) {
+        XorNode *batch = (XorNode *) batchHead;
+
+        if(!areSorted) {
+            batch = sortPlainList(batch);
+        }
+
+        /**
+         * Merging the batch into the list in one pass: the scan for the next
+         * new node resumes right after the previous one. As in
+         * addOrderedXorNode, a new node goes before the existing nodes that
+         * are equal to it.
+         */
+        XorNode *prevPtr = NULL, *itemPtr = *root;
+
+        while(batch) {
+            while(itemPtr && itemPtr->value < batch->value) {
+                itemPtr = moveForward(&prevPtr, itemPtr);
+            }
+
+            XorNode *newItemPtr = batch;
+            batch = (XorNode *) batch->link;
+
+            linkXorNode(root, prevPtr, itemPtr, newItemPtr);
+            prevPtr = newItemPtr;
+        }
+    }
+
+    return added;
+}
+
+size_t findOrderedXorNodes(XorNode *root,
+                           const int *keys,
+                           size_t count,
+                           XorNode **nodes) {
+    size_t numFound = 0;
+    XorNode *prevPtr = NULL, *itemPtr = root;
+
+    for(size_t i = 0; keys && i < count; ++i) {
+        if(i > 0 && keys[i] < keys[i - 1]) {
+            // Unsorted keys: the key may be behind, so the scan restarts
+            prevPtr = NULL;
+            itemPtr = root;
+        }
+
+        while(itemPtr && itemPtr->value < keys[i]) {
+            itemPtr = moveForward(&prevPtr, itemPtr);
+        }
+
+        // The scan does not go past a found node, as the next key may be equal
+        XorNode *foundPtr = itemPtr && itemPtr->value == keys[i] ? itemPtr
+                                                                 : NULL;
+
+        if(nodes) {
+            nodes[i] = foundPtr;
+        }
+
+        if(foundPtr) {
+            numFound += 1;
+        }
+    }
+
+    return numFound;
+}
+
+// Task 11: Set Operations
+/**
+ * @brief The set operations combining two ordered lists.
+ */
+typedef enum SetOperation {
+    SET_UNION,
+    SET_INTERSECTION,
+    SET_DIFFERENCE
+} SetOperation;
+
+/**
+ * @brief Builds a new ordered list out of two ordered ones, according to the
+ *        given set operation, in a single O(n + m) pass.
+ *
+ * @param first A pointer to the root node of the first ordered list.
+ *
+ * @param second A pointer to the root node of the second ordered list.
+ *
+ * @param result A pointer to where the root node of the new list is stored.
+ *
+ * @param operation The set operation to perform.
+ *
+ * @return True if the new list is built and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool combineOrderedXorLists(XorNode *first,
+                                   XorNode *second,
+                                   XorNode **result,
+                                   SetOperation operation) {
+    bool built = result != NULL;
+    XorNode *root = NULL, *lastPtr = NULL;
+    XorNode *firstPrevPtr = NULL, *secondPrevPtr = NULL;
+
+    /**
+     * The loop stops as soon as no more values can make it to the result: for
+     * an intersection, when one of the lists is exhausted, and for a
+     * difference, when the first list is exhausted.
+     */
+    while(built &&
+          (operation == SET_UNION ? first || second :
+           operation == SET_INTERSECTION ? first && second : first != NULL)) {
+        // The smallest value not handled yet and the lists it belongs to
+        bool inFirst = first && (!second || first->value <= second->value);
+        bool inSecond = second && (!first || second->value <= first->value);
+        int value = inFirst ? first->value : second->value;
+
+        // Skipping the duplicates of value in both lists
+        while(first && first->value == value) {
+            first = moveForward(&firstPrevPtr, first);
+        }
+
+        while(second && second->value == value) {
+            second = moveForward(&secondPrevPtr, second);
+        }
+
+        if(operation == SET_UNION ||
+           (operation == SET_INTERSECTION && inFirst && inSecond) ||
+           (operation == SET_DIFFERENCE && inFirst && !inSecond)) {
+            XorNode *newItemPtr = malloc(sizeof(XorNode));
+
+            if(newItemPtr) {
+                newItemPtr->value = value;
+                linkXorNode(&root, lastPtr, NULL, newItemPtr);
+                lastPtr = newItemPtr;
+            }
+            else {
+                deleteEntireXorList(&root);
+                built = false;
+            }
+        }
+    }
+
+    if(result) {
+        *result = root;
+    }
+
+    return built;
+}
+
+bool getOrderedXorListsUnion(XorNode *first,
+                             XorNode *second,
+                             XorNode **result) {
+    return combineOrderedXorLists(first, second, result, SET_UNION);
+}
+
+bool getOrderedXorListsIntersection(XorNode *first,
+                                    XorNode *second,
+                                    XorNode **result) {
+    return combineOrderedXorLists(first, second, result, SET_INTERSECTION);
+}
+
+bool getOrderedXorListsDifference(XorNode *first,
+                                  XorNode *second,
+                                  XorNode **result) {
+    return combineOrderedXorLists(first, second, result, SET_DIFFERENCE);
+}
+
+// Task 12: Traversal From Either End
+XorNode *getXorListOtherEnd(XorNode *root) {
+    XorNode *prevPtr = NULL;
+
+    while(root) {
+        root = moveForward(&prevPtr, root);
+    }
+
+    return prevPtr;
+}
+
+bool traverseXorList(XorNode *root,
+                     bool (*visit)(int value, void *context),
+                     void *context) {
+    XorNode *prevPtr = NULL;
+    bool goOn = true;
+
+    while(goOn && root) {
+        goOn = visit(root->value, context);
+        root = moveForward(&prevPtr, root);
+    }
+
+    return goOn;
+}
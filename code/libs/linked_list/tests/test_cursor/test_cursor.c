@@ -0,0 +1,243 @@
+/**
+ * @file test_cursor.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the positional operations on unidirectional lists in
+ *        "unidirectional.h" and the cursors over bidirectional lists in
+ *        "bidirectional.h".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/unidirectional.h"
+#include "linked_list/bidirectional.h"
+
+/**
+ * @brief Tells if the backward links of a bidirectional list match its
+ *        forward links.
+ *
+ * @param root Pointer to the root node of the bidirectional list.
+ *
+ * @return True if consistent (or if empty) and false otherwise.
+ */
+bool hasConsistentLinks(BiNode *root) {
+    bool consistent = true;
+
+    if(root) {
+        consistent = !root->prev;
+
+        for(BiNode *itemPtr = root; consistent && itemPtr->next;
+            itemPtr = itemPtr->next) {
+            consistent = itemPtr->next->prev == itemPtr;
+        }
+    }
+
+    return consistent;
+}
+
+/**
+ * @brief Creates CursorFunctions test group.
+ */
+TEST_GROUP(CursorFunctions);
+
+/**
+ * @brief Creates CursorFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(CursorFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates CursorFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(CursorFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates CursorFunctions test case: adding and deleting after nodes of
+ *        a unidirectional list.
+ */
+TEST(CursorFunctions, test_uni_positional) {
+    UniNode *uniRoot = NULL;
+    char *str = NULL;
+
+    TEST_ASSERT_FALSE(addUniNodeAfter(NULL, 1));
+    TEST_ASSERT_FALSE(deleteUniNodeAfter(NULL));
+
+    TEST_ASSERT_TRUE(addUniNode(&uniRoot, 1));
+    TEST_ASSERT_FALSE(deleteUniNodeAfter(uniRoot));
+
+    // Doubling every value while traversing
+    TEST_ASSERT_TRUE(addUniNodeAfter(uniRoot, 3));
+    TEST_ASSERT_TRUE(addUniNodeAfter(uniRoot->next, 5));
+
+    for(UniNode *itemPtr = uniRoot; itemPtr; itemPtr = itemPtr->next->next) {
+        TEST_ASSERT_TRUE(addUniNodeAfter(itemPtr, itemPtr->value + 1));
+    }
+
+    str = uniListToString(uniRoot);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 4 | 5 | 6 >", str);
+    free(str);
+
+    // Deleting every other value while traversing
+    for(UniNode *itemPtr = uniRoot; itemPtr; itemPtr = itemPtr->next) {
+        TEST_ASSERT_TRUE(deleteUniNodeAfter(itemPtr));
+    }
+
+    str = uniListToString(uniRoot);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 3 | 5 >", str);
+    free(str);
+
+    // Cleaning up
+    deleteEntireUniList(&uniRoot);
+}
+
+/**
+ * @brief Creates CursorFunctions test case: moving a cursor over a
+ *        bidirectional list.
+ */
+TEST(CursorFunctions, test_bi_cursor_moves) {
+    BiNode *biRoot = NULL;
+    BiCursor cursor;
+
+    TEST_ASSERT_FALSE(initBiCursor(NULL, &biRoot));
+    TEST_ASSERT_FALSE(initBiCursor(&cursor, NULL));
+
+    // Empty list: the cursor is both at the front and past the end
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_NULL(cursor.node);
+    TEST_ASSERT_FALSE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_FALSE(moveBiCursorPrev(&cursor));
+    TEST_ASSERT_FALSE(deleteBiNodeAtCursor(&cursor));
+    TEST_ASSERT_FALSE(addBiNodeAfterCursor(&cursor, 1));
+
+    for(int i = 1; i <= 3; ++i) {
+        TEST_ASSERT_TRUE(addBiNode(&biRoot, i));
+    }
+
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_EQUAL(1, cursor.node->value);
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_EQUAL(3, cursor.node->value);
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_NULL(cursor.node);
+    TEST_ASSERT_FALSE(moveBiCursorNext(&cursor));
+
+    // Moving back from past the end
+    TEST_ASSERT_TRUE(moveBiCursorPrev(&cursor));
+    TEST_ASSERT_EQUAL(3, cursor.node->value);
+    TEST_ASSERT_TRUE(moveBiCursorPrev(&cursor));
+    TEST_ASSERT_TRUE(moveBiCursorPrev(&cursor));
+    TEST_ASSERT_EQUAL(1, cursor.node->value);
+    TEST_ASSERT_FALSE(moveBiCursorPrev(&cursor));
+
+    // Cleaning up
+    deleteEntireBiList(&biRoot);
+}
+
+/**
+ * @brief Creates CursorFunctions test case: editing a bidirectional list
+ *        through a cursor, including at its front and end.
+ */
+TEST(CursorFunctions, test_bi_cursor_edits) {
+    BiNode *biRoot = NULL;
+    BiCursor cursor;
+    char *str = NULL;
+
+    // Building a list through the cursor
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_TRUE(addBiNodeBeforeCursor(&cursor, 2));
+    TEST_ASSERT_TRUE(addBiNodeBeforeCursor(&cursor, 4));
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< 2 | 4 >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    // Adding before the root updates it
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_TRUE(addBiNodeBeforeCursor(&cursor, 1));
+    TEST_ASSERT_EQUAL(2, cursor.node->value);
+    TEST_ASSERT_TRUE(addBiNodeAfterCursor(&cursor, 3));
+    TEST_ASSERT_EQUAL(2, cursor.node->value);
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 4 >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    // Adding after the last node
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_TRUE(addBiNodeAfterCursor(&cursor, 5));
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 4 | 5 >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    // Deleting the even values while traversing
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+
+    while(cursor.node) {
+        if(cursor.node->value % 2 == 0) {
+            TEST_ASSERT_TRUE(deleteBiNodeAtCursor(&cursor));
+        }
+        else {
+            TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+        }
+    }
+
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 3 | 5 >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    // Deleting the root, then the last node
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_TRUE(deleteBiNodeAtCursor(&cursor));
+    TEST_ASSERT_EQUAL(3, cursor.node->value);
+    TEST_ASSERT_TRUE(moveBiCursorNext(&cursor));
+    TEST_ASSERT_TRUE(deleteBiNodeAtCursor(&cursor));
+    TEST_ASSERT_NULL(cursor.node);
+    TEST_ASSERT_FALSE(deleteBiNodeAtCursor(&cursor));
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< 3 >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+    TEST_ASSERT_TRUE(deleteBiNodeAtCursor(&cursor));
+    str = biListToString(biRoot);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+    TEST_ASSERT_TRUE(hasConsistentLinks(biRoot));
+
+    // Cleaning up
+    deleteEntireBiList(&biRoot);
+}
+
+/**
+ * @brief Creates CursorFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(CursorFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(CursorFunctions, test_uni_positional);
+    RUN_TEST_CASE(CursorFunctions, test_bi_cursor_moves);
+    RUN_TEST_CASE(CursorFunctions, test_bi_cursor_edits);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the CursorFunctions group tests
+    RUN_TEST_GROUP(CursorFunctions);
+
+    // End testing
+    return UNITY_END();
+}
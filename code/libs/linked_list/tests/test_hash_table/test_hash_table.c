@@ -0,0 +1,174 @@
+/**
+ * @file test_hash_table.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to chained hash tables in
+ *        "hash_table.h", including while they are being resized.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/hash_table.h"
+
+/**
+ * @brief Creates HashTableFunctions test group.
+ */
+TEST_GROUP(HashTableFunctions);
+
+/**
+ * @brief Creates HashTableFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(HashTableFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates HashTableFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(HashTableFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates HashTableFunctions test case: operations on empty and small
+ *        tables.
+ */
+TEST(HashTableFunctions, test_small_table) {
+    HashTable *table = NULL;
+    char *tableStr = NULL;
+
+    // Empty (NULL) table
+    tableStr = hashTableToString(table);
+    TEST_ASSERT_EQUAL_STRING("< >", tableStr);
+    free(tableStr);
+
+    TEST_ASSERT_EQUAL(0, getHashNodesCount(table));
+    TEST_ASSERT_NULL(findHashNode(table, 1));
+    TEST_ASSERT_FALSE(updateHashNode(table, 1, 2));
+    TEST_ASSERT_FALSE(deleteHashNode(&table, 1));
+    TEST_ASSERT_FALSE(addHashNode(NULL, 1));
+
+    // The table is created upon the first addition
+    TEST_ASSERT_TRUE(addHashNode(&table, 5));
+    TEST_ASSERT_NOT_NULL(table);
+
+    tableStr = hashTableToString(table);
+    TEST_ASSERT_EQUAL_STRING("< 5 >", tableStr);
+    free(tableStr);
+
+    // Duplicates are refused
+    TEST_ASSERT_FALSE(addHashNode(&table, 5));
+    TEST_ASSERT_TRUE(addHashNode(&table, -7));
+    TEST_ASSERT_EQUAL(2, getHashNodesCount(table));
+
+    TEST_ASSERT_EQUAL(5, findHashNode(table, 5)->value);
+    TEST_ASSERT_EQUAL(-7, findHashNode(table, -7)->value);
+    TEST_ASSERT_NULL(findHashNode(table, 7));
+
+    // Updating to an existing value is refused
+    TEST_ASSERT_FALSE(updateHashNode(table, 5, -7));
+    TEST_ASSERT_TRUE(updateHashNode(table, 5, 5));
+    TEST_ASSERT_TRUE(updateHashNode(table, 5, 9));
+    TEST_ASSERT_NULL(findHashNode(table, 5));
+    TEST_ASSERT_EQUAL(9, findHashNode(table, 9)->value);
+    TEST_ASSERT_EQUAL(2, getHashNodesCount(table));
+
+    // The table is freed once empty
+    TEST_ASSERT_TRUE(deleteHashNode(&table, 9));
+    TEST_ASSERT_FALSE(deleteHashNode(&table, 9));
+    TEST_ASSERT_TRUE(deleteHashNode(&table, -7));
+    TEST_ASSERT_NULL(table);
+    TEST_ASSERT_FALSE(deleteHashNode(&table, -7));
+
+    tableStr = hashTableToString(table);
+    TEST_ASSERT_EQUAL_STRING("< >", tableStr);
+    free(tableStr);
+
+    // Cleaning up
+    deleteEntireHashTable(&table);
+    TEST_ASSERT_NULL(table);
+}
+
+/**
+ * @brief Creates HashTableFunctions test case: adding, updating and deleting
+ *        many values while the table is resized several times.
+ */
+TEST(HashTableFunctions, test_resizing) {
+    HashTable *table = NULL;
+    size_t length = 5000, i;
+    bool resized = false;
+
+    /**
+     * The values are 7 * i - 10000, so value + 1 is never one of them and
+     * negative values are covered as well.
+     */
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(addHashNode(&table, 7 * (int) i - 10000));
+        TEST_ASSERT_EQUAL(i + 1, getHashNodesCount(table));
+
+        // Values are found in both old and new buckets during a resize
+        TEST_ASSERT_NOT_NULL(findHashNode(table, -10000));
+        resized = resized || table->oldBuckets;
+    }
+
+    // The table got resized incrementally and kept few values per bucket
+    TEST_ASSERT_TRUE(resized);
+    TEST_ASSERT_TRUE(table->numBuckets >= length / 2);
+
+    for(i = 0; i < length; ++i) {
+        int value = 7 * (int) i - 10000;
+
+        TEST_ASSERT_FALSE(addHashNode(&table, value));
+        TEST_ASSERT_EQUAL(value, findHashNode(table, value)->value);
+        TEST_ASSERT_NULL(findHashNode(table, value + 1));
+    }
+
+    // Moving the values of even indices to value + 1
+    for(i = 0; i < length; i += 2) {
+        int value = 7 * (int) i - 10000;
+
+        TEST_ASSERT_TRUE(updateHashNode(table, value, value + 1));
+        TEST_ASSERT_FALSE(updateHashNode(table, value, value + 1));
+    }
+
+    TEST_ASSERT_EQUAL(length, getHashNodesCount(table));
+
+    for(i = 0; i < length; ++i) {
+        int value = 7 * (int) i - 10000 + (i % 2 == 0);
+
+        TEST_ASSERT_TRUE(deleteHashNode(&table, value));
+        TEST_ASSERT_FALSE(deleteHashNode(&table, value));
+        TEST_ASSERT_EQUAL(length - i - 1, getHashNodesCount(table));
+    }
+
+    TEST_ASSERT_NULL(table);
+
+    // Cleaning up
+    deleteEntireHashTable(&table);
+    TEST_ASSERT_NULL(table);
+}
+
+/**
+ * @brief Creates HashTableFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(HashTableFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(HashTableFunctions, test_small_table);
+    RUN_TEST_CASE(HashTableFunctions, test_resizing);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the HashTableFunctions group tests
+    RUN_TEST_GROUP(HashTableFunctions);
+
+    // End testing
+    return UNITY_END();
+}
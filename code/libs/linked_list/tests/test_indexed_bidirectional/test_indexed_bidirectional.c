@@ -0,0 +1,204 @@
+/**
+ * @file test_indexed_bidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to indexed bidirectional lists in
+ *        "indexed_bidirectional.h", checking them against a plain ordered
+ *        bidirectional list along with the consistency of the index.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/indexed_bidirectional.h"
+
+/**
+ * @brief Tells if an indexed list holds the same values as a plain ordered
+ *        list and if its lanes describe it correctly.
+ *
+ * @param list Pointer to the indexed list.
+ *
+ * @param expectedRoot The first node of the plain ordered list.
+ *
+ * @return True if consistent (or if both are empty) and false otherwise.
+ */
+bool isConsistent(const IndexedBiList *list, const BiNode *expectedRoot) {
+    bool consistent = true;
+    const BiNode *itemPtr = list->root, *expectedPtr = expectedRoot;
+    const BiNode *prevPtr = NULL;
+    size_t index = 0, offset = 0, count = 0;
+
+    while(consistent && itemPtr) {
+        consistent = expectedPtr && expectedPtr->value == itemPtr->value &&
+                     itemPtr->prev == prevPtr && index < list->numLanes;
+
+        if(consistent && offset == 0) {
+            // Every segment starts at its sample and is not too long
+            consistent = list->lanes[index].node == itemPtr &&
+                         list->lanes[index].value == itemPtr->value &&
+                         list->lanes[index].length > 0 &&
+                         list->lanes[index].length < 2 * list->stride;
+        }
+
+        if(consistent) {
+            if(++offset == list->lanes[index].length) {
+                index += 1;
+                offset = 0;
+            }
+
+            prevPtr = itemPtr;
+            itemPtr = itemPtr->next;
+            expectedPtr = expectedPtr->next;
+            count += 1;
+        }
+    }
+
+    if(consistent) {
+        consistent = !expectedPtr && index == list->numLanes && offset == 0 &&
+                     count == getIndexedBiNodesCount(list);
+    }
+
+    return consistent;
+}
+
+/**
+ * @brief Creates IndexedBiListFunctions test group.
+ */
+TEST_GROUP(IndexedBiListFunctions);
+
+/**
+ * @brief Creates IndexedBiListFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(IndexedBiListFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates IndexedBiListFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(IndexedBiListFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates IndexedBiListFunctions test case: initialization from empty
+ *        and existing lists.
+ */
+TEST(IndexedBiListFunctions, test_init) {
+    IndexedBiList list;
+    BiNode *root = NULL, *expectedRoot = NULL;
+
+    TEST_ASSERT_FALSE(initIndexedBiList(NULL, NULL, 4));
+    TEST_ASSERT_FALSE(initIndexedBiList(&list, NULL, 0));
+
+    TEST_ASSERT_TRUE(initIndexedBiList(&list, NULL, 4));
+    TEST_ASSERT_NULL(findIndexedBiNode(&list, 3));
+    TEST_ASSERT_FALSE(deleteIndexedBiNode(&list, 3));
+    TEST_ASSERT_TRUE(isConsistent(&list, expectedRoot));
+    deleteEntireIndexedBiList(&list);
+
+    // The indexed list takes over an existing ordered list
+    for(int i = 0; i < 23; ++i) {
+        TEST_ASSERT_TRUE(addOrderedBiNode(&root, i / 2));
+        TEST_ASSERT_TRUE(addOrderedBiNode(&expectedRoot, i / 2));
+    }
+
+    TEST_ASSERT_TRUE(initIndexedBiList(&list, root, 4));
+    TEST_ASSERT_EQUAL(6, list.numLanes);
+    TEST_ASSERT_TRUE(isConsistent(&list, expectedRoot));
+
+    for(int i = -1; i <= 12; ++i) {
+        TEST_ASSERT_EQUAL_PTR(findOrderedBiNode(list.root, i),
+                              findIndexedBiNode(&list, i));
+    }
+
+    // Cleaning up
+    deleteEntireIndexedBiList(&list);
+    deleteEntireBiList(&expectedRoot);
+}
+
+/**
+ * @brief Creates IndexedBiListFunctions test case: scattered additions and
+ *        deletions with many duplicates, for several strides.
+ */
+TEST(IndexedBiListFunctions, test_add_find_and_delete) {
+    size_t strides[] = {1, 2, 3, 8, 32};
+
+    for(size_t s = 0; s < sizeof(strides) / sizeof(size_t); ++s) {
+        IndexedBiList list;
+        BiNode *expectedRoot = NULL;
+
+        TEST_ASSERT_TRUE(initIndexedBiList(&list, NULL, strides[s]));
+
+        /**
+         * The values (i * 7919) % 200 are scattered with many duplicates.
+         * Two steps out of three add during the first half and one step out
+         * of three does afterwards.
+         */
+        for(int i = 0; i < 3000; ++i) {
+            int value = (i * 7919) % 200;
+
+            if(i % 3 < (i < 1500 ? 2 : 1)) {
+                TEST_ASSERT_TRUE(addIndexedBiNode(&list, value));
+                TEST_ASSERT_TRUE(addOrderedBiNode(&expectedRoot, value));
+            }
+            else {
+                TEST_ASSERT_EQUAL(deleteOrderedBiNode(&expectedRoot, value),
+                                  deleteIndexedBiNode(&list, value));
+            }
+
+            if(i % 50 == 0) {
+                TEST_ASSERT_TRUE(isConsistent(&list, expectedRoot));
+            }
+
+            // The first occurrence is found
+            BiNode *foundPtr = findIndexedBiNode(&list, (i * 37) % 200);
+
+            TEST_ASSERT_TRUE(!foundPtr || !foundPtr->prev ||
+                             foundPtr->prev->value < foundPtr->value);
+        }
+
+        TEST_ASSERT_TRUE(isConsistent(&list, expectedRoot));
+
+        // Deleting everything
+        while(list.root) {
+            int value = list.root->value;
+
+            TEST_ASSERT_TRUE(deleteIndexedBiNode(&list, value));
+            TEST_ASSERT_TRUE(deleteOrderedBiNode(&expectedRoot, value));
+        }
+
+        TEST_ASSERT_TRUE(isConsistent(&list, expectedRoot));
+        TEST_ASSERT_EQUAL(0, list.numLanes);
+
+        // Cleaning up
+        deleteEntireIndexedBiList(&list);
+        deleteEntireBiList(&expectedRoot);
+    }
+}
+
+/**
+ * @brief Creates IndexedBiListFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(IndexedBiListFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(IndexedBiListFunctions, test_init);
+    RUN_TEST_CASE(IndexedBiListFunctions, test_add_find_and_delete);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the IndexedBiListFunctions group tests
+    RUN_TEST_GROUP(IndexedBiListFunctions);
+
+    // End testing
+    return UNITY_END();
+}
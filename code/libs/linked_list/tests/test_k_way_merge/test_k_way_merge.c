@@ -0,0 +1,194 @@
+/**
+ * @file test_k_way_merge.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to merging many ordered lists in
+ *        "k_way_merge.h", checking that the merged lists are ordered, stable
+ *        and made of the very same nodes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/k_way_merge.h"
+
+/**
+ * @brief Creates KWayMergeFunctions test group.
+ */
+TEST_GROUP(KWayMergeFunctions);
+
+/**
+ * @brief Creates KWayMergeFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(KWayMergeFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates KWayMergeFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(KWayMergeFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates KWayMergeFunctions test case: NULL arguments, no lists,
+ *        empty lists and a single list.
+ */
+TEST(KWayMergeFunctions, test_few_lists) {
+    UniNode *uniLists[3] = {NULL, NULL, NULL}, *uniRoot = NULL;
+    BiNode *biLists[3] = {NULL, NULL, NULL}, *biRoot = NULL;
+    char *uniListStr = NULL, *biListStr = NULL;
+
+    // No lists at all
+    mergeOrderedUniLists(NULL, 0, &uniRoot);
+    mergeOrderedBiLists(NULL, 0, &biRoot);
+    TEST_ASSERT_NULL(uniRoot);
+    TEST_ASSERT_NULL(biRoot);
+
+    // Empty lists only
+    mergeOrderedUniLists(uniLists, 3, &uniRoot);
+    mergeOrderedBiLists(biLists, 3, &biRoot);
+    TEST_ASSERT_NULL(uniRoot);
+    TEST_ASSERT_NULL(biRoot);
+
+    // A single list is left as it is
+    for(int value = 1; value <= 3; ++value) {
+        TEST_ASSERT_TRUE(addUniNode(&uniLists[0], value));
+        TEST_ASSERT_TRUE(addBiNode(&biLists[0], value));
+    }
+
+    // Nothing is done for a NULL root or a NULL array of lists
+    mergeOrderedUniLists(uniLists, 1, NULL);
+    mergeOrderedUniLists(NULL, 1, &uniRoot);
+    mergeOrderedBiLists(biLists, 1, NULL);
+    mergeOrderedBiLists(NULL, 1, &biRoot);
+    TEST_ASSERT_NOT_NULL(uniLists[0]);
+    TEST_ASSERT_NULL(uniRoot);
+    TEST_ASSERT_NOT_NULL(biLists[0]);
+    TEST_ASSERT_NULL(biRoot);
+
+    mergeOrderedUniLists(uniLists, 1, &uniRoot);
+    mergeOrderedBiLists(biLists, 1, &biRoot);
+    TEST_ASSERT_NULL(uniLists[0]);
+    TEST_ASSERT_NULL(biLists[0]);
+
+    uniListStr = uniListToString(uniRoot);
+    biListStr = biListToString(biRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 >", uniListStr);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 >", biListStr);
+
+    free(uniListStr);
+    free(biListStr);
+
+    // Cleaning up
+    deleteEntireUniList(&uniRoot);
+    deleteEntireBiList(&biRoot);
+}
+
+/**
+ * @brief Creates KWayMergeFunctions test case: lists of uneven lengths, some
+ *        of them empty, with equal values across lists.
+ */
+TEST(KWayMergeFunctions, test_several_lists) {
+    UniNode *uniLists[5] = {NULL}, *uniRoot = NULL;
+    BiNode *biLists[5] = {NULL}, *biRoot = NULL;
+    char *uniListStr = NULL, *biListStr = NULL;
+
+    // The fourth list stays empty
+    int elements[][4] = {{1, 1, 5, 12},
+                         {2, 4, 6, 8},
+                         {0, 1, 9, 10},
+                         {0, 0, 0, 0},
+                         {1, 7, 11, 13}};
+    size_t lengths[] = {4, 4, 4, 0, 2};
+    size_t numLists = sizeof(lengths) / sizeof(size_t);
+
+    for(size_t l = 0; l < numLists; ++l) {
+        for(size_t i = 0; i < lengths[l]; ++i) {
+            TEST_ASSERT_TRUE(addUniNode(&uniLists[l], elements[l][i]));
+            TEST_ASSERT_TRUE(addBiNode(&biLists[l], elements[l][i]));
+        }
+    }
+
+    /**
+     * The nodes holding 1 are the first and second ones of list 0, then the
+     * second one of list 2 and the first one of list 4. As the merge is
+     * stable, they keep this order.
+     */
+    UniNode *uniOnes[] = {uniLists[0],
+                          uniLists[0]->next,
+                          uniLists[2]->next,
+                          uniLists[4]};
+    BiNode *biOnes[] = {biLists[0],
+                        biLists[0]->next,
+                        biLists[2]->next,
+                        biLists[4]};
+
+    mergeOrderedUniLists(uniLists, numLists, &uniRoot);
+    mergeOrderedBiLists(biLists, numLists, &biRoot);
+
+    for(size_t l = 0; l < numLists; ++l) {
+        TEST_ASSERT_NULL(uniLists[l]);
+        TEST_ASSERT_NULL(biLists[l]);
+    }
+
+    uniListStr = uniListToString(uniRoot);
+    biListStr = biListToString(biRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< 0 | 1 | 1 | 1 | 1 | 2 | 4 | 5 | 6 | 7 | 8 | "
+                             "9 | 10 | 12 >",
+                             uniListStr);
+    TEST_ASSERT_EQUAL_STRING("< 0 | 1 | 1 | 1 | 1 | 2 | 4 | 5 | 6 | 7 | 8 | "
+                             "9 | 10 | 12 >",
+                             biListStr);
+
+    free(uniListStr);
+    free(biListStr);
+
+    TEST_ASSERT_EQUAL_PTR(uniOnes[0], uniRoot->next);
+    TEST_ASSERT_EQUAL_PTR(uniOnes[1], uniRoot->next->next);
+    TEST_ASSERT_EQUAL_PTR(uniOnes[2], uniRoot->next->next->next);
+    TEST_ASSERT_EQUAL_PTR(uniOnes[3], uniRoot->next->next->next->next);
+
+    TEST_ASSERT_EQUAL_PTR(biOnes[0], biRoot->next);
+    TEST_ASSERT_EQUAL_PTR(biOnes[1], biRoot->next->next);
+    TEST_ASSERT_EQUAL_PTR(biOnes[2], biRoot->next->next->next);
+    TEST_ASSERT_EQUAL_PTR(biOnes[3], biRoot->next->next->next->next);
+
+    // The prev pointers are fixed up
+    TEST_ASSERT_NULL(biRoot->prev);
+
+    for(BiNode *itemPtr = biRoot; itemPtr->next; itemPtr = itemPtr->next) {
+        TEST_ASSERT_EQUAL_PTR(itemPtr, itemPtr->next->prev);
+    }
+
+    // Cleaning up
+    deleteEntireUniList(&uniRoot);
+    deleteEntireBiList(&biRoot);
+}
+
+/**
+ * @brief Creates KWayMergeFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(KWayMergeFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(KWayMergeFunctions, test_few_lists);
+    RUN_TEST_CASE(KWayMergeFunctions, test_several_lists);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the KWayMergeFunctions group tests
+    RUN_TEST_GROUP(KWayMergeFunctions);
+
+    // End testing
+    return UNITY_END();
+}
@@ -0,0 +1,236 @@
+/**
+ * @file test_lock_free_unidirectional.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to lock-free ordered unidirectional
+ *        lists in "lock_free_unidirectional.h", first from a single thread and
+ *        then from several threads working on the same list.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/lock_free_unidirectional.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def NUM_THREADS
+ *
+ * @brief The number of threads used by the multi-threaded tests.
+ */
+#define NUM_THREADS 4
+
+/**
+ * @def KEYS_PER_THREAD
+ *
+ * @brief The number of keys added by every thread.
+ */
+#define KEYS_PER_THREAD 500
+
+/**
+ * @brief The list shared by the threads of multi-threaded tests.
+ */
+LockFreeUniList sharedList;
+
+/**
+ * @brief Retrieves the values of a list once no thread uses it, checking that
+ *        no node is left marked.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param values The array storing the values (of size getLockFreeUniNodesCount
+ *               at least).
+ *
+ * @return The number of values or -1 if a marked node is found.
+ */
+int getValues(LockFreeUniList *list, int *values) {
+    int count = 0;
+    uintptr_t link = atomic_load(&list->head.next);
+
+    while(link && count >= 0) {
+        LockFreeUniNode *node = (LockFreeUniNode *) link;
+        link = atomic_load(&node->next);
+
+        if(link & 1) {
+            count = -1;
+        }
+        else {
+            values[count++] = node->value;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief A thread adding its own keys twice (duplicates), checking them,
+ *        deleting one copy of half of them and looking up the keys of the
+ *        other threads on the way.
+ *
+ * @param arg Pointer to the thread index.
+ *
+ * @return NULL if all the operations went as expected and arg otherwise.
+ */
+void *runWorker(void *arg) {
+    int index = *(int *) arg;
+    bool ok = true;
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        // Interleaving the keys of the threads to get them to collide
+        int key = i * NUM_THREADS + index;
+
+        ok = addOrderedLockFreeUniNode(&sharedList, key) && ok;
+        ok = addOrderedLockFreeUniNode(&sharedList, key) && ok;
+
+        // Others' keys may or may not be present, but lookups must not fail
+        findOrderedLockFreeUniNode(&sharedList, key + 1);
+    }
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        int key = i * NUM_THREADS + index;
+
+        ok = findOrderedLockFreeUniNode(&sharedList, key) && ok;
+
+        if(i % 2 == 0) {
+            ok = deleteOrderedLockFreeUniNode(&sharedList, key) && ok;
+            ok = findOrderedLockFreeUniNode(&sharedList, key) && ok;
+            ok = deleteOrderedLockFreeUniNode(&sharedList, key) && ok;
+            ok = !deleteOrderedLockFreeUniNode(&sharedList, key) && ok;
+            ok = !findOrderedLockFreeUniNode(&sharedList, key) && ok;
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return ok ? NULL : arg;
+}
+
+/**
+ * @brief Creates LockFreeUniListFunctions test group.
+ */
+TEST_GROUP(LockFreeUniListFunctions);
+
+/**
+ * @brief Creates LockFreeUniListFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(LockFreeUniListFunctions) {
+    initLockFreeUniList(&sharedList);
+};
+
+/**
+ * @brief Creates LockFreeUniListFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(LockFreeUniListFunctions) {
+    deleteEntireLockFreeUniList(&sharedList);
+    reclaimAllEBRPointers();
+};
+
+/**
+ * @brief Creates LockFreeUniListFunctions test case: single-threaded adding,
+ *        finding and deleting (duplicates included).
+ */
+TEST(LockFreeUniListFunctions, test_single_thread) {
+    char *str = lockFreeUniListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    int values[] = {8, 3, 5, 1, 5};
+
+    for(size_t i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(addOrderedLockFreeUniNode(&sharedList, values[i]));
+    }
+
+    TEST_ASSERT_EQUAL(5, getLockFreeUniNodesCount(&sharedList));
+
+    str = lockFreeUniListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 3 | 5 | 5 | 8 >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(findOrderedLockFreeUniNode(&sharedList, 8));
+    TEST_ASSERT_FALSE(findOrderedLockFreeUniNode(&sharedList, 7));
+    TEST_ASSERT_FALSE(findOrderedLockFreeUniNode(&sharedList, 100));
+
+    // Duplicates are deleted one at a time
+    TEST_ASSERT_TRUE(deleteOrderedLockFreeUniNode(&sharedList, 5));
+    TEST_ASSERT_TRUE(findOrderedLockFreeUniNode(&sharedList, 5));
+    TEST_ASSERT_TRUE(deleteOrderedLockFreeUniNode(&sharedList, 5));
+    TEST_ASSERT_FALSE(deleteOrderedLockFreeUniNode(&sharedList, 5));
+    TEST_ASSERT_FALSE(findOrderedLockFreeUniNode(&sharedList, 5));
+
+    TEST_ASSERT_TRUE(deleteOrderedLockFreeUniNode(&sharedList, 1));
+    TEST_ASSERT_TRUE(deleteOrderedLockFreeUniNode(&sharedList, 8));
+    TEST_ASSERT_EQUAL(1, getLockFreeUniNodesCount(&sharedList));
+
+    str = lockFreeUniListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< 3 >", str);
+    free(str);
+
+    // NULL list
+    TEST_ASSERT_FALSE(addOrderedLockFreeUniNode(NULL, 1));
+    TEST_ASSERT_FALSE(findOrderedLockFreeUniNode(NULL, 1));
+    TEST_ASSERT_FALSE(deleteOrderedLockFreeUniNode(NULL, 1));
+    TEST_ASSERT_EQUAL(0, getLockFreeUniNodesCount(NULL));
+}
+
+/**
+ * @brief Creates LockFreeUniListFunctions test case: several threads add,
+ *        find and delete their own keys on the same list at the same time.
+ */
+TEST(LockFreeUniListFunctions, test_multiple_threads) {
+    pthread_t threads[NUM_THREADS];
+    int indices[NUM_THREADS];
+    static int values[NUM_THREADS * KEYS_PER_THREAD];
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        indices[t] = t;
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[t],
+                                            NULL,
+                                            runWorker,
+                                            &indices[t]));
+    }
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        void *result;
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[t], &result));
+        TEST_ASSERT_EQUAL_PTR(NULL, result);
+    }
+
+    // Both copies of the odd-ranked keys of every thread remain
+    TEST_ASSERT_EQUAL(NUM_THREADS * KEYS_PER_THREAD,
+                      getLockFreeUniNodesCount(&sharedList));
+    TEST_ASSERT_EQUAL(NUM_THREADS * KEYS_PER_THREAD,
+                      getValues(&sharedList, values));
+
+    for(int i = 0; i < NUM_THREADS * KEYS_PER_THREAD; ++i) {
+        int rank = i / (2 * NUM_THREADS) * 2 + 1;
+        TEST_ASSERT_EQUAL(rank * NUM_THREADS + i / 2 % NUM_THREADS, values[i]);
+    }
+}
+
+/**
+ * @brief Creates LockFreeUniListFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(LockFreeUniListFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(LockFreeUniListFunctions, test_single_thread);
+    RUN_TEST_CASE(LockFreeUniListFunctions, test_multiple_threads);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the LockFreeUniListFunctions group tests
+    RUN_TEST_GROUP(LockFreeUniListFunctions);
+
+    // End testing
+    return UNITY_END();
+}
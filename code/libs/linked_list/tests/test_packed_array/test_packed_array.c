@@ -0,0 +1,297 @@
+/**
+ * @file test_packed_array.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to packed memory arrays in
+ *        "packed_array.h", checking the results against the ordered
+ *        unidirectional list of "unidirectional.h".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/packed_array.h"
+#include "linked_list/unidirectional.h"
+
+/**
+ * @brief Tells if the segments of a packed memory array are sorted one after
+ *        the other, none of them being empty (unless single), and if their
+ *        counts add up.
+ *
+ * @param array Pointer to the packed memory array.
+ *
+ * @return True if the array is well laid out and false otherwise.
+ */
+bool isWellLaidOut(PackedArray *array) {
+    bool wellLaidOut = true;
+    size_t count = 0;
+    int previous = -2147483647 - 1;
+
+    for(size_t i = 0; wellLaidOut && i < array->numSegments; ++i) {
+        const int *values = &array->values[i * PACKED_ARRAY_SEGMENT_SIZE];
+
+        wellLaidOut = (array->numSegments == 1 || array->counts[i] > 0) &&
+                      array->counts[i] <= PACKED_ARRAY_SEGMENT_SIZE;
+
+        for(size_t j = 0; wellLaidOut && j < array->counts[i]; ++j) {
+            wellLaidOut = previous <= values[j];
+            previous = values[j];
+        }
+
+        count += array->counts[i];
+    }
+
+    return wellLaidOut && count == array->count;
+}
+
+/**
+ * @brief Creates PackedArrayFunctions test group.
+ */
+TEST_GROUP(PackedArrayFunctions);
+
+/**
+ * @brief Creates PackedArrayFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(PackedArrayFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates PackedArrayFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(PackedArrayFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates PackedArrayFunctions test case: operations on empty and
+ *        small arrays, duplicates included.
+ */
+TEST(PackedArrayFunctions, test_small_array) {
+    PackedArray array;
+    char *arrayStr = NULL;
+
+    TEST_ASSERT_FALSE(initPackedArray(NULL));
+    TEST_ASSERT_FALSE(addOrderedPackedValue(NULL, 1));
+    TEST_ASSERT_FALSE(findOrderedPackedValue(NULL, 1));
+    TEST_ASSERT_FALSE(deleteOrderedPackedValue(NULL, 1));
+    TEST_ASSERT_EQUAL(0, getPackedValuesCount(NULL));
+
+    TEST_ASSERT_TRUE(initPackedArray(&array));
+
+    arrayStr = packedArrayToString(&array);
+    TEST_ASSERT_EQUAL_STRING("< >", arrayStr);
+    free(arrayStr);
+
+    TEST_ASSERT_FALSE(findOrderedPackedValue(&array, 0));
+    TEST_ASSERT_FALSE(deleteOrderedPackedValue(&array, 0));
+
+    TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 5));
+    TEST_ASSERT_TRUE(addOrderedPackedValue(&array, -7));
+    TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 5));
+    TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 0));
+
+    arrayStr = packedArrayToString(&array);
+    TEST_ASSERT_EQUAL_STRING("< -7 | 0 | 5 | 5 >", arrayStr);
+    free(arrayStr);
+
+    TEST_ASSERT_EQUAL(4, getPackedValuesCount(&array));
+
+    TEST_ASSERT_TRUE(findOrderedPackedValue(&array, 5));
+    TEST_ASSERT_TRUE(findOrderedPackedValue(&array, -7));
+    TEST_ASSERT_FALSE(findOrderedPackedValue(&array, 7));
+
+    // Duplicates are deleted one at a time
+    TEST_ASSERT_TRUE(deleteOrderedPackedValue(&array, 5));
+    TEST_ASSERT_TRUE(findOrderedPackedValue(&array, 5));
+    TEST_ASSERT_TRUE(deleteOrderedPackedValue(&array, 5));
+    TEST_ASSERT_FALSE(deleteOrderedPackedValue(&array, 5));
+
+    arrayStr = packedArrayToString(&array);
+    TEST_ASSERT_EQUAL_STRING("< -7 | 0 >", arrayStr);
+    free(arrayStr);
+
+    // A deleted array is reinitialized before being reused
+    deleteEntirePackedArray(&array);
+    TEST_ASSERT_FALSE(addOrderedPackedValue(&array, 1));
+    TEST_ASSERT_TRUE(initPackedArray(&array));
+    TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 1));
+
+    // Cleaning up
+    deleteEntirePackedArray(&array);
+}
+
+/**
+ * @brief Creates PackedArrayFunctions test case: additions and deletions
+ *        give the same values as an ordered unidirectional list.
+ */
+TEST(PackedArrayFunctions, test_against_ordered_list) {
+    PackedArray array;
+    UniNode *root = NULL;
+    int *values = malloc(20000 * sizeof(int));
+
+    TEST_ASSERT_NOT_NULL(values);
+    TEST_ASSERT_TRUE(initPackedArray(&array));
+
+    /**
+     * The values (i * 7919) % 2000 visit [0, 2000) in a scattered order, each
+     * of them several times. The first half only adds values, while the
+     * second one mostly deletes them.
+     */
+    for(int i = 0; i < 20000; ++i) {
+        int value = (i * 7919) % 2000;
+
+        if(i < 10000 || i % 4 == 0) {
+            TEST_ASSERT_TRUE(addOrderedUniNode(&root, value));
+            TEST_ASSERT_TRUE(addOrderedPackedValue(&array, value));
+        }
+        else {
+            TEST_ASSERT_EQUAL(deleteOrderedUniNode(&root, value),
+                              deleteOrderedPackedValue(&array, value));
+        }
+
+        if(i % 1000 == 0) {
+            size_t count = getUniNodesCount(root);
+            size_t index = 0;
+
+            TEST_ASSERT_TRUE(isWellLaidOut(&array));
+            TEST_ASSERT_EQUAL(count, getPackedValuesCount(&array));
+            TEST_ASSERT_EQUAL(count, getOrderedPackedRange(&array,
+                                                           -1,
+                                                           2000,
+                                                           values,
+                                                           20000));
+
+            for(UniNode *node = root; node; node = node->next) {
+                TEST_ASSERT_EQUAL(node->value, values[index++]);
+            }
+
+            for(int v = -1; v <= 2000; ++v) {
+                TEST_ASSERT_EQUAL(findOrderedUniNode(root, v) != NULL,
+                                  findOrderedPackedValue(&array, v));
+            }
+        }
+    }
+
+    // Cleaning up
+    free(values);
+    deleteEntireUniList(&root);
+    deleteEntirePackedArray(&array);
+}
+
+/**
+ * @brief Creates PackedArrayFunctions test case: the array doubles while
+ *        growing and halves back while shrinking.
+ */
+TEST(PackedArrayFunctions, test_resizing) {
+    PackedArray array;
+    char *arrayStr = NULL;
+
+    TEST_ASSERT_TRUE(initPackedArray(&array));
+
+    for(int value = 0; value < 100000; ++value) {
+        TEST_ASSERT_TRUE(addOrderedPackedValue(&array, value));
+    }
+
+    TEST_ASSERT_TRUE(isWellLaidOut(&array));
+    TEST_ASSERT_TRUE(array.numSegments >= 2048);
+
+    for(int value = -1; value <= 100000; ++value) {
+        TEST_ASSERT_EQUAL(value >= 0 && value < 100000,
+                          findOrderedPackedValue(&array, value));
+    }
+
+    for(int value = 100000 - 1; value >= 0; --value) {
+        TEST_ASSERT_TRUE(deleteOrderedPackedValue(&array, value));
+    }
+
+    TEST_ASSERT_TRUE(isWellLaidOut(&array));
+    TEST_ASSERT_EQUAL(1, array.numSegments);
+
+    arrayStr = packedArrayToString(&array);
+    TEST_ASSERT_EQUAL_STRING("< >", arrayStr);
+    free(arrayStr);
+
+    // Cleaning up
+    deleteEntirePackedArray(&array);
+}
+
+/**
+ * @brief Creates PackedArrayFunctions test case: range scans, including
+ *        duplicates spanning over several segments.
+ */
+TEST(PackedArrayFunctions, test_range) {
+    PackedArray array;
+    int values[300];
+
+    TEST_ASSERT_TRUE(initPackedArray(&array));
+    TEST_ASSERT_EQUAL(0, getOrderedPackedRange(&array, 0, 10, values, 300));
+
+    for(int i = 0; i < 200; ++i) {
+        TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 2 * (i % 100)));
+    }
+
+    // Every value is there twice
+    TEST_ASSERT_EQUAL(6, getOrderedPackedRange(&array, 9, 14, values, 300));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]) {10, 10, 12, 12, 14, 14}), values, 6);
+
+    TEST_ASSERT_EQUAL(3, getOrderedPackedRange(&array, 10, 20, values, 3));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]) {10, 10, 12}), values, 3);
+
+    TEST_ASSERT_EQUAL(0, getOrderedPackedRange(&array, 11, 11, values, 300));
+    TEST_ASSERT_EQUAL(0, getOrderedPackedRange(&array, 20, 10, values, 300));
+    TEST_ASSERT_EQUAL(200, getOrderedPackedRange(&array,
+                                                 -2147483647 - 1,
+                                                 2147483647,
+                                                 values,
+                                                 300));
+
+    // Many equal values
+    for(int i = 0; i < 100; ++i) {
+        TEST_ASSERT_TRUE(addOrderedPackedValue(&array, 100));
+    }
+
+    TEST_ASSERT_TRUE(isWellLaidOut(&array));
+    TEST_ASSERT_EQUAL(102, getOrderedPackedRange(&array, 100, 100, values,
+                                                 300));
+
+    for(int i = 0; i < 102; ++i) {
+        TEST_ASSERT_TRUE(deleteOrderedPackedValue(&array, 100));
+    }
+
+    TEST_ASSERT_FALSE(findOrderedPackedValue(&array, 100));
+    TEST_ASSERT_TRUE(findOrderedPackedValue(&array, 98));
+    TEST_ASSERT_TRUE(findOrderedPackedValue(&array, 102));
+    TEST_ASSERT_TRUE(isWellLaidOut(&array));
+
+    // Cleaning up
+    deleteEntirePackedArray(&array);
+}
+
+/**
+ * @brief Creates PackedArrayFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(PackedArrayFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(PackedArrayFunctions, test_small_array);
+    RUN_TEST_CASE(PackedArrayFunctions, test_against_ordered_list);
+    RUN_TEST_CASE(PackedArrayFunctions, test_resizing);
+    RUN_TEST_CASE(PackedArrayFunctions, test_range);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the PackedArrayFunctions group tests
+    RUN_TEST_GROUP(PackedArrayFunctions);
+
+    // End testing
+    return UNITY_END();
+}
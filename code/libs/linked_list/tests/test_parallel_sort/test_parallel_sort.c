@@ -0,0 +1,199 @@
+/**
+ * @file test_parallel_sort.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to parallel sorting in
+ *        "parallel_sort.h", checking that the sorted lists hold the same
+ *        values as ordered lists of the same values for several numbers of
+ *        threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/parallel_sort.h"
+
+/**
+ * @brief Creates ParallelSortFunctions test group.
+ */
+TEST_GROUP(ParallelSortFunctions);
+
+/**
+ * @brief Creates ParallelSortFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(ParallelSortFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates ParallelSortFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(ParallelSortFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates ParallelSortFunctions test case: short lists are sorted
+ *        sequentially whatever the number of threads.
+ */
+TEST(ParallelSortFunctions, test_short_lists) {
+    UniNode *uniRoot = NULL;
+    BiNode *biRoot = NULL;
+    char *uniListStr = NULL, *biListStr = NULL;
+
+    int elements[] = {1, -2, 3, -4, 5, -6, 7, 1, -2, -2};
+    size_t length = sizeof(elements) / sizeof(int);
+
+    // Sorting NULL or empty lists does nothing
+    sortUniListInParallel(NULL, 4);
+    sortBiListInParallel(NULL, 4);
+    sortUniListInParallel(&uniRoot, 4);
+    sortBiListInParallel(&biRoot, 4);
+    TEST_ASSERT_NULL(uniRoot);
+    TEST_ASSERT_NULL(biRoot);
+
+    for(size_t i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(addUniNode(&uniRoot, elements[i]));
+        TEST_ASSERT_TRUE(addBiNode(&biRoot, elements[i]));
+    }
+
+    sortUniListInParallel(&uniRoot, 4);
+    sortBiListInParallel(&biRoot, 4);
+
+    uniListStr = uniListToString(uniRoot);
+    biListStr = biListToString(biRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< -6 | -4 | -2 | -2 | -2 | 1 | 1 | 3 | 5 | 7 >",
+                             uniListStr);
+    TEST_ASSERT_EQUAL_STRING("< -6 | -4 | -2 | -2 | -2 | 1 | 1 | 3 | 5 | 7 >",
+                             biListStr);
+
+    free(uniListStr);
+    free(biListStr);
+
+    // The prev pointers are fixed up
+    TEST_ASSERT_NULL(biRoot->prev);
+
+    for(BiNode *itemPtr = biRoot; itemPtr->next; itemPtr = itemPtr->next) {
+        TEST_ASSERT_EQUAL_PTR(itemPtr, itemPtr->next->prev);
+    }
+
+    // Cleaning up
+    deleteEntireUniList(&uniRoot);
+    deleteEntireBiList(&biRoot);
+}
+
+/**
+ * @brief Creates ParallelSortFunctions test case: long lists give the same
+ *        values as the ordered batch addition for several numbers of threads,
+ *        with uneven segment lengths and with or without many duplicates.
+ */
+TEST(ParallelSortFunctions, test_long_lists) {
+    size_t threadCounts[] = {0, 1, 2, 3, 5, 8};
+    int moduli[] = {50, 1000003};
+    size_t length = 5 * PARALLEL_SORT_MIN_SEGMENT_LENGTH + 123;
+    int *values = malloc(length * sizeof(int));
+
+    TEST_ASSERT_NOT_NULL(values);
+
+    /**
+     * The values (i * 7919) % modulus are scattered: modulus 50 gives many
+     * duplicates while modulus 1000003 gives distinct values.
+     */
+    for(size_t m = 0; m < sizeof(moduli) / sizeof(int); ++m) {
+        for(size_t i = 0; i < length; ++i) {
+            values[i] = (int) ((i * 7919) % moduli[m]);
+        }
+
+        for(size_t t = 0; t < sizeof(threadCounts) / sizeof(size_t); ++t) {
+            UniNode *uniRoot = NULL, *expectedUniRoot = NULL, *uniTail = NULL;
+            BiNode *biRoot = NULL, *expectedBiRoot = NULL;
+            BiCursor cursor;
+
+            // Appending in O(1): after the tail or before the cursor at end
+            TEST_ASSERT_TRUE(initBiCursor(&cursor, &biRoot));
+
+            for(size_t i = 0; i < length; ++i) {
+                if(uniTail) {
+                    TEST_ASSERT_TRUE(addUniNodeAfter(uniTail, values[i]));
+                    uniTail = uniTail->next;
+                }
+                else {
+                    TEST_ASSERT_TRUE(addUniNode(&uniRoot, values[i]));
+                    uniTail = uniRoot;
+                }
+
+                TEST_ASSERT_TRUE(addBiNodeBeforeCursor(&cursor, values[i]));
+            }
+
+            TEST_ASSERT_TRUE(addOrderedUniNodes(&expectedUniRoot,
+                                                values,
+                                                length,
+                                                false));
+            TEST_ASSERT_TRUE(addOrderedBiNodes(&expectedBiRoot,
+                                               values,
+                                               length,
+                                               false));
+
+            sortUniListInParallel(&uniRoot, threadCounts[t]);
+            sortBiListInParallel(&biRoot, threadCounts[t]);
+
+            UniNode *uniPtr = uniRoot, *expectedUniPtr = expectedUniRoot;
+            BiNode *biPtr = biRoot, *expectedBiPtr = expectedBiRoot;
+            BiNode *prevPtr = NULL;
+
+            while(expectedUniPtr) {
+                TEST_ASSERT_NOT_NULL(uniPtr);
+                TEST_ASSERT_NOT_NULL(biPtr);
+                TEST_ASSERT_EQUAL(expectedUniPtr->value, uniPtr->value);
+                TEST_ASSERT_EQUAL(expectedBiPtr->value, biPtr->value);
+
+                // The prev pointers are fixed up
+                TEST_ASSERT_EQUAL_PTR(prevPtr, biPtr->prev);
+
+                prevPtr = biPtr;
+                uniPtr = uniPtr->next;
+                expectedUniPtr = expectedUniPtr->next;
+                biPtr = biPtr->next;
+                expectedBiPtr = expectedBiPtr->next;
+            }
+
+            TEST_ASSERT_NULL(uniPtr);
+            TEST_ASSERT_NULL(biPtr);
+
+            // Cleaning up
+            deleteEntireUniList(&uniRoot);
+            deleteEntireUniList(&expectedUniRoot);
+            deleteEntireBiList(&biRoot);
+            deleteEntireBiList(&expectedBiRoot);
+        }
+    }
+
+    free(values);
+}
+
+/**
+ * @brief Creates ParallelSortFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(ParallelSortFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(ParallelSortFunctions, test_short_lists);
+    RUN_TEST_CASE(ParallelSortFunctions, test_long_lists);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the ParallelSortFunctions group tests
+    RUN_TEST_GROUP(ParallelSortFunctions);
+
+    // End testing
+    return UNITY_END();
+}
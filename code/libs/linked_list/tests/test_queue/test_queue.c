@@ -0,0 +1,344 @@
+/**
+ * @file test_queue.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to lock-free queues in "queue.h",
+ *        first from a single thread and then from several producer and
+ *        consumer threads working on the same queue.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/queue.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def NUM_PRODUCERS
+ *
+ * @brief The number of producer threads of the multi-threaded tests.
+ */
+#define NUM_PRODUCERS 4
+
+/**
+ * @def NUM_CONSUMERS
+ *
+ * @brief The number of consumer threads of the multi-threaded MPMC test.
+ */
+#define NUM_CONSUMERS 2
+
+/**
+ * @def ITEMS_PER_PRODUCER
+ *
+ * @brief The number of values added by every producer.
+ */
+#define ITEMS_PER_PRODUCER 5000
+
+/**
+ * @def TOTAL_ITEMS
+ *
+ * @brief The number of values added by all producers.
+ */
+#define TOTAL_ITEMS (NUM_PRODUCERS * ITEMS_PER_PRODUCER)
+
+// The queues shared by the threads of multi-threaded tests
+MPMCQueue sharedMPMCQueue;
+MPSCQueue sharedMPSCQueue;
+
+// The nodes of the MPSC queue (allocated by the caller as it is intrusive)
+QueueNode mpscNodes[TOTAL_ITEMS];
+
+// The number of times every value got consumed
+atomic_int consumedCounts[TOTAL_ITEMS];
+
+// The number of values consumed by all consumers
+atomic_int numConsumed;
+
+/**
+ * @brief A producer thread adding the values producer + i * NUM_PRODUCERS to
+ *        the MPMC queue, in ascending order.
+ *
+ * @param arg Pointer to the producer index.
+ *
+ * @return NULL if all the values got added and arg otherwise.
+ */
+void *runMPMCProducer(void *arg) {
+    int index = *(int *) arg;
+    bool ok = true;
+
+    for(int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+        ok = enqueueMPMC(&sharedMPMCQueue, index + i * NUM_PRODUCERS) && ok;
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return ok ? NULL : arg;
+}
+
+/**
+ * @brief A consumer thread removing values from the MPMC queue until all of
+ *        them are consumed, checking that the values of every producer come
+ *        in the order they were added.
+ *
+ * @param arg Unused.
+ *
+ * @return NULL if the order is kept and a non-NULL pointer otherwise.
+ */
+void *runMPMCConsumer(void *arg) {
+    int lastValues[NUM_PRODUCERS];
+    bool ok = true;
+
+    for(int p = 0; p < NUM_PRODUCERS; ++p) {
+        lastValues[p] = -1;
+    }
+
+    while(atomic_load(&numConsumed) < TOTAL_ITEMS) {
+        int value;
+
+        if(dequeueMPMC(&sharedMPMCQueue, &value)) {
+            int producer = value % NUM_PRODUCERS;
+
+            ok = value > lastValues[producer] && ok;
+            lastValues[producer] = value;
+
+            atomic_fetch_add(&consumedCounts[value], 1);
+            atomic_fetch_add(&numConsumed, 1);
+        }
+        else {
+            sched_yield();
+        }
+    }
+
+    unregisterEBRThread();
+
+    return ok ? NULL : arg;
+}
+
+/**
+ * @brief A producer thread adding its nodes (holding the values producer +
+ *        i * NUM_PRODUCERS) to the MPSC queue, in ascending order.
+ *
+ * @param arg Pointer to the producer index.
+ *
+ * @return NULL.
+ */
+void *runMPSCProducer(void *arg) {
+    int index = *(int *) arg;
+
+    for(int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+        QueueNode *node = &mpscNodes[index + i * NUM_PRODUCERS];
+
+        node->value = index + i * NUM_PRODUCERS;
+        enqueueMPSC(&sharedMPSCQueue, node);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Creates QueueFunctions test group.
+ */
+TEST_GROUP(QueueFunctions);
+
+/**
+ * @brief Creates QueueFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(QueueFunctions) {
+    TEST_ASSERT_TRUE(initMPMCQueue(&sharedMPMCQueue));
+    initMPSCQueue(&sharedMPSCQueue);
+
+    atomic_store(&numConsumed, 0);
+
+    for(int i = 0; i < TOTAL_ITEMS; ++i) {
+        atomic_store(&consumedCounts[i], 0);
+    }
+};
+
+/**
+ * @brief Creates QueueFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(QueueFunctions) {
+    deleteEntireMPMCQueue(&sharedMPMCQueue);
+    reclaimAllEBRPointers();
+};
+
+/**
+ * @brief Creates QueueFunctions test case: single-threaded MPMC queue usage.
+ */
+TEST(QueueFunctions, test_mpmc_single_thread) {
+    int value;
+
+    TEST_ASSERT_FALSE(dequeueMPMC(&sharedMPMCQueue, &value));
+
+    for(int i = 0; i < 10; ++i) {
+        TEST_ASSERT_TRUE(enqueueMPMC(&sharedMPMCQueue, i));
+    }
+
+    for(int i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(dequeueMPMC(&sharedMPMCQueue, &value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+
+    // Values keep their order when additions and removals interleave
+    TEST_ASSERT_TRUE(enqueueMPMC(&sharedMPMCQueue, 10));
+
+    for(int i = 5; i <= 10; ++i) {
+        TEST_ASSERT_TRUE(dequeueMPMC(&sharedMPMCQueue, &value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+
+    TEST_ASSERT_FALSE(dequeueMPMC(&sharedMPMCQueue, &value));
+
+    // NULL arguments
+    TEST_ASSERT_FALSE(enqueueMPMC(NULL, 1));
+    TEST_ASSERT_FALSE(dequeueMPMC(NULL, &value));
+    TEST_ASSERT_FALSE(dequeueMPMC(&sharedMPMCQueue, NULL));
+}
+
+/**
+ * @brief Creates QueueFunctions test case: single-threaded MPSC queue usage.
+ */
+TEST(QueueFunctions, test_mpsc_single_thread) {
+    QueueNode nodes[3];
+
+    TEST_ASSERT_EQUAL_PTR(NULL, dequeueMPSC(&sharedMPSCQueue));
+
+    for(int i = 0; i < 3; ++i) {
+        nodes[i].value = i;
+        enqueueMPSC(&sharedMPSCQueue, &nodes[i]);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&nodes[0], dequeueMPSC(&sharedMPSCQueue));
+    TEST_ASSERT_EQUAL_PTR(&nodes[1], dequeueMPSC(&sharedMPSCQueue));
+
+    // The dequeued nodes are given back and can be added again
+    enqueueMPSC(&sharedMPSCQueue, &nodes[0]);
+
+    TEST_ASSERT_EQUAL_PTR(&nodes[2], dequeueMPSC(&sharedMPSCQueue));
+    TEST_ASSERT_EQUAL_PTR(&nodes[0], dequeueMPSC(&sharedMPSCQueue));
+    TEST_ASSERT_EQUAL_PTR(NULL, dequeueMPSC(&sharedMPSCQueue));
+
+    // The queue keeps working once emptied
+    enqueueMPSC(&sharedMPSCQueue, &nodes[1]);
+    TEST_ASSERT_EQUAL(1, dequeueMPSC(&sharedMPSCQueue)->value);
+    TEST_ASSERT_EQUAL_PTR(NULL, dequeueMPSC(&sharedMPSCQueue));
+}
+
+/**
+ * @brief Creates QueueFunctions test case: several producers and consumers
+ *        share the MPMC queue, and every value is consumed exactly once.
+ */
+TEST(QueueFunctions, test_mpmc_multiple_threads) {
+    pthread_t producers[NUM_PRODUCERS], consumers[NUM_CONSUMERS];
+    int indices[NUM_PRODUCERS];
+
+    for(int c = 0; c < NUM_CONSUMERS; ++c) {
+        TEST_ASSERT_EQUAL(0, pthread_create(&consumers[c],
+                                            NULL,
+                                            runMPMCConsumer,
+                                            NULL));
+    }
+
+    for(int p = 0; p < NUM_PRODUCERS; ++p) {
+        indices[p] = p;
+        TEST_ASSERT_EQUAL(0, pthread_create(&producers[p],
+                                            NULL,
+                                            runMPMCProducer,
+                                            &indices[p]));
+    }
+
+    for(int p = 0; p < NUM_PRODUCERS; ++p) {
+        void *result;
+        TEST_ASSERT_EQUAL(0, pthread_join(producers[p], &result));
+        TEST_ASSERT_EQUAL_PTR(NULL, result);
+    }
+
+    for(int c = 0; c < NUM_CONSUMERS; ++c) {
+        void *result;
+        TEST_ASSERT_EQUAL(0, pthread_join(consumers[c], &result));
+        TEST_ASSERT_EQUAL_PTR(NULL, result);
+    }
+
+    for(int i = 0; i < TOTAL_ITEMS; ++i) {
+        TEST_ASSERT_EQUAL(1, atomic_load(&consumedCounts[i]));
+    }
+
+    int value;
+    TEST_ASSERT_FALSE(dequeueMPMC(&sharedMPMCQueue, &value));
+}
+
+/**
+ * @brief Creates QueueFunctions test case: several producers share the MPSC
+ *        queue with one consumer, and the values of every producer come in
+ *        order.
+ */
+TEST(QueueFunctions, test_mpsc_multiple_threads) {
+    pthread_t producers[NUM_PRODUCERS];
+    int indices[NUM_PRODUCERS];
+    int lastValues[NUM_PRODUCERS];
+
+    for(int p = 0; p < NUM_PRODUCERS; ++p) {
+        indices[p] = p;
+        lastValues[p] = -1;
+        TEST_ASSERT_EQUAL(0, pthread_create(&producers[p],
+                                            NULL,
+                                            runMPSCProducer,
+                                            &indices[p]));
+    }
+
+    // The test thread is the only consumer
+    for(int consumed = 0; consumed < TOTAL_ITEMS;) {
+        QueueNode *node = dequeueMPSC(&sharedMPSCQueue);
+
+        if(node) {
+            int producer = node->value % NUM_PRODUCERS;
+
+            TEST_ASSERT_EQUAL_PTR(&mpscNodes[node->value], node);
+            TEST_ASSERT_TRUE(node->value > lastValues[producer]);
+            lastValues[producer] = node->value;
+            ++consumed;
+        }
+        else {
+            sched_yield();
+        }
+    }
+
+    for(int p = 0; p < NUM_PRODUCERS; ++p) {
+        TEST_ASSERT_EQUAL(0, pthread_join(producers[p], NULL));
+        TEST_ASSERT_EQUAL(p + (ITEMS_PER_PRODUCER - 1) * NUM_PRODUCERS,
+                          lastValues[p]);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(NULL, dequeueMPSC(&sharedMPSCQueue));
+}
+
+/**
+ * @brief Creates QueueFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(QueueFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(QueueFunctions, test_mpmc_single_thread);
+    RUN_TEST_CASE(QueueFunctions, test_mpsc_single_thread);
+    RUN_TEST_CASE(QueueFunctions, test_mpmc_multiple_threads);
+    RUN_TEST_CASE(QueueFunctions, test_mpsc_multiple_threads);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the QueueFunctions group tests
+    RUN_TEST_GROUP(QueueFunctions);
+
+    // End testing
+    return UNITY_END();
+}
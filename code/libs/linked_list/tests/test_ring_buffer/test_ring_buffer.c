@@ -0,0 +1,182 @@
+/**
+ * @file test_ring_buffer.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to the SPSC ring buffer in
+ *        "ring_buffer.h", first from a single thread and then with a producer
+ *        thread and a consumer thread working on the same buffer.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/ring_buffer.h"
+
+/**
+ * @def NUM_ITEMS
+ *
+ * @brief The number of values passed from the producer to the consumer.
+ */
+#define NUM_ITEMS 200000
+
+// The buffer shared by the producer and the consumer
+RingBuffer sharedBuffer;
+
+/**
+ * @brief A producer thread adding the values 0 to NUM_ITEMS - 1 in order,
+ *        waiting whenever the buffer is full.
+ *
+ * @param arg Unused.
+ *
+ * @return NULL.
+ */
+void *runProducer(void *arg) {
+    for(int i = 0; i < NUM_ITEMS; ++i) {
+        while(!addRingBufferValue(&sharedBuffer, i)) {
+            sched_yield();
+        }
+    }
+
+    return arg;
+}
+
+/**
+ * @brief Creates RingBufferFunctions test group.
+ */
+TEST_GROUP(RingBufferFunctions);
+
+/**
+ * @brief Creates RingBufferFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(RingBufferFunctions) {
+    // A small capacity makes the threaded test hit a full buffer often
+    TEST_ASSERT_TRUE(initRingBuffer(&sharedBuffer, 6));
+};
+
+/**
+ * @brief Creates RingBufferFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(RingBufferFunctions) {
+    deleteEntireRingBuffer(&sharedBuffer);
+};
+
+/**
+ * @brief Creates RingBufferFunctions test case: single-threaded usage, where
+ *        the indices wrap around the slots several times.
+ */
+TEST(RingBufferFunctions, test_single_thread) {
+    char *str = NULL;
+    int value;
+
+    // The capacity is rounded up to a power of two
+    TEST_ASSERT_EQUAL(8, sharedBuffer.capacity);
+
+    str = ringBufferToString(&sharedBuffer);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    TEST_ASSERT_FALSE(deleteRingBufferValue(&sharedBuffer, &value));
+    TEST_ASSERT_FALSE(findRingBufferValue(&sharedBuffer, 0));
+
+    for(int round = 0; round < 3; ++round) {
+        for(int i = 0; i < 8; ++i) {
+            TEST_ASSERT_TRUE(addRingBufferValue(&sharedBuffer, round + i));
+        }
+
+        // Full buffer
+        TEST_ASSERT_FALSE(addRingBufferValue(&sharedBuffer, -1));
+        TEST_ASSERT_EQUAL(8, getRingBufferCount(&sharedBuffer));
+        TEST_ASSERT_TRUE(findRingBufferValue(&sharedBuffer, round + 7));
+        TEST_ASSERT_FALSE(findRingBufferValue(&sharedBuffer, -1));
+
+        for(int i = 0; i < 5; ++i) {
+            TEST_ASSERT_TRUE(deleteRingBufferValue(&sharedBuffer, &value));
+            TEST_ASSERT_EQUAL(round + i, value);
+        }
+
+        // Deleted values are no longer found
+        TEST_ASSERT_FALSE(findRingBufferValue(&sharedBuffer, round));
+
+        for(int i = 5; i < 8; ++i) {
+            TEST_ASSERT_TRUE(deleteRingBufferValue(&sharedBuffer, &value));
+            TEST_ASSERT_EQUAL(round + i, value);
+        }
+
+        TEST_ASSERT_FALSE(deleteRingBufferValue(&sharedBuffer, &value));
+        TEST_ASSERT_EQUAL(0, getRingBufferCount(&sharedBuffer));
+
+        // Shifting the front so the next round wraps around the last slot
+        TEST_ASSERT_TRUE(addRingBufferValue(&sharedBuffer, 0));
+        TEST_ASSERT_TRUE(deleteRingBufferValue(&sharedBuffer, &value));
+    }
+
+    TEST_ASSERT_TRUE(addRingBufferValue(&sharedBuffer, 1));
+    TEST_ASSERT_TRUE(addRingBufferValue(&sharedBuffer, -2));
+
+    str = ringBufferToString(&sharedBuffer);
+    TEST_ASSERT_EQUAL_STRING("< 1 | -2 >", str);
+    free(str);
+
+    // Invalid arguments
+    RingBuffer buffer;
+    TEST_ASSERT_FALSE(initRingBuffer(&buffer, 0));
+    TEST_ASSERT_FALSE(initRingBuffer(NULL, 4));
+    TEST_ASSERT_FALSE(addRingBufferValue(NULL, 1));
+    TEST_ASSERT_FALSE(deleteRingBufferValue(&sharedBuffer, NULL));
+}
+
+/**
+ * @brief Creates RingBufferFunctions test case: a producer thread and a
+ *        consumer thread (the test thread) share the buffer, and every value
+ *        is received once and in order.
+ */
+TEST(RingBufferFunctions, test_producer_consumer) {
+    pthread_t producer;
+    void *result = NULL;
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, runProducer, NULL));
+
+    for(int expected = 0; expected < NUM_ITEMS;) {
+        int value;
+
+        if(deleteRingBufferValue(&sharedBuffer, &value)) {
+            TEST_ASSERT_EQUAL(expected, value);
+            ++expected;
+        }
+        else {
+            sched_yield();
+        }
+    }
+
+    TEST_ASSERT_EQUAL(0, pthread_join(producer, &result));
+    TEST_ASSERT_EQUAL_PTR(NULL, result);
+    TEST_ASSERT_EQUAL(0, getRingBufferCount(&sharedBuffer));
+}
+
+/**
+ * @brief Creates RingBufferFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(RingBufferFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(RingBufferFunctions, test_single_thread);
+    RUN_TEST_CASE(RingBufferFunctions, test_producer_consumer);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the RingBufferFunctions group tests
+    RUN_TEST_GROUP(RingBufferFunctions);
+
+    // End testing
+    return UNITY_END();
+}
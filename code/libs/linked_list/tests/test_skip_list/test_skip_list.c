@@ -0,0 +1,279 @@
+/**
+ * @file test_skip_list.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to lock-free skip lists in
+ *        "skip_list.h", first from a single thread and then from several
+ *        threads working on the same list.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/skip_list.h"
+#include "reclamation/ebr.h"
+
+/**
+ * @def NUM_THREADS
+ *
+ * @brief The number of threads used by the multi-threaded tests.
+ */
+#define NUM_THREADS 4
+
+/**
+ * @def KEYS_PER_THREAD
+ *
+ * @brief The number of keys added by every thread.
+ */
+#define KEYS_PER_THREAD 2000
+
+/**
+ * @brief The list shared by the threads of multi-threaded tests.
+ */
+SkipList sharedList;
+
+/**
+ * @brief Tells if a skip list is well-formed once no thread uses it: every
+ *        level is strictly ascending without marked nodes, and every node of
+ *        an upper level belongs to the level below.
+ *
+ * @param list Pointer to the list.
+ *
+ * @param[out] levelCounts The array storing the number of nodes per level.
+ *
+ * @return True if the list is well-formed and false otherwise.
+ */
+bool isValidList(SkipList *list, size_t *levelCounts) {
+    bool valid = true;
+
+    for(int level = 0; level < SKIP_LIST_MAX_LEVEL; ++level) {
+        uintptr_t link = atomic_load(&list->head->next[level]);
+        SkipNode *below = (SkipNode *) atomic_load(&list->head->next[0]);
+        levelCounts[level] = 0;
+
+        while(link && valid) {
+            SkipNode *node = (SkipNode *) link;
+            link = atomic_load(&node->next[level]);
+
+            // The node must be found at level 0 (scanning forward only)
+            while(below && below != node) {
+                below = (SkipNode *) atomic_load(&below->next[0]);
+            }
+
+            valid = !(link & 1) &&
+                    below == node &&
+                    node->numLevels > level &&
+                    (!link || ((SkipNode *) link)->value > node->value);
+            ++levelCounts[level];
+        }
+    }
+
+    return valid && levelCounts[0] == getSkipNodesCount(list);
+}
+
+/**
+ * @brief A thread adding its own keys, checking them, deleting half of them
+ *        and looking up the keys of the other threads on the way.
+ *
+ * @param arg Pointer to the thread index.
+ *
+ * @return NULL if all the operations went as expected and arg otherwise.
+ */
+void *runWorker(void *arg) {
+    int index = *(int *) arg;
+    bool ok = true;
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        // Interleaving the keys of the threads to get them to collide
+        int key = i * NUM_THREADS + index;
+
+        ok = addSkipNode(&sharedList, key) && ok;
+        ok = !addSkipNode(&sharedList, key) && ok;
+
+        // Others' keys may or may not be present, but lookups must not fail
+        findSkipNode(&sharedList, key + 1);
+    }
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        int key = i * NUM_THREADS + index;
+
+        ok = findSkipNode(&sharedList, key) && ok;
+
+        if(i % 2 == 0) {
+            ok = deleteSkipNode(&sharedList, key) && ok;
+            ok = !deleteSkipNode(&sharedList, key) && ok;
+            ok = !findSkipNode(&sharedList, key) && ok;
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return ok ? NULL : arg;
+}
+
+/**
+ * @brief Creates SkipListFunctions test group.
+ */
+TEST_GROUP(SkipListFunctions);
+
+/**
+ * @brief Creates SkipListFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(SkipListFunctions) {
+    TEST_ASSERT_TRUE(initSkipList(&sharedList));
+};
+
+/**
+ * @brief Creates SkipListFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(SkipListFunctions) {
+    deleteEntireSkipList(&sharedList);
+    reclaimAllEBRPointers();
+};
+
+/**
+ * @brief Creates SkipListFunctions test case: single-threaded adding, finding
+ *        and deleting.
+ */
+TEST(SkipListFunctions, test_single_thread) {
+    char *str = skipListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    int values[] = {8, 3, 5, 1, 12};
+
+    for(size_t i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(addSkipNode(&sharedList, values[i]));
+    }
+
+    // Duplicates are not allowed
+    TEST_ASSERT_FALSE(addSkipNode(&sharedList, 5));
+    TEST_ASSERT_EQUAL(5, getSkipNodesCount(&sharedList));
+
+    str = skipListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 3 | 5 | 8 | 12 >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(findSkipNode(&sharedList, 8));
+    TEST_ASSERT_FALSE(findSkipNode(&sharedList, 7));
+    TEST_ASSERT_FALSE(findSkipNode(&sharedList, 100));
+
+    TEST_ASSERT_TRUE(deleteSkipNode(&sharedList, 1));
+    TEST_ASSERT_TRUE(deleteSkipNode(&sharedList, 8));
+    TEST_ASSERT_FALSE(deleteSkipNode(&sharedList, 8));
+    TEST_ASSERT_FALSE(findSkipNode(&sharedList, 8));
+    TEST_ASSERT_EQUAL(3, getSkipNodesCount(&sharedList));
+
+    str = skipListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< 3 | 5 | 12 >", str);
+    free(str);
+
+    // A deleted value can be added back
+    TEST_ASSERT_TRUE(addSkipNode(&sharedList, 8));
+
+    str = skipListToString(&sharedList);
+    TEST_ASSERT_EQUAL_STRING("< 3 | 5 | 8 | 12 >", str);
+    free(str);
+
+    // NULL list
+    TEST_ASSERT_FALSE(addSkipNode(NULL, 1));
+    TEST_ASSERT_FALSE(findSkipNode(NULL, 1));
+    TEST_ASSERT_FALSE(deleteSkipNode(NULL, 1));
+    TEST_ASSERT_EQUAL(0, getSkipNodesCount(NULL));
+}
+
+/**
+ * @brief Creates SkipListFunctions test case: the levels are well-formed and
+ *        thin out going up.
+ */
+TEST(SkipListFunctions, test_levels) {
+    const int COUNT = 10000;
+    size_t levelCounts[SKIP_LIST_MAX_LEVEL];
+
+    // Adding in an order that is neither ascending nor descending
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(addSkipNode(&sharedList, (i * 7919) % COUNT));
+    }
+
+    TEST_ASSERT_EQUAL(COUNT, getSkipNodesCount(&sharedList));
+    TEST_ASSERT_TRUE(isValidList(&sharedList, levelCounts));
+
+    // About half of the nodes of a level belong to the next one
+    TEST_ASSERT_TRUE(levelCounts[1] > COUNT / 4 && levelCounts[1] < COUNT * 3 / 4);
+    TEST_ASSERT_TRUE(levelCounts[4] > 0 && levelCounts[4] < levelCounts[1]);
+
+    for(int i = 0; i < COUNT; i += 2) {
+        TEST_ASSERT_TRUE(deleteSkipNode(&sharedList, i));
+    }
+
+    TEST_ASSERT_TRUE(isValidList(&sharedList, levelCounts));
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i % 2 == 1, findSkipNode(&sharedList, i));
+    }
+}
+
+/**
+ * @brief Creates SkipListFunctions test case: several threads add, find and
+ *        delete their own keys on the same list at the same time.
+ */
+TEST(SkipListFunctions, test_multiple_threads) {
+    pthread_t threads[NUM_THREADS];
+    int indices[NUM_THREADS];
+    size_t levelCounts[SKIP_LIST_MAX_LEVEL];
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        indices[t] = t;
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[t],
+                                            NULL,
+                                            runWorker,
+                                            &indices[t]));
+    }
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        void *result;
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[t], &result));
+        TEST_ASSERT_EQUAL_PTR(NULL, result);
+    }
+
+    // Half the keys of every thread remain
+    TEST_ASSERT_EQUAL(NUM_THREADS * KEYS_PER_THREAD / 2,
+                      getSkipNodesCount(&sharedList));
+    TEST_ASSERT_TRUE(isValidList(&sharedList, levelCounts));
+
+    SkipNode *node = (SkipNode *) atomic_load(&sharedList.head->next[0]);
+
+    for(int i = 0; i < NUM_THREADS * KEYS_PER_THREAD / 2; ++i) {
+        // Keys of even rank i * NUM_THREADS + index were deleted
+        int rank = i / NUM_THREADS * 2 + 1;
+        TEST_ASSERT_EQUAL(rank * NUM_THREADS + i % NUM_THREADS, node->value);
+        node = (SkipNode *) atomic_load(&node->next[0]);
+    }
+}
+
+/**
+ * @brief Creates SkipListFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(SkipListFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(SkipListFunctions, test_single_thread);
+    RUN_TEST_CASE(SkipListFunctions, test_levels);
+    RUN_TEST_CASE(SkipListFunctions, test_multiple_threads);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the SkipListFunctions group tests
+    RUN_TEST_GROUP(SkipListFunctions);
+
+    // End testing
+    return UNITY_END();
+}
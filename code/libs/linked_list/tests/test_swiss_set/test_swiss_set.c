@@ -0,0 +1,194 @@
+/**
+ * @file test_swiss_set.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to open-addressing integer sets in
+ *        "swiss_set.h", including while they are rehashed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "linked_list/swiss_set.h"
+
+/**
+ * @brief Creates SwissSetFunctions test group.
+ */
+TEST_GROUP(SwissSetFunctions);
+
+/**
+ * @brief Creates SwissSetFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(SwissSetFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates SwissSetFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(SwissSetFunctions) {
+    // Add any test setup code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates SwissSetFunctions test case: operations on empty and small
+ *        sets.
+ */
+TEST(SwissSetFunctions, test_small_set) {
+    SwissSet set;
+    char *setStr = NULL;
+
+    TEST_ASSERT_FALSE(initSwissSet(NULL));
+    TEST_ASSERT_FALSE(addSwissValue(NULL, 1));
+    TEST_ASSERT_FALSE(findSwissValue(NULL, 1));
+    TEST_ASSERT_FALSE(deleteSwissValue(NULL, 1));
+    TEST_ASSERT_EQUAL(0, getSwissValuesCount(NULL));
+
+    TEST_ASSERT_TRUE(initSwissSet(&set));
+
+    setStr = swissSetToString(&set);
+    TEST_ASSERT_EQUAL_STRING("< >", setStr);
+    free(setStr);
+
+    TEST_ASSERT_FALSE(findSwissValue(&set, 0));
+    TEST_ASSERT_FALSE(deleteSwissValue(&set, 0));
+
+    TEST_ASSERT_TRUE(addSwissValue(&set, 5));
+
+    setStr = swissSetToString(&set);
+    TEST_ASSERT_EQUAL_STRING("< 5 >", setStr);
+    free(setStr);
+
+    // Duplicates are refused
+    TEST_ASSERT_FALSE(addSwissValue(&set, 5));
+    TEST_ASSERT_TRUE(addSwissValue(&set, -7));
+    TEST_ASSERT_TRUE(addSwissValue(&set, 0));
+    TEST_ASSERT_EQUAL(3, getSwissValuesCount(&set));
+
+    TEST_ASSERT_TRUE(findSwissValue(&set, 5));
+    TEST_ASSERT_TRUE(findSwissValue(&set, -7));
+    TEST_ASSERT_TRUE(findSwissValue(&set, 0));
+    TEST_ASSERT_FALSE(findSwissValue(&set, 7));
+
+    TEST_ASSERT_TRUE(deleteSwissValue(&set, 5));
+    TEST_ASSERT_FALSE(deleteSwissValue(&set, 5));
+    TEST_ASSERT_FALSE(findSwissValue(&set, 5));
+    TEST_ASSERT_TRUE(deleteSwissValue(&set, -7));
+    TEST_ASSERT_TRUE(deleteSwissValue(&set, 0));
+
+    setStr = swissSetToString(&set);
+    TEST_ASSERT_EQUAL_STRING("< >", setStr);
+    free(setStr);
+
+    // A deleted set is reinitialized before being reused
+    deleteEntireSwissSet(&set);
+    TEST_ASSERT_FALSE(addSwissValue(&set, 1));
+    TEST_ASSERT_TRUE(initSwissSet(&set));
+    TEST_ASSERT_TRUE(addSwissValue(&set, 1));
+
+    // Cleaning up
+    deleteEntireSwissSet(&set);
+}
+
+/**
+ * @brief Creates SwissSetFunctions test case: growing rehashes while adding,
+ *        then tombstone-clearing ones while deleting and adding back.
+ */
+TEST(SwissSetFunctions, test_rehashing) {
+    SwissSet set;
+    int length = 3000, i, round;
+
+    TEST_ASSERT_TRUE(initSwissSet(&set));
+
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(addSwissValue(&set, i));
+        TEST_ASSERT_EQUAL(i + 1, getSwissValuesCount(&set));
+    }
+
+    TEST_ASSERT_TRUE(set.numGroups > 1);
+
+    /**
+     * Every round deletes a tenth of the values, leaving tombstones, and adds
+     * them back, shifted by length so that they are new values.
+     */
+    for(round = 0; round < 20; ++round) {
+        for(i = round * length / 10; i < (round + 1) * length / 10; ++i) {
+            TEST_ASSERT_TRUE(deleteSwissValue(&set, i));
+            TEST_ASSERT_FALSE(deleteSwissValue(&set, i));
+            TEST_ASSERT_TRUE(addSwissValue(&set, i + length));
+            TEST_ASSERT_EQUAL(length, getSwissValuesCount(&set));
+
+            // The load, tombstones included, stays below 7 / 8
+            TEST_ASSERT_TRUE(8 * (set.count + set.numDeleted) <=
+                             7 * set.numGroups * SWISS_SET_GROUP_SIZE);
+        }
+    }
+
+    // Only the values added by the last rounds are left
+    for(i = -1; i <= 3 * length; ++i) {
+        TEST_ASSERT_EQUAL(i >= 2 * length && i < 3 * length,
+                          findSwissValue(&set, i));
+    }
+
+    // Cleaning up
+    deleteEntireSwissSet(&set);
+}
+
+/**
+ * @brief Creates SwissSetFunctions test case: values sharing low hash bits
+ *        (many collisions) and extreme values.
+ */
+TEST(SwissSetFunctions, test_many_values) {
+    SwissSet set;
+    int extremes[] = {-2147483647 - 1, 2147483647, -1, 0, 1};
+    size_t length = sizeof(extremes) / sizeof(int), i;
+
+    TEST_ASSERT_TRUE(initSwissSet(&set));
+
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(addSwissValue(&set, extremes[i]));
+    }
+
+    for(int v = 0; v < 100000; v += 7) {
+        TEST_ASSERT_EQUAL(v != 0 && v != 1, addSwissValue(&set, v * 64));
+    }
+
+    for(int v = 0; v < 100000; v += 7) {
+        TEST_ASSERT_TRUE(findSwissValue(&set, v * 64));
+        TEST_ASSERT_FALSE(findSwissValue(&set, v * 64 + 1) && v != 0);
+    }
+
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(findSwissValue(&set, extremes[i]));
+        TEST_ASSERT_TRUE(deleteSwissValue(&set, extremes[i]));
+        TEST_ASSERT_FALSE(findSwissValue(&set, extremes[i]));
+    }
+
+    // Cleaning up
+    deleteEntireSwissSet(&set);
+}
+
+/**
+ * @brief Creates SwissSetFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(SwissSetFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(SwissSetFunctions, test_small_set);
+    RUN_TEST_CASE(SwissSetFunctions, test_rehashing);
+    RUN_TEST_CASE(SwissSetFunctions, test_many_values);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the SwissSetFunctions group tests
+    RUN_TEST_GROUP(SwissSetFunctions);
+
+    // End testing
+    return UNITY_END();
+}
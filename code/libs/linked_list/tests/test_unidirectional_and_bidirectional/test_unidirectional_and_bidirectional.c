@@ -4,13 +4,17 @@
  * @author Samah A. SHAYYA
  *
  * @brief This tests the functions related to unordered and ordered linked
- *        lists in "unidirectional.h" and "bidirectional.h". By default, it
- *        tests iterative undidirectional unordered methods. As for ordered,
- *        recursive, and bidirectional lists, a corresponding option should be
- *        passed.
+ *        lists in "unidirectional.h" and "bidirectional.h", as well as their
+ *        circular counterparts in "unicircular.h" and "bicircular.h" and the
+ *        XOR-linked lists of "xor_bidirectional.h". By default, it tests
+ *        iterative undidirectional unordered methods. As for ordered and
+ *        recursive, a corresponding option should be passed, while the other
+ *        list types are selected at compile time (BIDIRECTIONAL, UNICIRCULAR,
+ *        BICIRCULAR or XOR_BIDIRECTIONAL macro).
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /**
@@ -69,6 +73,100 @@
     #define deleteAllRec deleteEntireBiListRecursively
     #define getCountIter getBiNodesCount
     #define getCountRec getBiNodesCountRecursively
+    #define sortList sortBiList
+    #define addOrderedBatch addOrderedBiNodes
+    #define findOrderedBatch findOrderedBiNodes
+    #define listsUnion getOrderedBiListsUnion
+    #define listsIntersection getOrderedBiListsIntersection
+    #define listsDifference getOrderedBiListsDifference
+    #define findOrderedFromFinger findOrderedBiNodeFromFinger
+    #define addOrderedFromFinger addOrderedBiNodeFromFinger
+    #define deleteOrderedFromFinger deleteOrderedBiNodeFromFinger
+#elif defined(UNICIRCULAR)
+    #include "linked_list/unicircular.h"
+
+    typedef UniNode Node;
+
+    #define displayList displayUniCircularList
+    #define listToString uniCircularListToString
+    #define addIter addUniCircularNode
+    #define addOrderedIter addOrderedUniCircularNode
+    #define addRec addUniCircularNodeRecursively
+    #define addOrderedRec addOrderedUniCircularNodeRecursively
+    #define findIter findUniCircularNode
+    #define findOrderedIter findOrderedUniCircularNode
+    #define findRec findUniCircularNodeRecursively
+    #define findOrderedRec findOrderedUniCircularNodeRecursively
+    #define updateIter updateUniCircularNode
+    #define updateRec updateUniCircularNodeRecursively
+    #define deleteIter deleteUniCircularNode
+    #define deleteOrderedIter deleteOrderedUniCircularNode
+    #define deleteRec deleteUniCircularNodeRecursively
+    #define deleteOrderedRec deleteOrderedUniCircularNodeRecursively
+    #define deleteAllIter deleteEntireUniCircularList
+    #define deleteAllRec deleteEntireUniCircularListRecursively
+    #define getCountIter getUniCircularNodesCount
+    #define getCountRec getUniCircularNodesCountRecursively
+    #define sortList sortUniCircularList
+#elif defined(BICIRCULAR)
+    #include "linked_list/bicircular.h"
+
+    typedef BiNode Node;
+
+    #define displayList displayBiCircularList
+    #define listToString biCircularListToString
+    #define addIter addBiCircularNode
+    #define addOrderedIter addOrderedBiCircularNode
+    #define addRec addBiCircularNodeRecursively
+    #define addOrderedRec addOrderedBiCircularNodeRecursively
+    #define findIter findBiCircularNode
+    #define findOrderedIter findOrderedBiCircularNode
+    #define findRec findBiCircularNodeRecursively
+    #define findOrderedRec findOrderedBiCircularNodeRecursively
+    #define updateIter updateBiCircularNode
+    #define updateRec updateBiCircularNodeRecursively
+    #define deleteIter deleteBiCircularNode
+    #define deleteOrderedIter deleteOrderedBiCircularNode
+    #define deleteRec deleteBiCircularNodeRecursively
+    #define deleteOrderedRec deleteOrderedBiCircularNodeRecursively
+    #define deleteAllIter deleteEntireBiCircularList
+    #define deleteAllRec deleteEntireBiCircularListRecursively
+    #define getCountIter getBiCircularNodesCount
+    #define getCountRec getBiCircularNodesCountRecursively
+    #define sortList sortBiCircularList
+#elif defined(XOR_BIDIRECTIONAL)
+    #include "linked_list/xor_bidirectional.h"
+
+    typedef XorNode Node;
+
+    #define displayList displayXorList
+    #define listToString xorListToString
+    #define addIter addXorNode
+    #define addOrderedIter addOrderedXorNode
+    #define addRec addXorNodeRecursively
+    #define addOrderedRec addOrderedXorNodeRecursively
+    #define findIter findXorNode
+    #define findOrderedIter findOrderedXorNode
+    #define findRec findXorNodeRecursively
+    #define findOrderedRec findOrderedXorNodeRecursively
+    #define updateIter updateXorNode
+    #define updateRec updateXorNodeRecursively
+    #define deleteIter deleteXorNode
+    #define deleteOrderedIter deleteOrderedXorNode
+    #define deleteRec deleteXorNodeRecursively
+    #define deleteOrderedRec deleteOrderedXorNodeRecursively
+    #define deleteAllIter deleteEntireXorList
+    #define deleteAllRec deleteEntireXorListRecursively
+    #define getCountIter getXorNodesCount
+    #define getCountRec getXorNodesCountRecursively
+    #define sortList sortXorList
+    #define addOrderedBatch addOrderedXorNodes
+    #define findOrderedBatch findOrderedXorNodes
+    #define listsUnion getOrderedXorListsUnion
+    #define listsIntersection getOrderedXorListsIntersection
+    #define listsDifference getOrderedXorListsDifference
+    #define getOtherEnd getXorListOtherEnd
+    #define traverseList traverseXorList
 #else
     #include "linked_list/unidirectional.h"
 
@@ -94,6 +192,14 @@
     #define deleteAllRec deleteEntireUniListRecursively
     #define getCountIter getUniNodesCount
     #define getCountRec getUniNodesCountRecursively
+    #define sortList sortUniList
+    #define addOrderedBatch addOrderedUniNodes
+    #define findOrderedBatch findOrderedUniNodes
+    #define listsUnion getOrderedUniListsUnion
+    #define listsIntersection getOrderedUniListsIntersection
+    #define listsDifference getOrderedUniListsDifference
+    #define findMovingToFront findUniNodeMovingToFront
+    #define findTransposing findUniNodeTransposing
 #endif
 
 // Global variables that will be set based on main arguments
@@ -162,6 +268,21 @@ void moduleSetUp() {
     }
 }
 
+#ifdef traverseList
+/**
+ * @brief Counts the visited values while they are above the limit pointed to
+ *        by context, stopping the traversal otherwise.
+ */
+bool visitAboveLimit(int value, void *context) {
+    int *limitAndCount = context;
+    bool goOn = value > limitAndCount[0];
+
+    limitAndCount[1] += goOn;
+
+    return goOn;
+}
+#endif
+
 /**
  * @brief Creates CombinedFunctions test group.
  */
@@ -429,6 +550,424 @@ TEST(CombinedFunctions, test_delete_and_count) {
     deleteAll(&deleteListRoot);
 };
 
+/**
+ * @brief Creates CombinedFunctions test case: test_sort.
+ */
+TEST(CombinedFunctions, test_sort) {
+    Node *sortListRoot = NULL;
+    char *sortListStr = NULL;
+
+    // Sorting an empty list does nothing
+    sortList(&sortListRoot);
+    TEST_ASSERT_NULL(sortListRoot);
+
+    int elements[] = {1, -2, 3, -4, 5, -6, 7, 1, -2, -2};
+    size_t length = sizeof(elements) / sizeof(int);
+
+    size_t i = 0;
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(add(&sortListRoot, elements[i]));
+    }
+
+    // Sorting gives the same list as adding in order (whatever add is used)
+    sortList(&sortListRoot);
+    sortListStr = listToString(sortListRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< -6 | -4 | -2 | -2 | -2 | 1 | 1 | 3 | 5 | 7 >",
+                             sortListStr);
+    TEST_ASSERT_EQUAL(length, getCount(sortListRoot));
+
+    // The sorted list can be used as an ordered list
+    TEST_ASSERT_TRUE(findOrderedIter(sortListRoot, 7));
+    TEST_ASSERT_TRUE(addOrderedIter(&sortListRoot, 4));
+    TEST_ASSERT_TRUE(deleteOrderedIter(&sortListRoot, -6));
+
+    sortListStr = listToString(sortListRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< -4 | -2 | -2 | -2 | 1 | 1 | 3 | 4 | 5 | 7 >",
+                             sortListStr);
+
+    deleteAll(&sortListRoot);
+
+    // Reversed input with a length that is not a power of two
+    for(i = 0; i < 1000; ++i) {
+        TEST_ASSERT_TRUE(add(&sortListRoot, ordered ? (int) i : 999 - (int) i));
+    }
+
+    sortList(&sortListRoot);
+    TEST_ASSERT_EQUAL(1000, getCount(sortListRoot));
+
+    for(i = 0; i < 1000; ++i) {
+        TEST_ASSERT_TRUE(deleteOrderedIter(&sortListRoot, (int) i));
+    }
+
+    TEST_ASSERT_NULL(sortListRoot);
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_add_ordered_batch.
+ */
+TEST(CombinedFunctions, test_add_ordered_batch) {
+#ifdef addOrderedBatch
+    Node *batchListRoot = NULL;
+    char *batchListStr = NULL;
+
+    int elements[] = {1, -2, 3, -4, 5, -6, 7, 1, -2, -2};
+    size_t length = sizeof(elements) / sizeof(int);
+
+    size_t i = 0;
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(add(&batchListRoot, elements[i]));
+    }
+
+    // The batch is merged into an ordered list
+    sortList(&batchListRoot);
+
+    int sortedBatch[] = {-8, -2, 0, 2, 2, 7, 9};
+    int unsortedBatch[] = {4, -10, 10, 1};
+
+    TEST_ASSERT_TRUE(addOrderedBatch(&batchListRoot, sortedBatch, 7, true));
+    TEST_ASSERT_TRUE(addOrderedBatch(&batchListRoot, unsortedBatch, 4, false));
+    TEST_ASSERT_TRUE(addOrderedBatch(&batchListRoot, NULL, 0, true));
+    TEST_ASSERT_FALSE(addOrderedBatch(&batchListRoot, NULL, 1, true));
+    TEST_ASSERT_FALSE(addOrderedBatch(NULL, sortedBatch, 7, true));
+
+    batchListStr = listToString(batchListRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< -10 | -8 | -6 | -4 | -2 | -2 | -2 | -2 | 0 | 1 "
+                             "| 1 | 1 | 2 | 2 | 3 | 4 | 5 | 7 | 7 | 9 | 10 >",
+                             batchListStr);
+    TEST_ASSERT_EQUAL(length + 11, getCount(batchListRoot));
+
+    // The list stays usable as an ordered list (prev pointers included)
+    TEST_ASSERT_TRUE(deleteOrderedIter(&batchListRoot, 10));
+    TEST_ASSERT_TRUE(deleteOrderedIter(&batchListRoot, -10));
+    TEST_ASSERT_TRUE(addOrderedIter(&batchListRoot, 8));
+    TEST_ASSERT_TRUE(deleteOrderedIter(&batchListRoot, 9));
+
+    batchListStr = listToString(batchListRoot);
+
+    TEST_ASSERT_EQUAL_STRING("< -8 | -6 | -4 | -2 | -2 | -2 | -2 | 0 | 1 | 1 "
+                             "| 1 | 2 | 2 | 3 | 4 | 5 | 7 | 7 | 8 >",
+                             batchListStr);
+
+    deleteAll(&batchListRoot);
+
+    // Adding a batch to an empty list
+    TEST_ASSERT_TRUE(addOrderedBatch(&batchListRoot, unsortedBatch, 4, false));
+
+    batchListStr = listToString(batchListRoot);
+    TEST_ASSERT_EQUAL_STRING("< -10 | 1 | 4 | 10 >", batchListStr);
+
+    deleteAll(&batchListRoot);
+#else
+    TEST_IGNORE_MESSAGE("Skipping batch test having circular list!");
+#endif
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_find_ordered_batch.
+ */
+TEST(CombinedFunctions, test_find_ordered_batch) {
+#ifdef findOrderedBatch
+    Node *batchListRoot = NULL;
+
+    int elements[] = {1, -2, 3, -4, 5, -6, 7, 1, -2, -2};
+    size_t length = sizeof(elements) / sizeof(int);
+
+    size_t i = 0;
+    for(i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(add(&batchListRoot, elements[i]));
+    }
+
+    // The keys are looked up in an ordered list
+    sortList(&batchListRoot);
+
+    int keys[] = {-10, -6, -2, -2, 0, 1, 4, 7, 8};
+    bool expected[] = {false, true, true, true, false, true, false, true, false};
+    size_t numKeys = sizeof(keys) / sizeof(int);
+    Node *nodes[sizeof(keys) / sizeof(int)];
+
+    TEST_ASSERT_EQUAL(5, findOrderedBatch(batchListRoot, keys, numKeys, nodes));
+
+    for(i = 0; i < numKeys; ++i) {
+        if(expected[i]) {
+            // The found node is the first one holding the key
+            TEST_ASSERT_EQUAL_PTR(findOrderedIter(batchListRoot, keys[i]),
+                                  nodes[i]);
+        }
+        else {
+            TEST_ASSERT_NULL(nodes[i]);
+        }
+    }
+
+    // Counting only, unsorted keys, and empty inputs
+    int unsortedKeys[] = {7, -6, 2, 1, -2};
+
+    TEST_ASSERT_EQUAL(5, findOrderedBatch(batchListRoot, keys, numKeys, NULL));
+    TEST_ASSERT_EQUAL(4, findOrderedBatch(batchListRoot, unsortedKeys, 5, NULL));
+    TEST_ASSERT_EQUAL(0, findOrderedBatch(batchListRoot, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL(0, findOrderedBatch(NULL, keys, numKeys, nodes));
+    TEST_ASSERT_NULL(nodes[1]);
+
+    deleteAll(&batchListRoot);
+#else
+    TEST_IGNORE_MESSAGE("Skipping batch test having circular list!");
+#endif
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_set_operations.
+ */
+TEST(CombinedFunctions, test_set_operations) {
+#ifdef listsUnion
+    Node *firstRoot = NULL, *secondRoot = NULL, *resultRoot = NULL;
+
+    int firstElements[] = {5, 1, -2, 3, 1, 8, -2};
+    int secondElements[] = {3, 9, -2, 4, 3, 0};
+    size_t i = 0;
+
+    for(i = 0; i < sizeof(firstElements) / sizeof(int); ++i) {
+        TEST_ASSERT_TRUE(add(&firstRoot, firstElements[i]));
+    }
+
+    for(i = 0; i < sizeof(secondElements) / sizeof(int); ++i) {
+        TEST_ASSERT_TRUE(add(&secondRoot, secondElements[i]));
+    }
+
+    // The set operations apply to ordered lists
+    sortList(&firstRoot);
+    sortList(&secondRoot);
+
+    TEST_ASSERT_TRUE(listsUnion(firstRoot, secondRoot, &resultRoot));
+    TEST_ASSERT_EQUAL_STRING("< -2 | 0 | 1 | 3 | 4 | 5 | 8 | 9 >",
+                             listToString(resultRoot));
+    deleteAll(&resultRoot);
+
+    TEST_ASSERT_TRUE(listsIntersection(firstRoot, secondRoot, &resultRoot));
+    TEST_ASSERT_EQUAL_STRING("< -2 | 3 >", listToString(resultRoot));
+    deleteAll(&resultRoot);
+
+    TEST_ASSERT_TRUE(listsDifference(firstRoot, secondRoot, &resultRoot));
+    TEST_ASSERT_EQUAL_STRING("< 1 | 5 | 8 >", listToString(resultRoot));
+    deleteAll(&resultRoot);
+
+    TEST_ASSERT_TRUE(listsDifference(secondRoot, firstRoot, &resultRoot));
+    TEST_ASSERT_EQUAL_STRING("< 0 | 4 | 9 >", listToString(resultRoot));
+    deleteAll(&resultRoot);
+
+    // The input lists are left unchanged
+    TEST_ASSERT_EQUAL_STRING("< -2 | -2 | 1 | 1 | 3 | 5 | 8 >",
+                             listToString(firstRoot));
+    TEST_ASSERT_EQUAL_STRING("< -2 | 0 | 3 | 3 | 4 | 9 >",
+                             listToString(secondRoot));
+
+    // Empty lists and missing result
+    TEST_ASSERT_TRUE(listsUnion(firstRoot, NULL, &resultRoot));
+    TEST_ASSERT_EQUAL_STRING("< -2 | 1 | 3 | 5 | 8 >", listToString(resultRoot));
+    deleteAll(&resultRoot);
+
+    TEST_ASSERT_TRUE(listsIntersection(NULL, secondRoot, &resultRoot));
+    TEST_ASSERT_NULL(resultRoot);
+
+    TEST_ASSERT_TRUE(listsDifference(NULL, NULL, &resultRoot));
+    TEST_ASSERT_NULL(resultRoot);
+
+    TEST_ASSERT_FALSE(listsUnion(firstRoot, secondRoot, NULL));
+
+    deleteAll(&firstRoot);
+    deleteAll(&secondRoot);
+#else
+    TEST_IGNORE_MESSAGE("Skipping set operations test having circular list!");
+#endif
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_finger_search.
+ */
+TEST(CombinedFunctions, test_finger_search) {
+#ifdef findOrderedFromFinger
+    Node *fingerListRoot = NULL, *finger = NULL, *tail = NULL;
+
+    // Sequential additions near the finger
+    int elements[] = {4, 5, 7, 7, 1, 9, 2, 7, -3};
+    size_t i = 0;
+
+    for(i = 0; i < sizeof(elements) / sizeof(int); ++i) {
+        TEST_ASSERT_TRUE(addOrderedFromFinger(&fingerListRoot,
+                                              &finger,
+                                              elements[i]));
+        TEST_ASSERT_EQUAL(elements[i], finger->value);
+    }
+
+    TEST_ASSERT_EQUAL_STRING("< -3 | 1 | 2 | 4 | 5 | 7 | 7 | 7 | 9 >",
+                             listToString(fingerListRoot));
+
+    // The backward links are kept consistent
+    for(tail = fingerListRoot; tail->next; tail = tail->next) {
+        TEST_ASSERT_EQUAL_PTR(tail, tail->next->prev);
+    }
+
+    TEST_ASSERT_NULL(fingerListRoot->prev);
+
+    // Searching forward, backward and from the tail finds the first occurrence
+    finger = NULL;
+    TEST_ASSERT_EQUAL_PTR(findOrderedIter(fingerListRoot, 7),
+                          findOrderedFromFinger(fingerListRoot, &finger, 7));
+    TEST_ASSERT_EQUAL_PTR(findOrderedIter(fingerListRoot, 7), finger);
+    TEST_ASSERT_EQUAL_PTR(findOrderedIter(fingerListRoot, 1),
+                          findOrderedFromFinger(fingerListRoot, &finger, 1));
+    TEST_ASSERT_NULL(findOrderedFromFinger(fingerListRoot, &finger, 3));
+    TEST_ASSERT_EQUAL(4, finger->value);
+    TEST_ASSERT_NULL(findOrderedFromFinger(fingerListRoot, &finger, 10));
+    TEST_ASSERT_EQUAL_PTR(tail, finger);
+
+    finger = tail;
+    TEST_ASSERT_EQUAL_PTR(findOrderedIter(fingerListRoot, 7),
+                          findOrderedFromFinger(fingerListRoot, &finger, 7));
+    TEST_ASSERT_NULL(findOrderedFromFinger(fingerListRoot, &finger, -5));
+    TEST_ASSERT_EQUAL_PTR(fingerListRoot, finger);
+
+    // Deleting moves the finger to the next node (or the previous one)
+    finger = tail;
+    TEST_ASSERT_TRUE(deleteOrderedFromFinger(&fingerListRoot, &finger, 7));
+    TEST_ASSERT_EQUAL(7, finger->value);
+    TEST_ASSERT_TRUE(deleteOrderedFromFinger(&fingerListRoot, &finger, 9));
+    TEST_ASSERT_EQUAL(7, finger->value);
+    TEST_ASSERT_FALSE(deleteOrderedFromFinger(&fingerListRoot, &finger, 3));
+    TEST_ASSERT_TRUE(deleteOrderedFromFinger(&fingerListRoot, &finger, -3));
+    TEST_ASSERT_EQUAL_PTR(fingerListRoot, finger);
+    TEST_ASSERT_NULL(fingerListRoot->prev);
+
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 4 | 5 | 7 | 7 >",
+                             listToString(fingerListRoot));
+
+    // Missing arguments
+    TEST_ASSERT_NULL(findOrderedFromFinger(fingerListRoot, NULL, 1));
+    TEST_ASSERT_FALSE(addOrderedFromFinger(NULL, &finger, 1));
+    TEST_ASSERT_FALSE(deleteOrderedFromFinger(&fingerListRoot, NULL, 1));
+
+    deleteAll(&fingerListRoot);
+#else
+    TEST_IGNORE_MESSAGE("Skipping finger test not having bidirectional list!");
+#endif
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_self_organizing_find.
+ */
+TEST(CombinedFunctions, test_self_organizing_find) {
+#ifdef findMovingToFront
+    Node *selfListRoot = NULL;
+
+    int elements[] = {1, 2, 3, 4, 3};
+    size_t i = 0;
+
+    // Self-organizing lists are unordered ones
+    for(i = 0; i < sizeof(elements) / sizeof(int); ++i) {
+        TEST_ASSERT_TRUE(addIter(&selfListRoot, elements[i]));
+    }
+
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 4 | 3 >",
+                             listToString(selfListRoot));
+
+    // Moving to front (the first occurrence is the one moved)
+    TEST_ASSERT_EQUAL(3, findMovingToFront(&selfListRoot, 3)->value);
+    TEST_ASSERT_EQUAL_STRING("< 3 | 1 | 2 | 4 | 3 >",
+                             listToString(selfListRoot));
+    TEST_ASSERT_EQUAL(4, findMovingToFront(&selfListRoot, 4)->value);
+    TEST_ASSERT_EQUAL(4, findMovingToFront(&selfListRoot, 4)->value);
+    TEST_ASSERT_EQUAL_STRING("< 4 | 3 | 1 | 2 | 3 >",
+                             listToString(selfListRoot));
+    TEST_ASSERT_NULL(findMovingToFront(&selfListRoot, 5));
+    TEST_ASSERT_NULL(findMovingToFront(NULL, 4));
+
+    // Transposing
+    TEST_ASSERT_EQUAL(2, findTransposing(&selfListRoot, 2)->value);
+    TEST_ASSERT_EQUAL_STRING("< 4 | 3 | 2 | 1 | 3 >",
+                             listToString(selfListRoot));
+    TEST_ASSERT_EQUAL(2, findTransposing(&selfListRoot, 2)->value);
+    TEST_ASSERT_EQUAL(2, findTransposing(&selfListRoot, 2)->value);
+    TEST_ASSERT_EQUAL(2, findTransposing(&selfListRoot, 2)->value);
+    TEST_ASSERT_EQUAL_STRING("< 2 | 4 | 3 | 1 | 3 >",
+                             listToString(selfListRoot));
+    TEST_ASSERT_NULL(findTransposing(&selfListRoot, 5));
+    TEST_ASSERT_NULL(findTransposing(NULL, 2));
+    TEST_ASSERT_EQUAL(5, getCount(selfListRoot));
+
+    deleteAll(&selfListRoot);
+    TEST_ASSERT_NULL(findMovingToFront(&selfListRoot, 1));
+    TEST_ASSERT_NULL(findTransposing(&selfListRoot, 1));
+#else
+    TEST_IGNORE_MESSAGE("Skipping self-organizing test not having "
+                        "unidirectional list!");
+#endif
+};
+
+/**
+ * @brief Creates CombinedFunctions test case: test_traversal_from_both_ends.
+ */
+TEST(CombinedFunctions, test_traversal_from_both_ends) {
+#ifdef getOtherEnd
+    Node *bothEndsListRoot = NULL, *tail = NULL;
+    int limitAndCount[2] = {0, 0};
+
+    TEST_ASSERT_NULL(getOtherEnd(bothEndsListRoot));
+    TEST_ASSERT_TRUE(traverseList(bothEndsListRoot,
+                                  visitAboveLimit,
+                                  limitAndCount));
+
+    int elements[] = {1, -2, 3, -4, 5, -6, 7};
+    size_t length = sizeof(elements) / sizeof(int);
+
+    for(size_t i = 0; i < length; ++i) {
+        TEST_ASSERT_TRUE(add(&bothEndsListRoot, elements[i]));
+    }
+
+    // The last node is the root of the reversed list
+    tail = getOtherEnd(bothEndsListRoot);
+    TEST_ASSERT_EQUAL_PTR(bothEndsListRoot, getOtherEnd(tail));
+
+    if(ordered) {
+        TEST_ASSERT_EQUAL_STRING("< 7 | 5 | 3 | 1 | -2 | -4 | -6 >",
+                                 listToString(tail));
+    }
+    else {
+        TEST_ASSERT_EQUAL_STRING("< 7 | -6 | 5 | -4 | 3 | -2 | 1 >",
+                                 listToString(tail));
+    }
+
+    // The traversal backward stops at the first value not above -3
+    limitAndCount[0] = -3;
+    TEST_ASSERT_FALSE(traverseList(tail, visitAboveLimit, limitAndCount));
+    TEST_ASSERT_EQUAL(ordered ? 5 : 1, limitAndCount[1]);
+
+    /**
+     * Editing from the last node: adding to the end of the reversed list adds
+     * before the first node, and the other end is then the new first node.
+     */
+    TEST_ASSERT_TRUE(addIter(&tail, 9));
+    TEST_ASSERT_TRUE(deleteIter(&tail, 7));
+    TEST_ASSERT_EQUAL(length, getCount(tail));
+
+    bothEndsListRoot = getOtherEnd(tail);
+
+    if(ordered) {
+        TEST_ASSERT_EQUAL_STRING("< 9 | -6 | -4 | -2 | 1 | 3 | 5 >",
+                                 listToString(bothEndsListRoot));
+    }
+    else {
+        TEST_ASSERT_EQUAL_STRING("< 9 | 1 | -2 | 3 | -4 | 5 | -6 >",
+                                 listToString(bothEndsListRoot));
+    }
+
+    deleteAll(&bothEndsListRoot);
+#else
+    TEST_IGNORE_MESSAGE("Skipping traversal test not having XOR-linked "
+                        "list!");
+#endif
+};
+
  /**
  * @brief Creates ConcatenateFunction test group runner.
  */
@@ -441,6 +980,13 @@ TEST_GROUP_RUNNER(CombinedFunctions) {
     RUN_TEST_CASE(CombinedFunctions, test_find);
     RUN_TEST_CASE(CombinedFunctions, test_update);
     RUN_TEST_CASE(CombinedFunctions, test_delete_and_count);
+    RUN_TEST_CASE(CombinedFunctions, test_sort);
+    RUN_TEST_CASE(CombinedFunctions, test_add_ordered_batch);
+    RUN_TEST_CASE(CombinedFunctions, test_find_ordered_batch);
+    RUN_TEST_CASE(CombinedFunctions, test_set_operations);
+    RUN_TEST_CASE(CombinedFunctions, test_finger_search);
+    RUN_TEST_CASE(CombinedFunctions, test_self_organizing_find);
+    RUN_TEST_CASE(CombinedFunctions, test_traversal_from_both_ends);
 };
 
 int main(int argc, char *args[]) {
@@ -0,0 +1,101 @@
+/**
+ * @file ebr.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the functions associated with epoch-based memory
+ *        reclamation (EBR).
+ */
+
+#ifndef EBR_H
+#define EBR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * REMARK:
+ *
+ * In a concurrent data structure whose readers do not lock (such as the
+ * concurrent AVL tree or lock-free lists), a node that is unlinked by a writer
+ * may still be visited by readers that reached it just before. It cannot be
+ * freed right away, and EBR tells when it can:
+ *
+ * 1 - Every access to the shared nodes is done within a critical section
+ *     (between enterEBRCriticalSection and exitEBRCriticalSection). Entering
+ *     announces the current global epoch.
+ *
+ * 2 - Instead of being freed, an unlinked node is retired with
+ *     retireEBRPointer. It is kept in a list of the retiring thread, tagged
+ *     with the global epoch at retirement time.
+ *
+ * 3 - The global epoch only advances once every thread within a critical
+ *     section has announced the current epoch. Hence, once the epoch advanced
+ *     twice after the retirement of a node, no thread can still see it, and
+ *     it is freed.
+ *
+ * Readers never block and writers never wait for readers: reclamation is only
+ * delayed by threads staying long within critical sections. A thread is
+ * registered upon its first call, and it should call unregisterEBRThread
+ * before exiting so that its record can be reused by other threads.
+ */
+
+/**
+ * @brief The type of the functions used to free retired pointers.
+ */
+typedef void (*EBRFreeFunction)(void *ptr);
+
+/**
+ * @brief Enters a critical section within which retired pointers are not
+ *        freed. Critical sections can be nested.
+ *
+ * @return True on success and false if the calling thread could not be
+ *         registered (allocation failure), in which case the shared nodes
+ *         should not be accessed.
+ */
+bool enterEBRCriticalSection(void);
+
+/**
+ * @brief Exits a critical section entered by enterEBRCriticalSection. Pointers
+ *        read within the critical section should no longer be used.
+ */
+void exitEBRCriticalSection(void);
+
+/**
+ * @brief Retires a pointer that is no longer reachable by new readers. It is
+ *        freed once no thread can still access it.
+ *
+ * @param ptr The pointer to be freed later.
+ *
+ * @param freeFunction The function to be used to free the pointer (e.g. free).
+ *
+ * @return True if the pointer got retired, and false if allocation fails, in
+ *         which case the caller keeps the pointer.
+ */
+bool retireEBRPointer(void *ptr, EBRFreeFunction freeFunction);
+
+/**
+ * @brief Unregisters the calling thread so that its record can be reused by
+ *        another thread. Its retired pointers are freed later on by the thread
+ *        reusing the record or by reclaimAllEBRPointers.
+ *
+ * @note It should not be called within a critical section.
+ */
+void unregisterEBRThread(void);
+
+/**
+ * @brief Frees all the retired pointers of all threads.
+ *
+ * @note It should only be called while no thread is within a critical section
+ *       (e.g. at the end of a program or a test).
+ */
+void reclaimAllEBRPointers(void);
+
+/**
+ * @brief Retrieves the number of retired pointers that are not freed yet.
+ *
+ * @return The number of pending pointers.
+ */
+size_t getEBRPendingCount(void);
+
+#endif
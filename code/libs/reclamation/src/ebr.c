@@ -0,0 +1,282 @@
+/**
+ * @file ebr.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with epoch-based memory reclamation (EBR).
+ */
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "reclamation/ebr.h"
+
+/**
+ * @def NUM_EPOCHS
+ *
+ * @brief The number of epoch lists kept by every thread. A pointer retired in
+ *        epoch e is freed once the global epoch reaches e + 2, so three lists
+ *        (e - 2, e - 1 and e) are enough.
+ */
+#define NUM_EPOCHS 3
+
+/**
+ * @def ADVANCE_THRESHOLD
+ *
+ * @brief The number of retirements after which a thread tries to advance the
+ *        global epoch and to free its old retired pointers.
+ */
+#define ADVANCE_THRESHOLD 64
+
+/**
+ * @struct RetiredPointer
+ *
+ * @brief A retired pointer waiting to be freed.
+ */
+typedef struct RetiredPointer {
+    void *ptr;
+    EBRFreeFunction freeFunction;
+    struct RetiredPointer *next;
+} RetiredPointer;
+
+/**
+ * @struct EBRRecord
+ *
+ * @brief The record of a thread. Only the state is read by other threads,
+ *        whereas the remaining fields belong to the owning thread.
+ */
+typedef struct EBRRecord {
+    /**
+     * @brief The announced epoch shifted by one bit, with the lowest bit
+     *        telling if the thread is within a critical section.
+     */
+    atomic_ulong state;
+
+    /**
+     * @brief Tells if the record is owned by a thread.
+     */
+    atomic_bool inUse;
+
+    /**
+     * @brief The next record in the global list of records.
+     */
+    struct EBRRecord *next;
+
+    /**
+     * @brief The critical section nesting depth.
+     */
+    unsigned nesting;
+
+    /**
+     * @brief The number of retirements done by the record.
+     */
+    size_t numRetirements;
+
+    /**
+     * @brief The lists of retired pointers, one per epoch modulo NUM_EPOCHS.
+     */
+    RetiredPointer *retired[NUM_EPOCHS];
+
+    /**
+     * @brief The epoch at which the pointers of each list were retired.
+     */
+    unsigned long retiredEpochs[NUM_EPOCHS];
+
+} EBRRecord;
+
+// The global epoch
+static atomic_ulong globalEpoch = 0;
+
+// The list of all records (records are never freed but reused)
+static EBRRecord *_Atomic records = NULL;
+
+// The number of retired pointers not yet freed
+static atomic_size_t pendingCount = 0;
+
+// The record of the calling thread
+static _Thread_local EBRRecord *localRecord = NULL;
+
+/**
+ * @brief Retrieves the record of the calling thread, registering it upon its
+ *        first call by reusing a free record or allocating a new one.
+ *
+ * @return The record or NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static EBRRecord *getRecord(void) {
+    if(!localRecord) {
+        for(EBRRecord *record = atomic_load(&records);
+            record && !localRecord;
+            record = record->next) {
+            bool inUse = false;
+
+            if(atomic_compare_exchange_strong(&record->inUse, &inUse, true)) {
+                localRecord = record;
+            }
+        }
+    }
+
+    if(!localRecord) {
+        EBRRecord *record = calloc(1, sizeof(EBRRecord));
+
+        if(record) {
+            atomic_init(&record->state, 0);
+            atomic_init(&record->inUse, true);
+
+            record->next = atomic_load(&records);
+            while(!atomic_compare_exchange_weak(&records,
+                                                &record->next,
+                                                record)) {
+                // record->next got updated with the current head, so retry
+            }
+
+            localRecord = record;
+        }
+    }
+
+    return localRecord;
+}
+
+/**
+ * @brief Frees one list of retired pointers of a record.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void freeRetiredList(EBRRecord *record, size_t index) {
+    RetiredPointer *retiredPtr = record->retired[index];
+    size_t count = 0;
+
+    while(retiredPtr) {
+        RetiredPointer *next = retiredPtr->next;
+
+        retiredPtr->freeFunction(retiredPtr->ptr);
+        free(retiredPtr);
+
+        retiredPtr = next;
+        ++count;
+    }
+
+    record->retired[index] = NULL;
+    atomic_fetch_sub(&pendingCount, count);
+}
+
+/**
+ * @brief Advances the global epoch if every thread within a critical section
+ *        has announced the current epoch.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void tryAdvanceEpoch(void) {
+    unsigned long epoch = atomic_load(&globalEpoch);
+    bool canAdvance = true;
+
+    for(EBRRecord *record = atomic_load(&records);
+        record && canAdvance;
+        record = record->next) {
+        unsigned long state = atomic_load(&record->state);
+
+        canAdvance = !(state & 1) || (state >> 1) == epoch;
+    }
+
+    if(canAdvance) {
+        // It fails only if another thread advanced it meanwhile
+        atomic_compare_exchange_strong(&globalEpoch, &epoch, epoch + 1);
+    }
+}
+
+bool enterEBRCriticalSection(void) {
+    bool entered = false;
+    EBRRecord *record = getRecord();
+
+    if(record) {
+        if(record->nesting++ == 0) {
+            unsigned long epoch = atomic_load(&globalEpoch);
+
+            /**
+             * The sequentially consistent store (and fence) makes sure the
+             * announcement is visible to other threads before any shared
+             * node is read.
+             */
+            atomic_store(&record->state, (epoch << 1) | 1);
+            atomic_thread_fence(memory_order_seq_cst);
+        }
+
+        entered = true;
+    }
+
+    return entered;
+}
+
+void exitEBRCriticalSection(void) {
+    EBRRecord *record = localRecord;
+
+    if(record && record->nesting > 0 && --record->nesting == 0) {
+        atomic_store_explicit(&record->state, 0, memory_order_release);
+    }
+}
+
+bool retireEBRPointer(void *ptr, EBRFreeFunction freeFunction) {
+    bool retired = false;
+    EBRRecord *record = getRecord();
+    RetiredPointer *retiredPtr = record ? malloc(sizeof(RetiredPointer)) : NULL;
+
+    if(retiredPtr) {
+        unsigned long epoch = atomic_load(&globalEpoch);
+        size_t index = epoch % NUM_EPOCHS;
+
+        /**
+         * A list holding pointers of an older epoch e' (e' <= epoch - 3) can
+         * safely be freed before reusing it.
+         */
+        if(record->retired[index] && record->retiredEpochs[index] != epoch) {
+            freeRetiredList(record, index);
+        }
+
+        retiredPtr->ptr = ptr;
+        retiredPtr->freeFunction = freeFunction;
+        retiredPtr->next = record->retired[index];
+        record->retired[index] = retiredPtr;
+        record->retiredEpochs[index] = epoch;
+        atomic_fetch_add(&pendingCount, 1);
+        retired = true;
+
+        if(++record->numRetirements % ADVANCE_THRESHOLD == 0) {
+            tryAdvanceEpoch();
+            epoch = atomic_load(&globalEpoch);
+
+            for(size_t i = 0; i < NUM_EPOCHS; ++i) {
+                if(record->retired[i] && record->retiredEpochs[i] + 2 <= epoch) {
+                    freeRetiredList(record, i);
+                }
+            }
+        }
+    }
+
+    return retired;
+}
+
+void unregisterEBRThread(void) {
+    EBRRecord *record = localRecord;
+
+    if(record && record->nesting == 0) {
+        atomic_store(&record->state, 0);
+        atomic_store(&record->inUse, false);
+        localRecord = NULL;
+    }
+}
+
+void reclaimAllEBRPointers(void) {
+    for(EBRRecord *record = atomic_load(&records);
+        record;
+        record = record->next) {
+        for(size_t i = 0; i < NUM_EPOCHS; ++i) {
+            freeRetiredList(record, i);
+        }
+    }
+}
+
+size_t getEBRPendingCount(void) {
+    return atomic_load(&pendingCount);
+}
@@ -0,0 +1,291 @@
+/**
+ * @file test_ebr.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to epoch-based memory reclamation in
+ *        "ebr.h".
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "reclamation/ebr.h"
+
+/**
+ * @def NUM_ITEMS
+ *
+ * @brief The number of items retired by the single-threaded tests.
+ */
+#define NUM_ITEMS 1000
+
+/**
+ * @def NUM_THREADS
+ *
+ * @brief The number of threads used by the multi-threaded test.
+ */
+#define NUM_THREADS 4
+
+/**
+ * @brief An item that records when it gets freed instead of being freed.
+ */
+typedef struct Item {
+    atomic_bool freed;
+} Item;
+
+// The items retired by the single-threaded tests
+static Item items[NUM_ITEMS];
+
+// The number of items freed by the multi-threaded test
+static atomic_size_t numFreed = 0;
+
+/**
+ * @brief Marks an item as freed (used as free function).
+ *
+ * @param ptr Pointer to the item.
+ */
+void markFreed(void *ptr) {
+    atomic_store(&((Item *) ptr)->freed, true);
+}
+
+/**
+ * @brief Frees a pointer and counts it (used as free function).
+ *
+ * @param ptr The pointer to be freed.
+ */
+void countingFree(void *ptr) {
+    free(ptr);
+    atomic_fetch_add(&numFreed, 1);
+}
+
+/**
+ * @brief The state shared with the reader thread.
+ */
+typedef struct ReaderState {
+    atomic_bool entered;
+    atomic_bool done;
+} ReaderState;
+
+/**
+ * @brief The reader thread entering a critical section and staying in it until
+ *        told to exit.
+ *
+ * @param arg Pointer to the reader state.
+ *
+ * @return NULL.
+ */
+void *readerThread(void *arg) {
+    ReaderState *state = arg;
+
+    enterEBRCriticalSection();
+    atomic_store(&state->entered, true);
+
+    while(!atomic_load(&state->done)) {
+        sched_yield();
+    }
+
+    exitEBRCriticalSection();
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief The writer thread allocating pointers and retiring them from within
+ *        critical sections.
+ *
+ * @param arg Unused.
+ *
+ * @return NULL.
+ */
+void *writerThread(void *arg) {
+    (void) arg;
+
+    for(int i = 0; i < NUM_ITEMS; ++i) {
+        int *ptr = malloc(sizeof(int));
+
+        if(ptr && enterEBRCriticalSection()) {
+            *ptr = i;
+
+            if(!retireEBRPointer(ptr, countingFree)) {
+                countingFree(ptr);
+            }
+
+            exitEBRCriticalSection();
+        }
+        else {
+            free(ptr);
+        }
+    }
+
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief Creates EBRFunctions test group.
+ */
+TEST_GROUP(EBRFunctions);
+
+/**
+ * @brief Creates EBRFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(EBRFunctions) {
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        atomic_store(&items[i].freed, false);
+    }
+};
+
+/**
+ * @brief Creates EBRFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(EBRFunctions) {
+    reclaimAllEBRPointers();
+    TEST_ASSERT_EQUAL(0, getEBRPendingCount());
+};
+
+/**
+ * @brief Creates EBRFunctions test case: retired pointers are freed once no
+ *        thread is within a critical section.
+ */
+TEST(EBRFunctions, test_retire) {
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_TRUE(retireEBRPointer(&items[i], markFreed));
+    }
+
+    // Only the pointers of the latest epochs are still pending
+    TEST_ASSERT_TRUE(getEBRPendingCount() < NUM_ITEMS / 2);
+    TEST_ASSERT_TRUE(atomic_load(&items[0].freed));
+    TEST_ASSERT_FALSE(atomic_load(&items[NUM_ITEMS - 1].freed));
+
+    reclaimAllEBRPointers();
+    TEST_ASSERT_EQUAL(0, getEBRPendingCount());
+    TEST_ASSERT_TRUE(atomic_load(&items[NUM_ITEMS - 1].freed));
+}
+
+/**
+ * @brief Creates EBRFunctions test case: critical sections can be nested and
+ *        retiring within them is allowed.
+ */
+TEST(EBRFunctions, test_nesting) {
+    TEST_ASSERT_TRUE(enterEBRCriticalSection());
+    TEST_ASSERT_TRUE(enterEBRCriticalSection());
+    exitEBRCriticalSection();
+
+    // Still within the outer critical section, so nothing gets freed
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_TRUE(retireEBRPointer(&items[i], markFreed));
+    }
+
+    TEST_ASSERT_FALSE(atomic_load(&items[0].freed));
+
+    exitEBRCriticalSection();
+
+    // An extra exit is ignored
+    exitEBRCriticalSection();
+
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        atomic_store(&items[i].freed, false);
+        TEST_ASSERT_TRUE(retireEBRPointer(&items[i], markFreed));
+    }
+
+    TEST_ASSERT_TRUE(atomic_load(&items[0].freed));
+}
+
+/**
+ * @brief Creates EBRFunctions test case: a reader staying within a critical
+ *        section delays the freeing of the pointers retired meanwhile.
+ */
+TEST(EBRFunctions, test_reader_delays_reclamation) {
+    ReaderState state;
+    pthread_t reader;
+
+    atomic_init(&state.entered, false);
+    atomic_init(&state.done, false);
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&reader, NULL, readerThread, &state));
+
+    while(!atomic_load(&state.entered)) {
+        sched_yield();
+    }
+
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_TRUE(retireEBRPointer(&items[i], markFreed));
+    }
+
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_FALSE(atomic_load(&items[i].freed));
+    }
+
+    TEST_ASSERT_EQUAL(NUM_ITEMS, getEBRPendingCount());
+
+    atomic_store(&state.done, true);
+    TEST_ASSERT_EQUAL(0, pthread_join(reader, NULL));
+
+    // Once the reader is gone, retiring again frees the old pointers
+    static Item moreItems[NUM_ITEMS];
+
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_TRUE(retireEBRPointer(&moreItems[i], markFreed));
+    }
+
+    for(size_t i = 0; i < NUM_ITEMS; ++i) {
+        TEST_ASSERT_TRUE(atomic_load(&items[i].freed));
+    }
+}
+
+/**
+ * @brief Creates EBRFunctions test case: several threads retire pointers and
+ *        every one of them is freed exactly once.
+ */
+TEST(EBRFunctions, test_concurrent) {
+    pthread_t threads[NUM_THREADS];
+
+    atomic_store(&numFreed, 0);
+
+    for(int i = 0; i < NUM_THREADS; ++i) {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[i],
+                                            NULL,
+                                            writerThread,
+                                            NULL));
+    }
+
+    for(int i = 0; i < NUM_THREADS; ++i) {
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[i], NULL));
+    }
+
+    reclaimAllEBRPointers();
+    TEST_ASSERT_EQUAL(0, getEBRPendingCount());
+    TEST_ASSERT_EQUAL(NUM_THREADS * NUM_ITEMS, atomic_load(&numFreed));
+}
+
+/**
+ * @brief Creates EBRFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(EBRFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(EBRFunctions, test_retire);
+    RUN_TEST_CASE(EBRFunctions, test_nesting);
+    RUN_TEST_CASE(EBRFunctions, test_reader_delays_reclamation);
+    RUN_TEST_CASE(EBRFunctions, test_concurrent);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the EBRFunctions group tests
+    RUN_TEST_GROUP(EBRFunctions);
+
+    // End testing
+    return UNITY_END();
+}
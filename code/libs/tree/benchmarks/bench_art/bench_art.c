@@ -0,0 +1,150 @@
+/**
+ * @file bench_art.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks lookups in adaptive radix tree ("art.h") against
+ *        comparison-based balanced trees, i.e. AVL tree ("avl.h") and
+ *        scapegoat tree ("scapegoat.h"), while the number of keys grows.
+ *
+ * Usage: bench_art [maxKeys] [numLookups]
+ *
+ * The number of keys goes from 1024 to maxKeys, being multiplied by 4 every
+ * time. The lookups hit random existing keys, and the times are given in
+ * nanoseconds per lookup.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tree/art.h"
+#include "tree/avl.h"
+#include "tree/scapegoat.h"
+
+/**
+ * @def MAX_AVL_KEYS
+ *
+ * @brief The maximum number of keys for which the AVL tree is benchmarked.
+ */
+#define MAX_AVL_KEYS 8192
+
+/**
+ * @brief A small xorshift64* pseudo-random generator, being faster and of
+ *        better quality than rand() (whose range is only 15 bits on Windows).
+ *
+ * @param state Pointer to the non-zero generator state.
+ *
+ * @return The next pseudo-random 64-bit number.
+ */
+static unsigned long long nextRandom(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *args[]) {
+    size_t maxKeys = argc > 1 ? strtoul(args[1], NULL, 10) : 4194304;
+    size_t numLookups = argc > 2 ? strtoul(args[2], NULL, 10) : 2000000;
+
+    if(argc > 3 || maxKeys < 1024 || numLookups == 0) {
+        fprintf(stderr,
+                "Usage: %s [maxKeys (at least 1024)] [numLookups]\n",
+                args[0]);
+        exit(1);
+    }
+
+    int *keys = malloc(maxKeys * sizeof(int));
+    int *lookups = malloc(numLookups * sizeof(int));
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+    if(!keys || !lookups) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    printf("Lookups = %zu\n", numLookups);
+    printf("%-10s %8s %12s %12s %12s %10s\n",
+           "keys", "art h", "art ns/op", "avl ns/op", "sg ns/op", "found");
+
+    for(size_t numKeys = 1024; numKeys <= maxKeys; numKeys *= 4) {
+        ARTNode *artRoot = NULL;
+        AVLNode *avlRoot = NULL;
+        ScapegoatTree scapegoatTree = {0};
+        size_t numAdded = 0;
+        size_t found = 0;
+        double start, artTime, avlTime, scapegoatTime;
+
+        // Distinct random keys
+        while(numAdded < numKeys) {
+            int key = (int) nextRandom(&state);
+
+            if(addARTNode(&artRoot, key)) {
+                keys[numAdded++] = key;
+                addScapegoatNode(&scapegoatTree, key);
+
+                /**
+                 * Note that the AVL insertion recomputes balance factors from
+                 * scratch (quadratic building time), which is why the AVL
+                 * tree is skipped for large number of keys (its column then
+                 * shows nan).
+                 */
+                if(numKeys <= MAX_AVL_KEYS) {
+                    addAVLNode(&avlRoot, key);
+                }
+            }
+        }
+
+        for(size_t i = 0; i < numLookups; ++i) {
+            lookups[i] = keys[nextRandom(&state) % numKeys];
+        }
+
+        start = now();
+        for(size_t i = 0; i < numLookups; ++i) {
+            found += findARTNode(artRoot, lookups[i]) != NULL;
+        }
+        artTime = now() - start;
+
+        start = now();
+        for(size_t i = 0; avlRoot && i < numLookups; ++i) {
+            found += findAVLNode(avlRoot, lookups[i]) != NULL;
+        }
+        avlTime = avlRoot ? now() - start : NAN;
+
+        start = now();
+        for(size_t i = 0; i < numLookups; ++i) {
+            found += findScapegoatNode(&scapegoatTree, lookups[i]) != NULL;
+        }
+        scapegoatTime = now() - start;
+
+        printf("%-10zu %8zu %12.1f %12.1f %12.1f %10zu\n",
+               numKeys,
+               getARTHeight(artRoot),
+               artTime * 1e9 / numLookups,
+               avlTime * 1e9 / numLookups,
+               scapegoatTime * 1e9 / numLookups,
+               found);
+
+        deleteEntireART(&artRoot);
+        deleteEntireAVL(&avlRoot);
+        deleteEntireScapegoat(&scapegoatTree);
+    }
+
+    free(keys);
+    free(lookups);
+
+    return 0;
+}
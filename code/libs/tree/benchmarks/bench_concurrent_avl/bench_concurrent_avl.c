@@ -0,0 +1,275 @@
+/**
+ * @file bench_concurrent_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks the throughput of concurrent AVL tree
+ *        ("concurrent_avl.h") against AVL tree ("avl.h") protected by one
+ *        global mutex or one global reader-writer lock, under mixed read/write
+ *        workloads run by several threads.
+ *
+ * Usage: bench_concurrent_avl [numThreads] [numKeys] [opsPerThread]
+ *
+ * Every workload is run with 100%, 90% and 50% of lookups. The remaining
+ * operations are equally split between additions and deletions of random keys
+ * in [0, numKeys), so the tree size stays around numKeys / 2.
+ */
+
+// Needed for pthread_rwlock_t as we compile in strict C standard mode
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "reclamation/ebr.h"
+#include "tree/avl.h"
+#include "tree/concurrent_avl.h"
+
+/**
+ * @def MAX_THREADS
+ *
+ * @brief The maximum number of threads.
+ */
+#define MAX_THREADS 256
+
+/**
+ * @brief The kind of synchronization being benchmarked.
+ */
+typedef enum Backend {
+    MUTEX_AVL,
+    RWLOCK_AVL,
+    CONCURRENT_AVL
+} Backend;
+
+/**
+ * @brief The settings shared by all threads of a workload.
+ */
+typedef struct Workload {
+    Backend backend;
+    unsigned readPercentage;
+    size_t numKeys;
+    size_t opsPerThread;
+} Workload;
+
+/**
+ * @brief The arguments of every thread.
+ */
+typedef struct WorkerArgs {
+    const Workload *workload;
+    unsigned long long seed;
+    size_t found;
+} WorkerArgs;
+
+// The trees and locks shared by the threads
+AVLNode *avlRoot = NULL;
+pthread_mutex_t avlMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_rwlock_t avlRWLock = PTHREAD_RWLOCK_INITIALIZER;
+ConcurrentAVLTree concurrentTree;
+
+/**
+ * @brief A small xorshift64* pseudo-random generator, being faster than rand()
+ *        and, unlike it, safe to use from several threads.
+ *
+ * @param state Pointer to the non-zero generator state.
+ *
+ * @return The next pseudo-random 64-bit number.
+ */
+static unsigned long long nextRandom(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Looks up a key using the benchmarked backend.
+ */
+static bool find(Backend backend, int key) {
+    bool found = false;
+
+    switch(backend) {
+        case MUTEX_AVL:
+            pthread_mutex_lock(&avlMutex);
+            found = findAVLNode(avlRoot, key) != NULL;
+            pthread_mutex_unlock(&avlMutex);
+            break;
+
+        case RWLOCK_AVL:
+            pthread_rwlock_rdlock(&avlRWLock);
+            found = findAVLNode(avlRoot, key) != NULL;
+            pthread_rwlock_unlock(&avlRWLock);
+            break;
+
+        case CONCURRENT_AVL:
+            found = findConcurrentAVLNode(&concurrentTree, key);
+            break;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Adds (if add is true) or deletes a key using the benchmarked backend.
+ */
+static void update(Backend backend, int key, bool add) {
+    switch(backend) {
+        case MUTEX_AVL:
+            pthread_mutex_lock(&avlMutex);
+            add ? addAVLNode(&avlRoot, key) : deleteAVLNode(&avlRoot, key);
+            pthread_mutex_unlock(&avlMutex);
+            break;
+
+        case RWLOCK_AVL:
+            pthread_rwlock_wrlock(&avlRWLock);
+            add ? addAVLNode(&avlRoot, key) : deleteAVLNode(&avlRoot, key);
+            pthread_rwlock_unlock(&avlRWLock);
+            break;
+
+        case CONCURRENT_AVL:
+            if(add) {
+                addConcurrentAVLNode(&concurrentTree, key);
+            }
+            else {
+                deleteConcurrentAVLNode(&concurrentTree, key);
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Runs the operations of one thread.
+ *
+ * @param arg Pointer to the WorkerArgs of the thread.
+ */
+static void *runWorker(void *arg) {
+    WorkerArgs *args = arg;
+    const Workload *workload = args->workload;
+    unsigned long long state = args->seed;
+
+    for(size_t i = 0; i < workload->opsPerThread; ++i) {
+        unsigned long long random = nextRandom(&state);
+        int key = (int) ((random >> 8) % workload->numKeys);
+
+        if(random % 100 < workload->readPercentage) {
+            args->found += find(workload->backend, key);
+        }
+        else {
+            update(workload->backend, key, (random >> 7) & 1);
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return NULL;
+}
+
+/**
+ * @brief Runs a workload and returns its throughput in millions of operations
+ *        per second.
+ */
+static double runWorkload(const Workload *workload, size_t numThreads) {
+    pthread_t threads[MAX_THREADS];
+    WorkerArgs args[MAX_THREADS];
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+    // Half filling the trees with random keys
+    avlRoot = NULL;
+    initConcurrentAVL(&concurrentTree);
+
+    for(size_t i = 0; i < workload->numKeys / 2; ++i) {
+        int key = (int) (nextRandom(&state) % workload->numKeys);
+
+        if(workload->backend == CONCURRENT_AVL) {
+            addConcurrentAVLNode(&concurrentTree, key);
+        }
+        else {
+            addAVLNode(&avlRoot, key);
+        }
+    }
+
+    double start = now();
+
+    for(size_t t = 0; t < numThreads; ++t) {
+        args[t].workload = workload;
+        args[t].seed = nextRandom(&state) | 1;
+        args[t].found = 0;
+
+        if(pthread_create(&threads[t], NULL, runWorker, &args[t]) != 0) {
+            fprintf(stderr, "Thread creation failed!\n");
+            exit(1);
+        }
+    }
+
+    for(size_t t = 0; t < numThreads; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    double elapsed = now() - start;
+
+    deleteEntireAVL(&avlRoot);
+    destroyConcurrentAVL(&concurrentTree);
+    reclaimAllEBRPointers();
+
+    return numThreads * workload->opsPerThread / elapsed * 1e-6;
+}
+
+int main(int argc, char *args[]) {
+    size_t numThreads = argc > 1 ? strtoul(args[1], NULL, 10) : 4;
+    size_t numKeys = argc > 2 ? strtoul(args[2], NULL, 10) : 1024;
+    size_t opsPerThread = argc > 3 ? strtoul(args[3], NULL, 10) : 100000;
+    unsigned readPercentages[] = {100, 90, 50};
+
+    if(argc > 4 || numThreads == 0 || numThreads > MAX_THREADS ||
+       numKeys == 0 || opsPerThread == 0) {
+        fprintf(stderr,
+                "Usage: %s [numThreads (1 to %d)] [numKeys] [opsPerThread]\n",
+                args[0],
+                MAX_THREADS);
+        exit(1);
+    }
+
+    /**
+     * Note that the additions and deletions of "avl.h" recompute balance
+     * factors from scratch (linear time), which is why the default number of
+     * keys is kept small.
+     */
+    printf("Threads = %zu, keys = %zu, operations per thread = %zu\n",
+           numThreads, numKeys, opsPerThread);
+    printf("%-8s %16s %16s %16s\n",
+           "reads %", "mutex Mops/s", "rwlock Mops/s", "concurrent Mops/s");
+
+    for(size_t r = 0; r < sizeof(readPercentages) / sizeof(unsigned); ++r) {
+        double throughputs[3];
+
+        for(int backend = MUTEX_AVL; backend <= CONCURRENT_AVL; ++backend) {
+            Workload workload = {backend,
+                                 readPercentages[r],
+                                 numKeys,
+                                 opsPerThread};
+
+            throughputs[backend] = runWorkload(&workload, numThreads);
+        }
+
+        printf("%-8u %16.2f %16.2f %16.2f\n",
+               readPercentages[r],
+               throughputs[MUTEX_AVL],
+               throughputs[RWLOCK_AVL],
+               throughputs[CONCURRENT_AVL]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ * @file bench_splay_and_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This benchmarks lookups in splay tree ("splay.h") against AVL tree
+ *        ("avl.h") and binary search tree ("bst.h") under uniform and
+ *        Zipf-distributed (skewed) workloads.
+ *
+ * Usage: bench_splay_and_avl [numKeys] [numLookups] [zipfExponent]
+ *
+ * If zipfExponent is omitted, the workloads with exponents 0 (uniform), 0.8,
+ * 0.99 and 1.2 are run one after the other.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "tree/avl.h"
+#include "tree/bst.h"
+#include "tree/splay.h"
+
+/**
+ * @def MAX_AVL_KEYS
+ *
+ * @brief The maximum number of keys for which the AVL tree is benchmarked.
+ */
+#define MAX_AVL_KEYS 8192
+
+/**
+ * @brief A small xorshift64* pseudo-random generator, being faster and of
+ *        better quality than rand() (whose range is only 15 bits on Windows).
+ *
+ * @param state Pointer to the non-zero generator state.
+ *
+ * @return The next pseudo-random 64-bit number.
+ */
+static unsigned long long nextRandom(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Returns a uniformly distributed double in [0, 1).
+ *
+ * @param state Pointer to the non-zero generator state.
+ */
+static double nextUniform(unsigned long long *state) {
+    return (nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Shuffles an integer array in place (Fisher-Yates).
+ *
+ * @param array The array to shuffle.
+ *
+ * @param length The array length.
+ *
+ * @param state Pointer to the non-zero generator state.
+ */
+static void shuffle(int *array, size_t length, unsigned long long *state) {
+    for(size_t i = length; i > 1; --i) {
+        size_t j = nextRandom(state) % i;
+        int tmp = array[i - 1];
+        array[i - 1] = array[j];
+        array[j] = tmp;
+    }
+}
+
+/**
+ * @brief Fills the lookups array with keys drawn from a Zipf distribution
+ *        over the ranks of the keys array (rank r has probability
+ *        proportional to 1 / r^exponent). An exponent of zero is uniform.
+ *
+ * @return True on success and false if allocation fails.
+ */
+static bool generateZipfLookups(const int *keys,
+                                size_t numKeys,
+                                int *lookups,
+                                size_t numLookups,
+                                double exponent,
+                                unsigned long long *state) {
+    double *cdf = malloc(numKeys * sizeof(double));
+
+    if(!cdf) {
+        return false;
+    }
+
+    double sum = 0.0;
+    for(size_t i = 0; i < numKeys; ++i) {
+        sum += 1.0 / pow((double) (i + 1), exponent);
+        cdf[i] = sum;
+    }
+
+    for(size_t i = 0; i < numLookups; ++i) {
+        double u = nextUniform(state) * sum;
+
+        // Binary search for the first rank whose cumulative weight exceeds u
+        size_t low = 0, high = numKeys - 1;
+        while(low < high) {
+            size_t middle = low + (high - low) / 2;
+
+            if(cdf[middle] <= u) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+
+        lookups[i] = keys[low];
+    }
+
+    free(cdf);
+
+    return true;
+}
+
+/**
+ * @brief Returns the current time in seconds (wall clock).
+ */
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Runs and reports one workload over the three trees.
+ */
+static void runWorkload(AVLNode *avlRoot,
+                        BSTNode *bstRoot,
+                        const int *keys,
+                        size_t numKeys,
+                        const int *lookups,
+                        size_t numLookups,
+                        double exponent) {
+    SplayNode *splayRoot = NULL;
+    size_t found = 0;
+    double start, avlTime, bstTime, splayTime;
+
+    // Building the splay tree anew to start from the same shape every time
+    for(size_t i = 0; i < numKeys; ++i) {
+        addSplayNode(&splayRoot, keys[i]);
+    }
+
+    start = now();
+    for(size_t i = 0; avlRoot && i < numLookups; ++i) {
+        found += findAVLNode(avlRoot, lookups[i]) != NULL;
+    }
+    avlTime = avlRoot ? now() - start : NAN;
+
+    start = now();
+    for(size_t i = 0; i < numLookups; ++i) {
+        found += findBSTNode(bstRoot, lookups[i]) != NULL;
+    }
+    bstTime = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < numLookups; ++i) {
+        found += findSplayNode(&splayRoot, lookups[i]) != NULL;
+    }
+    splayTime = now() - start;
+
+    printf("%-8.2f %12.1f %12.1f %12.1f %10zu\n",
+           exponent,
+           avlTime * 1e9 / numLookups,
+           bstTime * 1e9 / numLookups,
+           splayTime * 1e9 / numLookups,
+           found);
+
+    deleteEntireSplay(&splayRoot);
+}
+
+int main(int argc, char *args[]) {
+    size_t numKeys = argc > 1 ? strtoul(args[1], NULL, 10) : 4096;
+    size_t numLookups = argc > 2 ? strtoul(args[2], NULL, 10) : 2000000;
+    double exponents[] = {0.0, 0.8, 0.99, 1.2};
+    size_t numExponents = sizeof(exponents) / sizeof(double);
+
+    if(argc > 3) {
+        exponents[0] = atof(args[3]);
+        numExponents = 1;
+    }
+
+    if(argc > 4 || numKeys == 0 || numLookups == 0) {
+        fprintf(stderr,
+                "Usage: %s [numKeys] [numLookups] [zipfExponent]\n",
+                args[0]);
+        exit(1);
+    }
+
+    int *keys = malloc(numKeys * sizeof(int));
+    int *lookups = malloc(numLookups * sizeof(int));
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+    if(!keys || !lookups) {
+        fprintf(stderr, "Allocation failed!\n");
+        exit(1);
+    }
+
+    // Distinct keys inserted in random order
+    for(size_t i = 0; i < numKeys; ++i) {
+        keys[i] = (int) (2 * i);
+    }
+    shuffle(keys, numKeys, &state);
+
+    /**
+     * Note that the AVL insertion recomputes balance factors from scratch
+     * (quadratic building time), which is why the AVL tree is skipped for
+     * large number of keys (its column then shows nan).
+     */
+    AVLNode *avlRoot = NULL;
+    BSTNode *bstRoot = NULL;
+
+    for(size_t i = 0; i < numKeys; ++i) {
+        if(numKeys <= MAX_AVL_KEYS) {
+            addAVLNode(&avlRoot, keys[i]);
+        }
+
+        addBSTNode(&bstRoot, keys[i]);
+    }
+
+    printf("Keys = %zu (AVL height = %zu, BST height = %zu), lookups = %zu\n",
+           numKeys, getAVLHeight(avlRoot), getBSTHeight(bstRoot), numLookups);
+    printf("%-8s %12s %12s %12s %10s\n",
+           "zipf-s", "avl ns/op", "bst ns/op", "splay ns/op", "found");
+
+    for(size_t e = 0; e < numExponents; ++e) {
+        // Hot ranks are mapped onto random keys
+        shuffle(keys, numKeys, &state);
+
+        if(!generateZipfLookups(keys,
+                                numKeys,
+                                lookups,
+                                numLookups,
+                                exponents[e],
+                                &state)) {
+            fprintf(stderr, "Allocation failed!\n");
+            exit(1);
+        }
+
+        runWorkload(avlRoot,
+                    bstRoot,
+                    keys,
+                    numKeys,
+                    lookups,
+                    numLookups,
+                    exponents[e]);
+    }
+
+    deleteEntireAVL(&avlRoot);
+    deleteEntireBST(&bstRoot);
+    free(keys);
+    free(lookups);
+
+    return 0;
+}
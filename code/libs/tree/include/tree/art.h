@@ -0,0 +1,336 @@
+/**
+ * @file art.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structures and functions associated with
+ *        adaptive radix tree (ART).
+ */
+
+#ifndef ART_H
+#define ART_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * REMARK:
+ *
+ * An adaptive radix tree does not compare values. It maps every value to its
+ * four big-endian key bytes (after flipping the sign bit, so that the byte
+ * order is the value order) and descends by one byte per inner node. Hence,
+ * a lookup visits at most four inner nodes whatever the number of values,
+ * while an AVL tree lookup goes through about log2(n) dependent comparisons.
+ *
+ * In order to keep memory low, inner nodes come in four sizes, growing and
+ * shrinking with their number of children:
+ *
+ *   - ARTNode4 and ARTNode16 keep sorted key bytes next to their children
+ *     (ARTNode16 compares the 16 key bytes at once using SSE2);
+ *
+ *   - ARTNode48 maps every byte to one of its 48 children slots;
+ *
+ *   - ARTNode256 directly indexes its children by byte.
+ *
+ * Moreover, a value is stored in a leaf as soon as no other value shares its
+ * path (lazy expansion), and the key bytes shared by all values below an
+ * inner node are stored in the node itself (path compression) instead of
+ * one-child nodes. As keys have four bytes, the prefix of a node never
+ * exceeds ART_MAX_PREFIX_LENGTH bytes.
+ *
+ * Like AVL tree, duplicates are not allowed.
+ */
+
+/**
+ * @def ART_MAX_PREFIX_LENGTH
+ *
+ * @brief The maximum number of key bytes compressed in an inner node.
+ */
+#define ART_MAX_PREFIX_LENGTH 3
+
+/**
+ * @enum ARTNodeType
+ *
+ * @brief The types of the nodes of an adaptive radix tree.
+ */
+typedef enum ARTNodeType {
+    ART_LEAF,
+    ART_NODE4,
+    ART_NODE16,
+    ART_NODE48,
+    ART_NODE256
+} ARTNodeType;
+
+/**
+ * @struct ARTNode
+ *
+ * @brief The header shared by all the nodes of an adaptive radix tree. A
+ *        pointer to any node is a pointer to its header.
+ */
+typedef struct ARTNode {
+    /**
+     * @brief The type of the node (see ARTNodeType).
+     */
+    uint8_t type;
+
+    /**
+     * @brief The number of key bytes compressed in the node (inner node).
+     */
+    uint8_t prefixLength;
+
+    /**
+     * @brief The key bytes shared by all values below the node (inner node).
+     */
+    uint8_t prefix[ART_MAX_PREFIX_LENGTH];
+
+    /**
+     * @brief The number of children of the node (inner node).
+     */
+    uint16_t numChildren;
+
+} ARTNode;
+
+/**
+ * @struct ARTLeaf
+ *
+ * @brief A leaf holding a value.
+ */
+typedef struct ARTLeaf {
+    /**
+     * @brief The header of the leaf.
+     */
+    ARTNode header;
+
+    /**
+     * @brief The value stored in the leaf.
+     */
+    int value;
+
+} ARTLeaf;
+
+/**
+ * @struct ARTNode4
+ *
+ * @brief An inner node of up to 4 children whose key bytes are sorted.
+ */
+typedef struct ARTNode4 {
+    /**
+     * @brief The header of the node.
+     */
+    ARTNode header;
+
+    /**
+     * @brief The sorted key bytes of the children.
+     */
+    uint8_t keys[4];
+
+    /**
+     * @brief The children (children[i] corresponds to keys[i]).
+     */
+    ARTNode *children[4];
+
+} ARTNode4;
+
+/**
+ * @struct ARTNode16
+ *
+ * @brief An inner node of up to 16 children whose key bytes are sorted.
+ */
+typedef struct ARTNode16 {
+    /**
+     * @brief The header of the node.
+     */
+    ARTNode header;
+
+    /**
+     * @brief The sorted key bytes of the children.
+     */
+    uint8_t keys[16];
+
+    /**
+     * @brief The children (children[i] corresponds to keys[i]).
+     */
+    ARTNode *children[16];
+
+} ARTNode16;
+
+/**
+ * @struct ARTNode48
+ *
+ * @brief An inner node of up to 48 children indexed by key byte.
+ */
+typedef struct ARTNode48 {
+    /**
+     * @brief The header of the node.
+     */
+    ARTNode header;
+
+    /**
+     * @brief The slot of the child of every key byte plus one (zero if there
+     *        is no such child).
+     */
+    uint8_t childIndex[256];
+
+    /**
+     * @brief The children slots (NULL if free).
+     */
+    ARTNode *children[48];
+
+} ARTNode48;
+
+/**
+ * @struct ARTNode256
+ *
+ * @brief An inner node whose children are directly indexed by key byte.
+ */
+typedef struct ARTNode256 {
+    /**
+     * @brief The header of the node.
+     */
+    ARTNode header;
+
+    /**
+     * @brief The child of every key byte (NULL if there is none).
+     */
+    ARTNode *children[256];
+
+} ARTNode256;
+
+/**
+ * @brief Displays the values of an adaptive radix tree in ascending order.
+ *
+ * @param root Pointer to the root node of the tree.
+ */
+void displayART(ARTNode *root);
+
+/**
+ * @brief Converts an adaptive radix tree to a string representation. It gives
+ *        the representation as a sorted list in ascending order.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @return A dynamically allocated string representing the tree values in
+ *         ascending order (NULL if allocation fails). The caller is
+ *         responsible for freeing it.
+ */
+char *artToStr(ARTNode *root);
+
+/**
+ * @brief Adds a value to an adaptive radix tree.
+ *
+ * @param root Pointer to the pointer to the root node of the tree.
+ *
+ * @param value The value to be added to the tree.
+ *
+ * @return True if the value was successfully added and false otherwise
+ *         (already existing or allocation failure).
+ */
+bool addARTNode(ARTNode **root, int value);
+
+/**
+ * @brief Finds the leaf holding the specified value in an adaptive radix
+ *        tree.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the leaf holding the value if found and NULL otherwise.
+ */
+ARTLeaf *findARTNode(ARTNode *root, int value);
+
+/**
+ * @brief Deletes the specified value from an adaptive radix tree, shrinking
+ *        the inner node it was under if needed.
+ *
+ * @param root Pointer to the pointer to the root node of the tree.
+ *
+ * @param value The value to be deleted from the tree.
+ *
+ * @return True if the deletion is successful and false otherwise.
+ */
+bool deleteARTNode(ARTNode **root, int value);
+
+/**
+ * @brief Deletes the entire adaptive radix tree.
+ *
+ * @param root Pointer to the pointer to the root node of the tree.
+ */
+void deleteEntireART(ARTNode **root);
+
+/**
+ * @brief Retrieves the number of values in an adaptive radix tree.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @return The number of values in the tree.
+ */
+size_t getARTCount(ARTNode *root);
+
+/**
+ * @brief Retrieves the height of an adaptive radix tree, i.e. the number of
+ *        nodes (inner nodes and leaf) of its longest path. It never exceeds
+ *        five.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @return The height of the tree (zero for an empty tree).
+ */
+size_t getARTHeight(ARTNode *root);
+
+/**
+ * @brief Finds the maximum value in an adaptive radix tree.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @param[out] maxValuePtr Pointer to the variable that will store the maximum
+ *                         value once found.
+ *
+ * @return True if the maximum value is found and stored in `maxValuePtr` and
+ *         false if the tree is empty.
+ */
+bool maxART(ARTNode *root, int *maxValuePtr);
+
+/**
+ * @brief Finds the minimum value in an adaptive radix tree.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @param[out] minValuePtr Pointer to the variable that will store the minimum
+ *                         value once found.
+ *
+ * @return True if the minimum value is found and stored in `minValuePtr` and
+ *         false if the tree is empty.
+ */
+bool minART(ARTNode *root, int *minValuePtr);
+
+/**
+ * @brief Visits the values of an adaptive radix tree in ascending order.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @param visit The function called with every value and context. It returns
+ *              true to go on and false to stop the traversal.
+ *
+ * @param context The pointer passed as is to visit (it can be NULL).
+ *
+ * @return True if all values were visited and false if visit stopped the
+ *         traversal.
+ */
+bool traverseART(ARTNode *root,
+                 bool (*visit)(int value, void *context),
+                 void *context);
+
+/**
+ * @brief Converts an adaptive radix tree into a sorted array.
+ *
+ * @param root Pointer to the root node of the tree.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         values of the tree (NULL for empty tree). The caller is responsible
+ *         for freeing the memory.
+ */
+int *getARTAsSortedArray(ARTNode *root);
+
+#endif
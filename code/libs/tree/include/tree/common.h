@@ -53,4 +53,18 @@ bool setPaddingAndInterSpacing(size_t height,
                                size_t *levelPaddingPtr,
                                size_t *levelInterSpacingPtr);
 
+/**
+ * @brief Converts an array of (sorted) values to a string representation as
+ *        follows: "< >" if empty, "< 122 >" for a single value, and
+ *        "< 1 | 2 | 55 >" for two or more values.
+ *
+ * @param values The array of values (it can be NULL if size is zero).
+ *
+ * @param size The number of values.
+ *
+ * @return A dynamically allocated string (NULL if allocation fails). The
+ *         caller is responsible for freeing it.
+ */
+char *sortedValuesToStr(const int *values, size_t size);
+
 #endif
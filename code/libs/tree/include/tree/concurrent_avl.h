@@ -0,0 +1,231 @@
+/**
+ * @file concurrent_avl.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        concurrent (thread-safe) AVL tree.
+ */
+
+#ifndef CONCURRENT_AVL_H
+#define CONCURRENT_AVL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * REMARK:
+ *
+ * The functions in "avl.h" assume a single thread. Wrapping them in a global
+ * mutex serializes all threads, even readers. The concurrent AVL tree below
+ * allows any number of threads to add, find and delete at the same time:
+ *
+ * 1 - Each node has a version word used as a small lock. Its lowest bit tells
+ *     if the node is locked by a writer, the next bit tells if the node has
+ *     been unlinked from the tree (obsolete) and the remaining bits form a
+ *     counter incremented every time the node is changed.
+ *
+ * 2 - Lookups never lock (optimistic reads). While descending, a reader reads
+ *     the version of a node, reads its child pointer and then checks that the
+ *     version did not change. If it did, the reader restarts from the root.
+ *
+ * 3 - Writers lock only the nodes they change (a node, its parent and, for
+ *     rotations, its child and grandchild), always from top to bottom, which
+ *     avoids deadlocks.
+ *
+ * 4 - Deleting a node with two children only marks it as not present. It then
+ *     acts as a routing node, and it is unlinked later once it has at most one
+ *     child. Balancing is relaxed: heights are fixed by walking up from the
+ *     changed node, one small locked step at a time.
+ *
+ * 5 - Unlinked nodes cannot be freed right away as readers may still be
+ *     visiting them. Every operation runs within an epoch-based reclamation
+ *     critical section (see "reclamation/ebr.h"), and unlinked nodes are
+ *     retired to be freed once no reader can still visit them.
+ *
+ * As in "avl.h", duplicates are not allowed.
+ */
+
+/**
+ * @struct ConcurrentAVLNode
+ *
+ * @brief A concurrent AVL node. Fields that are read by lock-free readers
+ *        are atomic.
+ */
+typedef struct ConcurrentAVLNode {
+    /**
+     * @brief The value stored in the node. It never changes once the node is
+     *        linked to the tree.
+     */
+    int value;
+
+    /**
+     * @brief Tells if the value belongs to the tree. It is false for routing
+     *        nodes, i.e. deleted nodes that are still linked.
+     */
+    atomic_bool present;
+
+    /**
+     * @brief The height of the subtree rooted at this node (one for a leaf).
+     */
+    atomic_int height;
+
+    /**
+     * @brief The version word: bit 0 is the lock, bit 1 is the obsolete flag
+     *        and the remaining bits are the change counter.
+     */
+    _Atomic uint64_t version;
+
+    /**
+     * @brief Pointer to the left node having less value.
+     */
+    struct ConcurrentAVLNode *_Atomic left;
+
+    /**
+     * @brief Pointer to the right node having greater value.
+     */
+    struct ConcurrentAVLNode *_Atomic right;
+
+    /**
+     * @brief Pointer to the parent node. It only changes while the current
+     *        parent is locked.
+     */
+    struct ConcurrentAVLNode *_Atomic parent;
+
+    /**
+     * @brief Pointer to the next node in the retired list (once unlinked).
+     */
+    struct ConcurrentAVLNode *nextRetired;
+
+} ConcurrentAVLNode;
+
+/**
+ * @struct ConcurrentAVLTree
+ *
+ * @brief A concurrent AVL tree. The root is the right child of the holder,
+ *        which is a sentinel node that is never removed.
+ */
+typedef struct ConcurrentAVLTree {
+    /**
+     * @brief The sentinel node whose right child is the root of the tree.
+     */
+    ConcurrentAVLNode holder;
+
+    /**
+     * @brief The list of unlinked nodes that could not be retired (allocation
+     *        failure), to be freed upon destruction.
+     */
+    ConcurrentAVLNode *_Atomic retired;
+
+    /**
+     * @brief The number of values in the tree.
+     */
+    _Atomic size_t count;
+
+} ConcurrentAVLTree;
+
+/**
+ * @brief Initializes an empty concurrent AVL tree. It should be called before
+ *        the tree is shared with other threads.
+ *
+ * @param tree Pointer to the tree to be initialized.
+ */
+void initConcurrentAVL(ConcurrentAVLTree *tree);
+
+/**
+ * @brief Frees all the nodes of a concurrent AVL tree (including the retired
+ *        ones). It should only be called once no other thread uses the tree.
+ *
+ * @param tree Pointer to the tree to be destroyed.
+ */
+void destroyConcurrentAVL(ConcurrentAVLTree *tree);
+
+/**
+ * @brief Converts a concurrent AVL tree to a string representation. It gives
+ *        the representation as a sorted list in ascending order.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @return A dynamically allocated string representing the tree values. The
+ *         caller is responsible for freeing it.
+ *
+ * @note It should only be called while no other thread modifies the tree.
+ */
+char *concurrentAVLToStr(ConcurrentAVLTree *tree);
+
+/**
+ * @brief Adds a value to a concurrent AVL tree. It is thread-safe.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @param value The value to be added to the tree.
+ *
+ * @return True if the value was added, and false if it already exists or if
+ *         allocation fails.
+ */
+bool addConcurrentAVLNode(ConcurrentAVLTree *tree, int value);
+
+/**
+ * @brief Tells if a value exists in a concurrent AVL tree. It is thread-safe
+ *        and lock-free.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return True if the value is found and false otherwise.
+ *
+ * @note Unlike findAVLNode, no node pointer is returned as the node may be
+ *       deleted by another thread right after the call.
+ */
+bool findConcurrentAVLNode(ConcurrentAVLTree *tree, int value);
+
+/**
+ * @brief Deletes a value from a concurrent AVL tree. It is thread-safe.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @param value The value to be deleted.
+ *
+ * @return True if the value was deleted and false if not found.
+ */
+bool deleteConcurrentAVLNode(ConcurrentAVLTree *tree, int value);
+
+/**
+ * @brief Retrieves the number of values in a concurrent AVL tree.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @return The number of values.
+ */
+size_t getConcurrentAVLCount(ConcurrentAVLTree *tree);
+
+/**
+ * @brief Retrieves the height of a concurrent AVL tree (routing nodes are
+ *        counted as they are part of the structure).
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @return The height of the tree as a non-negative integer.
+ *
+ * @note It should only be called while no other thread modifies the tree.
+ */
+size_t getConcurrentAVLHeight(ConcurrentAVLTree *tree);
+
+/**
+ * @brief Converts a concurrent AVL tree into a sorted array.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         values of the tree (NULL for empty tree, allocation failure or if
+ *         the calling thread could not enter an EBR critical section). The
+ *         caller is responsible for freeing the memory.
+ *
+ * @note It should only be called while no other thread modifies the tree.
+ */
+int *getConcurrentAVLAsSortedArray(ConcurrentAVLTree *tree);
+
+#endif
@@ -0,0 +1,206 @@
+/**
+ * @file persistent_avl.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        persistent (immutable) AVL tree.
+ */
+
+#ifndef PERSISTENT_AVL_H
+#define PERSISTENT_AVL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/**
+ * REMARK:
+ *
+ * A persistent tree never changes once built. Adding or deleting a value
+ * gives a new version (a new root) and keeps the old one intact. Only the
+ * nodes on the path from the root to the changed node are copied (path
+ * copying), i.e. O(log n) nodes, whereas all other subtrees are shared
+ * between the old and the new versions.
+ *
+ * Shared nodes are reclaimed using reference counting: every node counts the
+ * parents and the roots (versions) pointing to it. The caller owns one
+ * reference for every version it gets, and should release it once done.
+ * Taking a snapshot is therefore O(1): it only acquires a reference on the
+ * root. The counts are atomic, which allows releasing versions (for instance
+ * snapshots used by long-running reports) from other threads.
+ *
+ * As in "avl.h", duplicates are not allowed.
+ */
+
+/**
+ * @struct PersistentAVLNode
+ *
+ * @brief A persistent AVL node. Its fields should never be modified once it
+ *        is returned, as it may be shared by several versions.
+ */
+typedef struct PersistentAVLNode {
+    /**
+     * @brief The value stored in the node.
+     */
+    int value;
+
+    /**
+     * @brief The height of the subtree rooted at this node (one for a leaf).
+     */
+    int height;
+
+    /**
+     * @brief The number of parents and versions referencing this node.
+     */
+    atomic_size_t refCount;
+
+    /**
+     * @brief Pointer to the left node having less value.
+     */
+    struct PersistentAVLNode *left;
+
+    /**
+     * @brief Pointer to the right node having greater value.
+     */
+    struct PersistentAVLNode *right;
+
+} PersistentAVLNode;
+
+/**
+ * @brief Takes a snapshot of a version in O(1) by acquiring a reference on
+ *        its root.
+ *
+ * @param root Pointer to the root of the version (it can be NULL).
+ *
+ * @return The same root, which the caller should release once done.
+ */
+PersistentAVLNode *acquirePersistentAVL(PersistentAVLNode *root);
+
+/**
+ * @brief Releases a reference on a version. Nodes that are no longer
+ *        referenced by any version are freed.
+ *
+ * @param root Pointer to the root of the version (it can be NULL).
+ */
+void releasePersistentAVL(PersistentAVLNode *root);
+
+/**
+ * @brief Converts a persistent AVL tree version to a string representation. It
+ *        gives the representation as a sorted list in ascending order.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @return A dynamically allocated string representing the values. The caller
+ *         is responsible for freeing it.
+ */
+char *persistentAVLToStr(PersistentAVLNode *root);
+
+/**
+ * @brief Adds a value to a persistent AVL tree version, giving a new version
+ *        sharing all unchanged subtrees with the old one (which is kept).
+ *
+ * @param root Pointer to the root of the old version.
+ *
+ * @param value The value to be added.
+ *
+ * @param[out] newRootPtr Pointer to the variable that will store the root of
+ *                        the new version. It is always set, even if the value
+ *                        is not added (then being the old root), and the
+ *                        caller should release it once done.
+ *
+ * @return True if the value was added, and false if it already exists or if
+ *         allocation fails.
+ */
+bool addPersistentAVLNode(PersistentAVLNode *root,
+                          int value,
+                          PersistentAVLNode **newRootPtr);
+
+/**
+ * @brief Finds a node with the specified value in a persistent AVL version.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the node with the specified value if found and NULL
+ *         otherwise. It remains valid as long as the version is referenced.
+ */
+PersistentAVLNode *findPersistentAVLNode(PersistentAVLNode *root, int value);
+
+/**
+ * @brief Deletes a value from a persistent AVL tree version, giving a new
+ *        version sharing all unchanged subtrees with the old one (which is
+ *        kept).
+ *
+ * @param root Pointer to the root of the old version.
+ *
+ * @param value The value to be deleted.
+ *
+ * @param[out] newRootPtr Pointer to the variable that will store the root of
+ *                        the new version (NULL when empty). It is always set,
+ *                        even if the value is not deleted (then being the old
+ *                        root), and the caller should release it once done.
+ *
+ * @return True if the value was deleted, and false if not found or if
+ *         allocation fails.
+ */
+bool deletePersistentAVLNode(PersistentAVLNode *root,
+                             int value,
+                             PersistentAVLNode **newRootPtr);
+
+/**
+ * @brief Retrieves the number of nodes in a persistent AVL version.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @return The total number of nodes.
+ */
+size_t getPersistentAVLCount(PersistentAVLNode *root);
+
+/**
+ * @brief Retrieves the height of a persistent AVL version. An empty tree has a
+ *        zero height, and a tree with only the root node has a height of one.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @return The height of the tree as a non-negative integer.
+ */
+size_t getPersistentAVLHeight(PersistentAVLNode *root);
+
+/**
+ * @brief Finds the maximum value in a persistent AVL version.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @param[out] maxValuePtr Pointer to the variable that will store the maximum
+ *                         value once found.
+ *
+ * @return True if the maximum value is found and false if the tree is empty.
+ */
+bool maxPersistentAVL(PersistentAVLNode *root, int *maxValuePtr);
+
+/**
+ * @brief Finds the minimum value in a persistent AVL version.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @param[out] minValuePtr Pointer to the variable that will store the minimum
+ *                         value once found.
+ *
+ * @return True if the minimum value is found and false if the tree is empty.
+ */
+bool minPersistentAVL(PersistentAVLNode *root, int *minValuePtr);
+
+/**
+ * @brief Converts a persistent AVL version into a sorted array.
+ *
+ * @param root Pointer to the root of the version.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         values (NULL for empty tree). The caller is responsible for freeing
+ *         the memory.
+ */
+int *getPersistentAVLAsSortedArray(PersistentAVLNode *root);
+
+#endif
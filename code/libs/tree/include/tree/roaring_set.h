@@ -0,0 +1,340 @@
+/**
+ * @file roaring_set.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        compressed integer set (Roaring-style containers).
+ */
+
+#ifndef ROARING_SET_H
+#define ROARING_SET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * REMARK:
+ *
+ * A Roaring set splits every 32-bit value into its high 16 bits (the key) and
+ * its low 16 bits. The values sharing the same key are kept together in a
+ * container, and the containers are kept in an array sorted by key. A
+ * container holds the low bits in the most compact of three forms:
+ *
+ *   - an array: the sorted low bits (2 bytes per value), used for sparse
+ *     chunks of at most ROARING_ARRAY_MAX_SIZE values;
+ *
+ *   - a bitmap: 2^16 bits (8 KB whatever the count), used for dense chunks,
+ *     where a value costs at most 8192 / 4097 bytes and down to 1 bit;
+ *
+ *   - runs: the sorted [start, start + length] intervals (4 bytes per run),
+ *     used for chunks made of long consecutive ranges, where a value can cost
+ *     far less than a bit.
+ *
+ * The array and bitmap forms are switched automatically as values are added
+ * and deleted. Runs are chosen when building from a sorted array, when
+ * optimizing the set (see optimizeRoaringSet) and for the result of union and
+ * intersection of runs. They are kept as long as they stay the most compact.
+ *
+ * In order to keep the order of (signed) int values, the sign bit is flipped
+ * before splitting the value, so that INT_MIN is stored as 0 and INT_MAX as
+ * UINT32_MAX.
+ */
+
+/**
+ * @def ROARING_ARRAY_MAX_SIZE
+ *
+ * @brief The maximum number of values of an array container. Above it, a
+ *        bitmap (8 KB) is smaller than an array (2 bytes per value).
+ */
+#define ROARING_ARRAY_MAX_SIZE 4096
+
+/**
+ * @def ROARING_BITMAP_WORDS
+ *
+ * @brief The number of 64-bit words of a bitmap container (2^16 bits).
+ */
+#define ROARING_BITMAP_WORDS 1024
+
+/**
+ * @enum RoaringContainerType
+ *
+ * @brief The forms a container can take.
+ */
+typedef enum RoaringContainerType {
+    ROARING_ARRAY,
+    ROARING_BITMAP,
+    ROARING_RUN
+} RoaringContainerType;
+
+/**
+ * @struct RoaringRun
+ *
+ * @brief An interval of consecutive low bits [start, start + length].
+ */
+typedef struct RoaringRun {
+    /**
+     * @brief The first low bits of the interval.
+     */
+    uint16_t start;
+
+    /**
+     * @brief The number of values of the interval minus one.
+     */
+    uint16_t length;
+
+} RoaringRun;
+
+/**
+ * @struct RoaringContainer
+ *
+ * @brief The values of a Roaring set sharing the same high 16 bits.
+ */
+typedef struct RoaringContainer {
+    /**
+     * @brief The dynamically allocated content, depending on type.
+     */
+    union {
+        /**
+         * @brief The sorted low bits (ROARING_ARRAY).
+         */
+        uint16_t *array;
+
+        /**
+         * @brief The ROARING_BITMAP_WORDS words of bits (ROARING_BITMAP).
+         */
+        uint64_t *bitmap;
+
+        /**
+         * @brief The sorted non-adjacent intervals (ROARING_RUN).
+         */
+        RoaringRun *runs;
+
+    } data;
+
+    /**
+     * @brief The number of used entries of array or runs (unused for bitmap).
+     */
+    uint32_t size;
+
+    /**
+     * @brief The number of allocated entries of array or runs (unused for
+     *        bitmap).
+     */
+    uint32_t capacity;
+
+    /**
+     * @brief The number of values of the container (1 to 2^16).
+     */
+    uint32_t cardinality;
+
+    /**
+     * @brief The high 16 bits shared by the values of the container.
+     */
+    uint16_t key;
+
+    /**
+     * @brief The form of the container (see RoaringContainerType).
+     */
+    uint8_t type;
+
+} RoaringContainer;
+
+/**
+ * @struct RoaringSet
+ *
+ * @brief A compressed set of int values made of containers sorted by key.
+ *
+ * @note An empty set should be initialized as: RoaringSet set = {0};
+ */
+typedef struct RoaringSet {
+    /**
+     * @brief The dynamically allocated array of non-empty containers sorted
+     *        by key (NULL if never used).
+     */
+    RoaringContainer *containers;
+
+    /**
+     * @brief The number of containers.
+     */
+    size_t numContainers;
+
+    /**
+     * @brief The number of allocated containers.
+     */
+    size_t capacity;
+
+    /**
+     * @brief The number of values in the set.
+     */
+    size_t count;
+
+} RoaringSet;
+
+/**
+ * @brief Displays a Roaring set values in ascending order.
+ *
+ * @param set Pointer to the Roaring set.
+ */
+void displayRoaringSet(RoaringSet *set);
+
+/**
+ * @brief Converts a Roaring set to a string representation. It gives the
+ *        representation as a sorted list in ascending order.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @return A dynamically allocated string representing the set values in
+ *         ascending order (NULL if allocation fails). The caller is
+ *         responsible for freeing it.
+ */
+char *roaringSetToStr(RoaringSet *set);
+
+/**
+ * @brief Adds a value to a Roaring set. Duplicates are not allowed.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @param value The value to be added to the set.
+ *
+ * @return True if the value was added and false otherwise (already existing
+ *         or allocation failure).
+ */
+bool addRoaringValue(RoaringSet *set, int value);
+
+/**
+ * @brief Tells if a value is in a Roaring set.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return True if the value is found and false otherwise.
+ */
+bool findRoaringValue(RoaringSet *set, int value);
+
+/**
+ * @brief Deletes a value from a Roaring set.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @param value The value to be deleted from the set.
+ *
+ * @return True if the deletion is successful and false otherwise (not found
+ *         or allocation failure when splitting a run).
+ */
+bool deleteRoaringValue(RoaringSet *set, int value);
+
+/**
+ * @brief Deletes the entire Roaring set and resets it to an empty one.
+ *
+ * @param set Pointer to the Roaring set.
+ */
+void deleteEntireRoaring(RoaringSet *set);
+
+/**
+ * @brief Retrieves the number of values in a Roaring set in O(1).
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @return The number of values in the set (zero if set is NULL).
+ */
+size_t getRoaringCount(RoaringSet *set);
+
+/**
+ * @brief Retrieves the rank of a value in a Roaring set, i.e. the number of
+ *        values of the set that are less than or equal to it. The value does
+ *        not need to be in the set.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @param value The value whose rank is requested.
+ *
+ * @return The number of values of the set that are less than or equal to
+ *         value.
+ */
+size_t getRoaringRank(RoaringSet *set, int value);
+
+/**
+ * @brief Retrieves the number of bytes used by a Roaring set (the set itself,
+ *        its containers and their content).
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @return The number of bytes used by the set.
+ */
+size_t getRoaringMemoryUsage(RoaringSet *set);
+
+/**
+ * @brief Converts every container of a Roaring set to its most compact form,
+ *        including runs.
+ *
+ * @param set Pointer to the Roaring set.
+ */
+void optimizeRoaringSet(RoaringSet *set);
+
+/**
+ * @brief Builds a Roaring set from an array of values sorted in ascending
+ *        order, such as the one returned by getAVLAsSortedArray. Duplicates
+ *        are allowed and stored once. Every container directly gets its most
+ *        compact form.
+ *
+ * @param set Pointer to the Roaring set. Its previous values are deleted.
+ *
+ * @param sortedValues The array of values (it can be NULL if size is zero).
+ *
+ * @param size The number of values.
+ *
+ * @return True if the set was built and false otherwise (values not sorted or
+ *         allocation failure), in which case the set is left empty.
+ */
+bool buildRoaringFromSortedArray(RoaringSet *set,
+                                 const int *sortedValues,
+                                 size_t size);
+
+/**
+ * @brief Converts a Roaring set into a sorted array.
+ *
+ * @param set Pointer to the Roaring set.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         values of the set (NULL for empty set). The caller is responsible
+ *         for freeing the memory.
+ */
+int *getRoaringAsSortedArray(RoaringSet *set);
+
+/**
+ * @brief Computes the union of two Roaring sets container by container.
+ *
+ * @param set1 Pointer to the first Roaring set.
+ *
+ * @param set2 Pointer to the second Roaring set.
+ *
+ * @param[out] result Pointer to the Roaring set receiving the union. Its
+ *                    previous values are deleted. It can be set1 or set2.
+ *
+ * @return True if the union was computed and false otherwise (allocation
+ *         failure), in which case result is left unchanged.
+ */
+bool getRoaringUnion(RoaringSet *set1, RoaringSet *set2, RoaringSet *result);
+
+/**
+ * @brief Computes the intersection of two Roaring sets container by
+ *        container.
+ *
+ * @param set1 Pointer to the first Roaring set.
+ *
+ * @param set2 Pointer to the second Roaring set.
+ *
+ * @param[out] result Pointer to the Roaring set receiving the intersection.
+ *                    Its previous values are deleted. It can be set1 or set2.
+ *
+ * @return True if the intersection was computed and false otherwise
+ *         (allocation failure), in which case result is left unchanged.
+ */
+bool getRoaringIntersection(RoaringSet *set1,
+                            RoaringSet *set2,
+                            RoaringSet *result);
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * @file scapegoat.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        scapegoat (weight-balanced) tree.
+ */
+
+#ifndef SCAPEGOAT_H
+#define SCAPEGOAT_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "tree/bst.h"
+
+/**
+ * REMARK:
+ *
+ * A scapegoat tree keeps a logarithmic height without storing any balance
+ * information in its nodes. Instead, the tree keeps its node count and the
+ * maximum node count reached since the last full rebuild. When an insertion
+ * creates a node deeper than log_{1/alpha}(maxCount), an ancestor whose
+ * subtree is too unbalanced (the scapegoat) is found and its subtree is
+ * rebuilt into a perfectly balanced one. When deletions bring the count below
+ * alpha * maxCount, the entire tree is rebuilt. Rebuilds are rare and their
+ * cost is amortized to O(log n) per operation, while lookups are worst-case
+ * O(log n) as the height never exceeds log_{1/alpha}(maxCount) + 1.
+ *
+ * Here alpha = 2/3 (see SCAPEGOAT_ALPHA_NUMERATOR and
+ * SCAPEGOAT_ALPHA_DENOMINATOR).
+ */
+
+/**
+ * @def SCAPEGOAT_ALPHA_NUMERATOR
+ *
+ * @brief The numerator of the weight-balance factor alpha (1/2 < alpha < 1).
+ */
+#define SCAPEGOAT_ALPHA_NUMERATOR 2
+
+/**
+ * @def SCAPEGOAT_ALPHA_DENOMINATOR
+ *
+ * @brief The denominator of the weight-balance factor alpha (1/2 < alpha < 1).
+ */
+#define SCAPEGOAT_ALPHA_DENOMINATOR 3
+
+/**
+ * @def SCAPEGOAT_MAX_PATH_LENGTH
+ *
+ * @brief The maximum length of the insertion path kept by addScapegoatNode.
+ *        The height never exceeds log_{1/alpha}(maxCount) + 1, which is less
+ *        than 110 for alpha = 2/3 and a 64-bit count.
+ */
+#define SCAPEGOAT_MAX_PATH_LENGTH 128
+
+/**
+ * @brief A scapegoat tree node. It has exactly the same layout as a binary
+ *        search tree (BST) node (a value, left and right node pointers), and
+ *        thus the same memory footprint.
+ */
+typedef BSTNode ScapegoatNode;
+
+/**
+ * @struct ScapegoatTree
+ *
+ * @brief A scapegoat tree consisting of its root node and the two counters
+ *        needed to decide when to rebuild. These counters are kept once per
+ *        tree and not per node.
+ *
+ * @note An empty tree should be initialized as: ScapegoatTree tree = {0};
+ */
+typedef struct ScapegoatTree {
+    /**
+     * @brief Pointer to the root node of the tree (NULL if empty).
+     */
+    ScapegoatNode *root;
+
+    /**
+     * @brief The number of nodes in the tree.
+     */
+    size_t count;
+
+    /**
+     * @brief The maximum value reached by count since the last full rebuild.
+     */
+    size_t maxCount;
+
+} ScapegoatTree;
+
+/**
+ * @brief Retrieves the nodes at a specific level in a scapegoat tree using a
+ *        prefeed approach. It keeps empty nodes as NULL elements to maintain
+ *        the structural integrity of the tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param height The height of the scapegoat tree.
+ *
+ * @param level The level for which to retrieve the nodes (zero-based index).
+ *
+ * @param previousLevelNodes An array of ScapegoatNode * pointers representing
+ *                           the nodes at the previous level. It should be NULL
+ *                           if level is zero.
+ *
+ * @return A pointer to a dynamically allocated array of ScapegoatNode *
+ *         pointers. The size of the array is 2^level.
+ *
+ * @note The caller is responsible for freeing the returned array.
+ */
+ScapegoatNode **getScapegoatLevelNodesWithPrefeed(
+                                        ScapegoatTree *tree,
+                                        size_t height,
+                                        size_t level,
+                                        ScapegoatNode **previousLevelNodes);
+
+/**
+ * @brief Retrieves the nodes at a specific level in a scapegoat tree. It keeps
+ *        empty nodes as NULL elements to maintain the structural integrity of
+ *        the tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param height The height of the scapegoat tree.
+ *
+ * @param level The level for which to retrieve the nodes (zero-based index).
+ *
+ * @return A pointer to a dynamically allocated array ScapegoatNode * pointers
+ *         of size being 2^level.
+ *
+ * @note The caller is responsible for freeing the returned array.
+ */
+ScapegoatNode **getScapegoatLevelNodes(ScapegoatTree *tree,
+                                       size_t height,
+                                       size_t level);
+
+/**
+ * @brief Displays the levels of a scapegoat tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ */
+void displayScapegoatTree(ScapegoatTree *tree);
+
+/**
+ * @brief Converts a scapegoat tree to a string representation. It gives the
+ *        representation as a sorted list in ascending order.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @return A dynamically allocated string representing the tree values in
+ *         ascending order. The caller is responsible for freeing it.
+ */
+char *scapegoatTreeToStr(ScapegoatTree *tree);
+
+/**
+ * @brief Adds a new node with the specified value to a scapegoat tree,
+ *        rebuilding the subtree rooted at the scapegoat node if the new node
+ *        is too deep. Duplicates are allowed as in BST.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be added to the tree.
+ *
+ * @return True if the value was successfully added and false otherwise
+ *         (allocation failure, or an insertion path reaching
+ *         SCAPEGOAT_MAX_PATH_LENGTH nodes, which the height bound above rules
+ *         out for a tree only modified through this API).
+ */
+bool addScapegoatNode(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Adds a new node with the specified value to a scapegoat tree. It
+ *        utilizes recursive approach.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be added to the tree.
+ *
+ * @return True if the value was successfully added and false otherwise.
+ */
+bool addScapegoatNodeRecursively(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Finds a node with the specified value in a scapegoat tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the node with the specified value if found and NULL
+ *         otherwise.
+ */
+ScapegoatNode *findScapegoatNode(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Finds a node with the specified value in a scapegoat tree. It is
+ *        based on recursive approach.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the node with the specified value if found and NULL
+ *         otherwise.
+ */
+ScapegoatNode *findScapegoatNodeRecursively(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Deletes a node with the specified value from a scapegoat tree. The
+ *        entire tree is rebuilt if its count drops below alpha * maxCount.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be deleted from the tree.
+ *
+ * @return True if the deletion is successful and false otherwise.
+ */
+bool deleteScapegoatNode(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Deletes a node with the specified value from a scapegoat tree. It is
+ *        based on recursive approach.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value to be deleted from the tree.
+ *
+ * @return True if the deletion is successful and false otherwise.
+ */
+bool deleteScapegoatNodeRecursively(ScapegoatTree *tree, int value);
+
+/**
+ * @brief Deletes the entire scapegoat tree and resets its counters.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ */
+void deleteEntireScapegoat(ScapegoatTree *tree);
+
+/**
+ * @brief Retrieves the number of nodes in a scapegoat tree in O(1).
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @return The total number of nodes in the tree (zero if tree is NULL).
+ */
+size_t getScapegoatCount(ScapegoatTree *tree);
+
+/**
+ * @brief Retrieves the height of a scapegoat tree. An empty tree has a zero
+ *        height, and a tree with only the root node has a height of one.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @return The height of the tree as a non-negative integer.
+ */
+size_t getScapegoatHeight(ScapegoatTree *tree);
+
+/**
+ * @brief Finds the maximum value in a scapegoat tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param[out] maxValuePtr Pointer to the variable that will store the maximum
+ *                         value once found.
+ *
+ * @return True if the maximum value is found and stored in `maxValuePtr` and
+ *         false if the tree is empty.
+ */
+bool maxScapegoat(ScapegoatTree *tree, int *maxValuePtr);
+
+/**
+ * @brief Finds the minimum value in a scapegoat tree.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param[out] minValuePtr Pointer to the variable that will store the minimum
+ *                         value once found.
+ *
+ * @return True if the minimum value is found and stored in `minValuePtr` and
+ *         false if the tree is empty.
+ */
+bool minScapegoat(ScapegoatTree *tree, int *minValuePtr);
+
+/**
+ * @brief Converts a scapegoat tree into a sorted array.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         elements of the tree (NULL for empty tree). The caller is
+ *         responsible for freeing the memory.
+ */
+int *getScapegoatAsSortedArray(ScapegoatTree *tree);
+
+#endif
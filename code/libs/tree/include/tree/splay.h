@@ -0,0 +1,251 @@
+/**
+ * @file splay.h
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the data structure and functions associated with
+ *        splay (self-adjusting) tree.
+ */
+
+#ifndef SPLAY_H
+#define SPLAY_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "tree/bst.h"
+
+/**
+ * REMARK:
+ *
+ * A splay tree is a binary search tree that moves every accessed node to the
+ * root by a sequence of rotations (splaying). It keeps no balance information
+ * at all, so recently (and frequently) accessed values stay close to the root
+ * and are found after touching only a few nodes. All operations run in
+ * amortized O(log n) time, but a single operation can still cost O(n).
+ *
+ * As lookups restructure the tree, find functions take a pointer to the root
+ * pointer, unlike their BST and AVL counterparts.
+ *
+ * The recursive versions splay bottom-up using recursion, whose depth is the
+ * depth of the accessed node. As a splay tree can temporarily degenerate into
+ * a linked list (e.g. after inserting sorted values), prefer the iterative
+ * (top-down) versions for large trees.
+ */
+
+/**
+ * @brief A splay tree node. It has exactly the same layout as a binary search
+ *        tree (BST) node (a value, left and right node pointers), as a splay
+ *        tree needs no extra per-node metadata. Left subtree values are less
+ *        than or equal to the node value and right subtree values are greater
+ *        than or equal to it (duplicates are allowed as in BST).
+ *
+ * @note Being a BSTNode, all read-only functions of "bst.h" can be applied to
+ *       a splay tree as well.
+ */
+typedef BSTNode SplayNode;
+
+/**
+ * @brief Retrieves the nodes at a specific level in a splay tree using a
+ *        prefeed approach. It keeps empty nodes as NULL elements to maintain
+ *        the structural integrity of the splay tree.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @param height The height of the splay tree.
+ *
+ * @param level The level for which to retrieve the nodes (zero-based index).
+ *
+ * @param previousLevelNodes An array of SplayNode * pointers representing the
+ *                           nodes at the previous level. It should be NULL if
+ *                           level is zero.
+ *
+ * @return A pointer to a dynamically allocated array of SplayNode * pointers.
+ *         The size of the array is 2^level.
+ *
+ * @note The caller is responsible for freeing the memory allocated for the
+ *       returned array using the free() function.
+ */
+SplayNode **getSplayLevelNodesWithPrefeed(SplayNode *root,
+                                          size_t height,
+                                          size_t level,
+                                          SplayNode **previousLevelNodes);
+
+/**
+ * @brief Retrieves the nodes at a specific level in a splay tree. It keeps
+ *        empty nodes as NULL elements to maintain the structural integrity of
+ *        the splay tree.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @param height The height of the splay tree.
+ *
+ * @param level The level for which to retrieve the nodes (zero-based index).
+ *
+ * @return A pointer to a dynamically allocated array SplayNode * pointers of
+ *         size being 2^level.
+ *
+ * @note The caller is responsible for freeing the memory allocated for the
+ *       returned array using the free() function.
+ */
+SplayNode **getSplayLevelNodes(SplayNode *root, size_t height, size_t level);
+
+/**
+ * @brief Displays the levels of a splay tree.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ */
+void displaySplayTree(SplayNode *root);
+
+/**
+ * @brief Converts a splay tree to a string representation. It gives the
+ *        representation as a sorted list in ascending order.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @return A dynamically allocated string representing the splay tree values
+ *         in ascending order. The caller is responsible for freeing the memory
+ *         allocated for the string.
+ */
+char *splayTreeToStr(SplayNode *root);
+
+/**
+ * @brief Adds a new node with the specified value to a splay tree. The new
+ *        node becomes the root of the tree.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be added to the splay tree.
+ *
+ * @return True if the value was successfully added to the splay tree and
+ *         false otherwise.
+ */
+bool addSplayNode(SplayNode **root, int value);
+
+/**
+ * @brief Adds a new node with the specified value to a splay tree. The new
+ *        node becomes the root of the tree. It utilizes recursive approach.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be added to the splay tree.
+ *
+ * @return True if the value was successfully added to the splay tree and
+ *         false otherwise.
+ */
+bool addSplayNodeRecursively(SplayNode **root, int value);
+
+/**
+ * @brief Finds a node with the specified value in a splay tree and splays it
+ *        to the root. If the value does not exist, the last node visited
+ *        during the search becomes the root.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the node with the specified value if found (being the
+ *         new root) and NULL otherwise.
+ */
+SplayNode *findSplayNode(SplayNode **root, int value);
+
+/**
+ * @brief Finds a node with the specified value in a splay tree and splays it
+ *        to the root. It is based on recursive approach.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @return Pointer to the node with the specified value if found (being the
+ *         new root) and NULL otherwise.
+ */
+SplayNode *findSplayNodeRecursively(SplayNode **root, int value);
+
+/**
+ * @brief Deletes a node with the specified value from a splay tree.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be deleted from the splay tree.
+ *
+ * @return True if the deletion is successful and false otherwise.
+ */
+bool deleteSplayNode(SplayNode **root, int value);
+
+/**
+ * @brief Deletes a node with the specified value from a splay tree. It is
+ *        based on recursive approach.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ *
+ * @param value The value to be deleted from the splay tree.
+ *
+ * @return True if the deletion is successful and false otherwise.
+ */
+bool deleteSplayNodeRecursively(SplayNode **root, int value);
+
+/**
+ * @brief Deletes the entire splay tree.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree.
+ */
+void deleteEntireSplay(SplayNode **root);
+
+/**
+ * @brief Retrieves the number of nodes in a splay tree.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @return The total number of nodes in the splay tree.
+ */
+size_t getSplayCount(SplayNode *root);
+
+/**
+ * @brief Retrieves the height of a splay tree. An empty tree has a zero
+ *        height, and a tree with only the root node has a height of one.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @return The height of the splay tree as a non-negative integer.
+ */
+size_t getSplayHeight(SplayNode *root);
+
+/**
+ * @brief Finds the maximum value in a splay tree (without splaying).
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @param[out] maxValuePtr Pointer to the variable that will store the maximum
+ *                         value once found.
+ *
+ * @return True if the maximum value is found and stored in `maxValuePtr` and
+ *         false if the splay tree is empty (root is `NULL`).
+ */
+bool maxSplay(SplayNode *root, int *maxValuePtr);
+
+/**
+ * @brief Finds the minimum value in a splay tree (without splaying).
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @param[out] minValuePtr Pointer to the variable that will store the minimum
+ *                         value once found.
+ *
+ * @return True if the minimum value is found and stored in `minValuePtr` and
+ *         false if the splay tree is empty (root is `NULL`).
+ */
+bool minSplay(SplayNode *root, int *minValuePtr);
+
+/**
+ * @brief Converts a splay tree into a sorted array.
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @return Pointer to the dynamically allocated array containing the sorted
+ *         elements of the splay tree (NULL for empty tree). The caller is
+ *         responsible for freeing the memory.
+ */
+int *getSplayAsSortedArray(SplayNode *root);
+
+#endif
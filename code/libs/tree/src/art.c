@@ -0,0 +1,812 @@
+/**
+ * @file art.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with adaptive radix tree (ART).
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "tree/art.h"
+#include "tree/common.h"
+
+/**
+ * REMARK:
+ *
+ * SSE2 is part of every x86-64 processor. Defining ART_NO_SIMD forces the
+ * portable search of ARTNode16 key bytes (e.g., to compare both).
+ */
+#if !defined(ART_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define ART_USE_SSE2
+#endif
+
+/**
+ * @brief Returns a key byte of a value (0 being the most significant one).
+ *        The sign bit is flipped, so that the byte order is the value order.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint8_t getKeyByte(int value, size_t depth) {
+    uint32_t key = (uint32_t) ((int64_t) value + 2147483648);
+
+    return (uint8_t) (key >> (24 - 8 * depth));
+}
+
+#ifdef ART_USE_SSE2
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int getLowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+
+    while(!(mask & 1)) {
+        mask >>= 1;
+        index += 1;
+    }
+
+    return index;
+#endif
+}
+#endif
+
+/**
+ * @brief Returns the index of a key byte in an ARTNode16 (-1 if not found).
+ *        The 16 key bytes are compared at once using SSE2 if available.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int searchNode16(const ARTNode16 *node, uint8_t byte) {
+    int index = -1;
+
+#ifdef ART_USE_SSE2
+    __m128i keys = _mm_loadu_si128((const __m128i *) node->keys);
+    uint32_t mask = (uint32_t) _mm_movemask_epi8(
+                        _mm_cmpeq_epi8(keys, _mm_set1_epi8((char) byte)));
+
+    // Ignoring the unused key bytes
+    mask &= (1U << node->header.numChildren) - 1;
+
+    if(mask) {
+        index = getLowestBit(mask);
+    }
+#else
+    for(int i = 0; index < 0 && i < node->header.numChildren; ++i) {
+        if(node->keys[i] == byte) {
+            index = i;
+        }
+    }
+#endif
+
+    return index;
+}
+
+/**
+ * @brief Creates an inner node with no children.
+ *
+ * @return Pointer to the created node and NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ARTNode *createNode(ARTNodeType type) {
+    ARTNode *node;
+
+    if(type == ART_NODE4) {
+        node = calloc(1, sizeof(ARTNode4));
+    }
+    else if(type == ART_NODE16) {
+        node = calloc(1, sizeof(ARTNode16));
+    }
+    else if(type == ART_NODE48) {
+        node = calloc(1, sizeof(ARTNode48));
+    }
+    else {
+        node = calloc(1, sizeof(ARTNode256));
+    }
+
+    if(node) {
+        node->type = type;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Creates a leaf holding a value.
+ *
+ * @return Pointer to the created leaf and NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ARTLeaf *createLeaf(int value) {
+    ARTLeaf *leaf = calloc(1, sizeof(ARTLeaf));
+
+    if(leaf) {
+        leaf->header.type = ART_LEAF;
+        leaf->value = value;
+    }
+
+    return leaf;
+}
+
+/**
+ * @brief Copies the prefix and the number of children of a node into another
+ *        one (of another size).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void copyHeader(ARTNode *destination, const ARTNode *source) {
+    destination->prefixLength = source->prefixLength;
+    memcpy(destination->prefix, source->prefix, source->prefixLength);
+    destination->numChildren = source->numChildren;
+}
+
+/**
+ * @brief Finds the child of an inner node for a key byte.
+ *
+ * @return Pointer to the pointer to the child (so that it can be replaced)
+ *         and NULL if there is no such child.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ARTNode **findChild(ARTNode *node, uint8_t byte) {
+    ARTNode **child = NULL;
+
+    if(node->type == ART_NODE4) {
+        ARTNode4 *node4 = (ARTNode4 *) node;
+
+        for(int i = 0; !child && i < node->numChildren; ++i) {
+            if(node4->keys[i] == byte) {
+                child = &node4->children[i];
+            }
+        }
+    }
+    else if(node->type == ART_NODE16) {
+        int index = searchNode16((ARTNode16 *) node, byte);
+
+        if(index >= 0) {
+            child = &((ARTNode16 *) node)->children[index];
+        }
+    }
+    else if(node->type == ART_NODE48) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+
+        if(node48->childIndex[byte]) {
+            child = &node48->children[node48->childIndex[byte] - 1];
+        }
+    }
+    else if(((ARTNode256 *) node)->children[byte]) {
+        child = &((ARTNode256 *) node)->children[byte];
+    }
+
+    return child;
+}
+
+/**
+ * @brief Returns the next child of an inner node in key byte order.
+ *
+ * @param node Pointer to the inner node.
+ *
+ * @param positionPtr Pointer to the position to start from (zero for the
+ *                    first child). It is moved past the returned child.
+ *
+ * @return Pointer to the next child and NULL if there is none.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ARTNode *getNextChild(ARTNode *node, size_t *positionPtr) {
+    ARTNode *child = NULL;
+
+    if(node->type == ART_NODE4 || node->type == ART_NODE16) {
+        if(*positionPtr < node->numChildren) {
+            child = node->type == ART_NODE4 ?
+                    ((ARTNode4 *) node)->children[*positionPtr] :
+                    ((ARTNode16 *) node)->children[*positionPtr];
+            *positionPtr += 1;
+        }
+    }
+    else if(node->type == ART_NODE48) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+
+        while(!child && *positionPtr < 256) {
+            uint8_t slot = node48->childIndex[*positionPtr];
+
+            child = slot ? node48->children[slot - 1] : NULL;
+            *positionPtr += 1;
+        }
+    }
+    else {
+        while(!child && *positionPtr < 256) {
+            child = ((ARTNode256 *) node)->children[*positionPtr];
+            *positionPtr += 1;
+        }
+    }
+
+    return child;
+}
+
+/**
+ * @brief Returns the last child of an inner node in key byte order.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ARTNode *getLastChild(ARTNode *node) {
+    ARTNode *child = NULL;
+
+    if(node->type == ART_NODE4) {
+        child = ((ARTNode4 *) node)->children[node->numChildren - 1];
+    }
+    else if(node->type == ART_NODE16) {
+        child = ((ARTNode16 *) node)->children[node->numChildren - 1];
+    }
+    else if(node->type == ART_NODE48) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+
+        for(int byte = 255; !child && byte >= 0; --byte) {
+            uint8_t slot = node48->childIndex[byte];
+
+            child = slot ? node48->children[slot - 1] : NULL;
+        }
+    }
+    else {
+        for(int byte = 255; !child && byte >= 0; --byte) {
+            child = ((ARTNode256 *) node)->children[byte];
+        }
+    }
+
+    return child;
+}
+
+/**
+ * @brief Adds a child for a key byte to an inner node having room for it.
+ *        The key bytes of ARTNode4 and ARTNode16 are kept sorted.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void addChild(ARTNode *node, uint8_t byte, ARTNode *child) {
+    if(node->type == ART_NODE4 || node->type == ART_NODE16) {
+        uint8_t *keys = node->type == ART_NODE4 ? ((ARTNode4 *) node)->keys
+                                                : ((ARTNode16 *) node)->keys;
+        ARTNode **children = node->type == ART_NODE4 ?
+                             ((ARTNode4 *) node)->children :
+                             ((ARTNode16 *) node)->children;
+        size_t index = 0;
+
+        while(index < node->numChildren && keys[index] < byte) {
+            ++index;
+        }
+
+        memmove(&keys[index + 1], &keys[index], node->numChildren - index);
+        memmove(&children[index + 1],
+                &children[index],
+                (node->numChildren - index) * sizeof(ARTNode *));
+        keys[index] = byte;
+        children[index] = child;
+    }
+    else if(node->type == ART_NODE48) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+        uint8_t slot = 0;
+
+        while(node48->children[slot]) {
+            ++slot;
+        }
+
+        node48->children[slot] = child;
+        node48->childIndex[byte] = slot + 1;
+    }
+    else {
+        ((ARTNode256 *) node)->children[byte] = child;
+    }
+
+    node->numChildren += 1;
+}
+
+/**
+ * @brief Removes the child of a key byte from an inner node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void removeChild(ARTNode *node, uint8_t byte) {
+    if(node->type == ART_NODE4 || node->type == ART_NODE16) {
+        uint8_t *keys = node->type == ART_NODE4 ? ((ARTNode4 *) node)->keys
+                                                : ((ARTNode16 *) node)->keys;
+        ARTNode **children = node->type == ART_NODE4 ?
+                             ((ARTNode4 *) node)->children :
+                             ((ARTNode16 *) node)->children;
+        size_t index = 0;
+
+        while(keys[index] != byte) {
+            ++index;
+        }
+
+        memmove(&keys[index], &keys[index + 1], node->numChildren - index - 1);
+        memmove(&children[index],
+                &children[index + 1],
+                (node->numChildren - index - 1) * sizeof(ARTNode *));
+    }
+    else if(node->type == ART_NODE48) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+
+        node48->children[node48->childIndex[byte] - 1] = NULL;
+        node48->childIndex[byte] = 0;
+    }
+    else {
+        ((ARTNode256 *) node)->children[byte] = NULL;
+    }
+
+    node->numChildren -= 1;
+}
+
+/**
+ * @brief Tells if an inner node has no room for another child.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool isFull(const ARTNode *node) {
+    return (node->type == ART_NODE4 && node->numChildren == 4) ||
+           (node->type == ART_NODE16 && node->numChildren == 16) ||
+           (node->type == ART_NODE48 && node->numChildren == 48);
+}
+
+/**
+ * @brief Replaces a full inner node by a node of the next size holding the
+ *        same children.
+ *
+ * @param nodeRef Pointer to the pointer to the full inner node.
+ *
+ * @return True if the node was replaced and false otherwise (allocation
+ *         failure, in which case the node is unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool growNode(ARTNode **nodeRef) {
+    ARTNode *node = *nodeRef;
+    ARTNode *bigger = createNode(node->type + 1);
+
+    if(bigger && node->type == ART_NODE4) {
+        memcpy(((ARTNode16 *) bigger)->keys, ((ARTNode4 *) node)->keys, 4);
+        memcpy(((ARTNode16 *) bigger)->children,
+               ((ARTNode4 *) node)->children,
+               4 * sizeof(ARTNode *));
+    }
+    else if(bigger && node->type == ART_NODE16) {
+        ARTNode16 *node16 = (ARTNode16 *) node;
+        ARTNode48 *node48 = (ARTNode48 *) bigger;
+
+        for(uint8_t i = 0; i < 16; ++i) {
+            node48->children[i] = node16->children[i];
+            node48->childIndex[node16->keys[i]] = i + 1;
+        }
+    }
+    else if(bigger) {
+        ARTNode48 *node48 = (ARTNode48 *) node;
+
+        for(int byte = 0; byte < 256; ++byte) {
+            if(node48->childIndex[byte]) {
+                ((ARTNode256 *) bigger)->children[byte] =
+                    node48->children[node48->childIndex[byte] - 1];
+            }
+        }
+    }
+
+    if(bigger) {
+        copyHeader(bigger, node);
+        free(node);
+        *nodeRef = bigger;
+    }
+
+    return bigger != NULL;
+}
+
+/**
+ * @brief Replaces an inner node that lost a child by a smaller one if it has
+ *        few enough children left. Shrinking happens below the growing
+ *        thresholds (ARTNode256 to ARTNode48 at 37 children, ARTNode48 to
+ *        ARTNode16 at 12 and ARTNode16 to ARTNode4 at 3), so that adding and
+ *        deleting around a threshold does not reallocate every time. An
+ *        ARTNode4 left with a single child is replaced by that child, whose
+ *        prefix is extended accordingly. If allocation fails, the node is
+ *        kept as is.
+ *
+ * @param nodeRef Pointer to the pointer to the inner node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void shrinkNode(ARTNode **nodeRef) {
+    ARTNode *node = *nodeRef;
+    ARTNode *smaller = NULL;
+
+    if(node->type == ART_NODE4 && node->numChildren == 1) {
+        ARTNode4 *node4 = (ARTNode4 *) node;
+        ARTNode *child = node4->children[0];
+
+        if(child->type != ART_LEAF) {
+            // Prefix of the node, then key byte of the child, then its prefix
+            uint8_t prefix[ART_MAX_PREFIX_LENGTH];
+            size_t length = node->prefixLength;
+
+            memcpy(prefix, node->prefix, length);
+            prefix[length++] = node4->keys[0];
+            memcpy(&prefix[length], child->prefix, child->prefixLength);
+            length += child->prefixLength;
+
+            memcpy(child->prefix, prefix, length);
+            child->prefixLength = (uint8_t) length;
+        }
+
+        *nodeRef = child;
+        free(node);
+    }
+    else if(node->type == ART_NODE16 && node->numChildren <= 3) {
+        smaller = createNode(ART_NODE4);
+
+        if(smaller) {
+            memcpy(((ARTNode4 *) smaller)->keys,
+                   ((ARTNode16 *) node)->keys,
+                   node->numChildren);
+            memcpy(((ARTNode4 *) smaller)->children,
+                   ((ARTNode16 *) node)->children,
+                   node->numChildren * sizeof(ARTNode *));
+        }
+    }
+    else if(node->type == ART_NODE48 && node->numChildren <= 12) {
+        smaller = createNode(ART_NODE16);
+
+        for(int byte = 0, i = 0; smaller && byte < 256; ++byte) {
+            uint8_t slot = ((ARTNode48 *) node)->childIndex[byte];
+
+            if(slot) {
+                ((ARTNode16 *) smaller)->keys[i] = (uint8_t) byte;
+                ((ARTNode16 *) smaller)->children[i++] =
+                    ((ARTNode48 *) node)->children[slot - 1];
+            }
+        }
+    }
+    else if(node->type == ART_NODE256 && node->numChildren <= 37) {
+        smaller = createNode(ART_NODE48);
+
+        for(int byte = 0, slot = 0; smaller && byte < 256; ++byte) {
+            ARTNode *child = ((ARTNode256 *) node)->children[byte];
+
+            if(child) {
+                ((ARTNode48 *) smaller)->children[slot++] = child;
+                ((ARTNode48 *) smaller)->childIndex[byte] = (uint8_t) slot;
+            }
+        }
+    }
+
+    if(smaller) {
+        copyHeader(smaller, node);
+        free(node);
+        *nodeRef = smaller;
+    }
+}
+
+/**
+ * @brief Counts a visited value (see traverseART).
+ *
+ * @param value The visited value.
+ *
+ * @param context Pointer to the size_t counter.
+ *
+ * @return True to go on with the traversal.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool countValue(int value, void *context) {
+    (void) value;
+    *(size_t *) context += 1;
+
+    return true;
+}
+
+/**
+ * @brief Appends a visited value to an array (see traverseART).
+ *
+ * @param value The visited value.
+ *
+ * @param context Pointer to the pointer to the next array entry to write.
+ *
+ * @return True to go on with the traversal.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool appendValue(int value, void *context) {
+    int **nextPtr = context;
+
+    **nextPtr = value;
+    *nextPtr += 1;
+
+    return true;
+}
+
+void displayART(ARTNode *root) {
+    char *str = artToStr(root);
+
+    if(str) {
+        printf("\n%s\n", str);
+        free(str);
+    }
+}
+
+char *artToStr(ARTNode *root) {
+    char *str = NULL;
+    size_t size = getARTCount(root);
+    int *sortedValues = getARTAsSortedArray(root);
+
+    if(size == 0 || sortedValues) {
+        str = sortedValuesToStr(sortedValues, size);
+        free(sortedValues);
+    }
+
+    return str;
+}
+
+bool addARTNode(ARTNode **root, int value) {
+    bool added = false;
+    ARTLeaf *leaf = root ? createLeaf(value) : NULL;
+    ARTNode **nodeRef = root;
+    size_t depth = 0;
+    bool done = !leaf;
+
+    while(!done) {
+        ARTNode *node = *nodeRef;
+
+        if(!node) {
+            *nodeRef = &leaf->header;
+            added = done = true;
+        }
+        else if(node->type == ART_LEAF) {
+            int otherValue = ((ARTLeaf *) node)->value;
+
+            if(otherValue != value) {
+                // Both values go below a node holding their common key bytes
+                ARTNode *parent = createNode(ART_NODE4);
+
+                if(parent) {
+                    while(getKeyByte(value, depth) ==
+                          getKeyByte(otherValue, depth)) {
+                        parent->prefix[parent->prefixLength++] =
+                            getKeyByte(value, depth++);
+                    }
+
+                    addChild(parent, getKeyByte(otherValue, depth), node);
+                    addChild(parent, getKeyByte(value, depth), &leaf->header);
+                    *nodeRef = parent;
+                    added = true;
+                }
+            }
+
+            done = true;
+        }
+        else {
+            size_t matched = 0;
+
+            while(matched < node->prefixLength &&
+                  node->prefix[matched] == getKeyByte(value,
+                                                      depth + matched)) {
+                ++matched;
+            }
+
+            if(matched < node->prefixLength) {
+                // The prefix is split by a node holding its matched part
+                ARTNode *parent = createNode(ART_NODE4);
+
+                if(parent) {
+                    parent->prefixLength = (uint8_t) matched;
+                    memcpy(parent->prefix, node->prefix, matched);
+                    addChild(parent, node->prefix[matched], node);
+                    addChild(parent,
+                             getKeyByte(value, depth + matched),
+                             &leaf->header);
+
+                    node->prefixLength -= (uint8_t) (matched + 1);
+                    memmove(node->prefix,
+                            &node->prefix[matched + 1],
+                            node->prefixLength);
+                    *nodeRef = parent;
+                    added = true;
+                }
+
+                done = true;
+            }
+            else {
+                uint8_t byte = getKeyByte(value, depth + node->prefixLength);
+                ARTNode **childRef = findChild(node, byte);
+
+                if(childRef) {
+                    nodeRef = childRef;
+                    depth += node->prefixLength + 1;
+                }
+                else {
+                    added = !isFull(node) || growNode(nodeRef);
+
+                    if(added) {
+                        addChild(*nodeRef, byte, &leaf->header);
+                    }
+
+                    done = true;
+                }
+            }
+        }
+    }
+
+    if(!added) {
+        free(leaf);
+    }
+
+    return added;
+}
+
+ARTLeaf *findARTNode(ARTNode *root, int value) {
+    ARTNode *node = root;
+    size_t depth = 0;
+
+    /**
+     * The prefixes are skipped without being compared, as the leaf holds the
+     * whole value which is compared at the end anyway.
+     */
+    while(node && node->type != ART_LEAF) {
+        ARTNode **childRef;
+
+        depth += node->prefixLength;
+        childRef = findChild(node, getKeyByte(value, depth));
+        node = childRef ? *childRef : NULL;
+        depth += 1;
+    }
+
+    return node && ((ARTLeaf *) node)->value == value ? (ARTLeaf *) node
+                                                      : NULL;
+}
+
+bool deleteARTNode(ARTNode **root, int value) {
+    bool deleted = false;
+    ARTNode **nodeRef = root;
+    ARTNode **parentRef = NULL;
+    uint8_t byte = 0;
+    size_t depth = 0;
+
+    while(nodeRef && *nodeRef && (*nodeRef)->type != ART_LEAF) {
+        depth += (*nodeRef)->prefixLength;
+        byte = getKeyByte(value, depth);
+        parentRef = nodeRef;
+        nodeRef = findChild(*nodeRef, byte);
+        depth += 1;
+    }
+
+    if(nodeRef && *nodeRef && ((ARTLeaf *) *nodeRef)->value == value) {
+        free(*nodeRef);
+
+        if(parentRef) {
+            removeChild(*parentRef, byte);
+            shrinkNode(parentRef);
+        }
+        else {
+            *nodeRef = NULL;
+        }
+
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+void deleteEntireART(ARTNode **root) {
+    if(root && *root) {
+        if((*root)->type != ART_LEAF) {
+            size_t position = 0;
+            ARTNode *child;
+
+            while((child = getNextChild(*root, &position))) {
+                deleteEntireART(&child);
+            }
+        }
+
+        free(*root);
+        *root = NULL;
+    }
+}
+
+size_t getARTCount(ARTNode *root) {
+    size_t count = 0;
+
+    traverseART(root, countValue, &count);
+
+    return count;
+}
+
+size_t getARTHeight(ARTNode *root) {
+    size_t height = 0;
+
+    if(root && root->type == ART_LEAF) {
+        height = 1;
+    }
+    else if(root) {
+        size_t position = 0;
+        ARTNode *child;
+
+        while((child = getNextChild(root, &position))) {
+            size_t childHeight = getARTHeight(child);
+
+            height = childHeight > height ? childHeight : height;
+        }
+
+        height += 1;
+    }
+
+    return height;
+}
+
+bool maxART(ARTNode *root, int *maxValuePtr) {
+    ARTNode *node = root;
+
+    while(node && node->type != ART_LEAF) {
+        node = getLastChild(node);
+    }
+
+    if(node) {
+        *maxValuePtr = ((ARTLeaf *) node)->value;
+    }
+
+    return node != NULL;
+}
+
+bool minART(ARTNode *root, int *minValuePtr) {
+    ARTNode *node = root;
+
+    while(node && node->type != ART_LEAF) {
+        size_t position = 0;
+        node = getNextChild(node, &position);
+    }
+
+    if(node) {
+        *minValuePtr = ((ARTLeaf *) node)->value;
+    }
+
+    return node != NULL;
+}
+
+bool traverseART(ARTNode *root,
+                 bool (*visit)(int value, void *context),
+                 void *context) {
+    bool completed = true;
+
+    if(root && root->type == ART_LEAF) {
+        completed = visit(((ARTLeaf *) root)->value, context);
+    }
+    else if(root) {
+        size_t position = 0;
+        ARTNode *child;
+
+        while(completed && (child = getNextChild(root, &position))) {
+            completed = traverseART(child, visit, context);
+        }
+    }
+
+    return completed;
+}
+
+int *getARTAsSortedArray(ARTNode *root) {
+    int *sortedArray = NULL;
+
+    if(root) {
+        sortedArray = malloc(getARTCount(root) * sizeof(int));
+
+        if(sortedArray) {
+            int *next = sortedArray;
+            traverseART(root, appendValue, &next);
+        }
+    }
+
+    return sortedArray;
+}
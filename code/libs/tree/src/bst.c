@@ -579,6 +579,7 @@ bool deleteBSTNodeRecursively(BSTNode **root, int value) {
                     }
                 }
 
+                deleted = true;
             }
             else {
                 if(value < (*root)->value) {
@@ -7,6 +7,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "tree/common.h"
 
@@ -112,3 +114,34 @@ bool setPaddingAndInterSpacing(size_t height,
 
     return done;
 }
+
+char *sortedValuesToStr(const int *values, size_t size) {
+    /**
+     * An int needs at most 11 characters (including the sign) and every
+     * separator " | " needs 3. We then shrink the memory to fit the string.
+     */
+    char *str = malloc((14 * size + 4) * sizeof(char));
+
+    if(str) {
+        if(size == 0) {
+            strcpy(str, "< >");
+        }
+        else {
+            size_t length = sprintf(str, "< ");
+
+            for(size_t i = 0; i < size - 1; ++i) {
+                length += sprintf(str + length, "%d | ", values[i]);
+            }
+
+            // Adding last element
+            length += sprintf(str + length, "%d >", values[size - 1]);
+
+            char *shrunkStr = realloc(str, (length + 1) * sizeof(char));
+            if(shrunkStr) {
+                str = shrunkStr;
+            }
+        }
+    }
+
+    return str;
+}
@@ -0,0 +1,781 @@
+/**
+ * @file concurrent_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with concurrent (thread-safe) AVL tree.
+ */
+
+// Needed for sched_yield as we compile in strict C standard mode
+#define _POSIX_C_SOURCE 200809L
+
+#include <sched.h>
+
+#include "reclamation/ebr.h"
+#include "tree/common.h"
+#include "tree/concurrent_avl.h"
+
+/**
+ * @brief The bit of the version word telling that the node is locked.
+ */
+#define LOCKED_BIT ((uint64_t) 1)
+
+/**
+ * @brief The bit of the version word telling that the node was unlinked.
+ */
+#define OBSOLETE_BIT ((uint64_t) 2)
+
+/**
+ * @brief The increment of the version word upon every change.
+ */
+#define VERSION_STEP ((uint64_t) 4)
+
+/**
+ * @brief The number of busy-wait iterations before yielding the processor
+ *        while waiting for a locked node.
+ */
+#define SPINS_BEFORE_YIELD 64
+
+/**
+ * @brief Waits a little while another thread holds a node lock. It yields the
+ *        processor from time to time so that a preempted lock holder can run.
+ *
+ * @param spinsPtr Pointer to the number of iterations waited so far.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void backOff(unsigned *spinsPtr) {
+    if(++(*spinsPtr) % SPINS_BEFORE_YIELD == 0) {
+        sched_yield();
+    }
+}
+
+/**
+ * @brief Reads the version of a node once it is not locked.
+ *
+ * @param node Pointer to the node.
+ *
+ * @return The (unlocked) version of the node, which may be obsolete.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint64_t readVersion(ConcurrentAVLNode *node) {
+    unsigned spins = 0;
+    uint64_t version = atomic_load(&node->version);
+
+    while(version & LOCKED_BIT) {
+        backOff(&spins);
+        version = atomic_load(&node->version);
+    }
+
+    return version;
+}
+
+/**
+ * @brief Tells if a node did not change since its version was read.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool validate(ConcurrentAVLNode *node, uint64_t version) {
+    return atomic_load(&node->version) == version;
+}
+
+/**
+ * @brief Locks a node only if it did not change since its version was read.
+ *        It never waits.
+ *
+ * @return True if the node got locked and false otherwise.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool tryUpgrade(ConcurrentAVLNode *node, uint64_t version) {
+    return atomic_compare_exchange_strong(&node->version,
+                                          &version,
+                                          version | LOCKED_BIT);
+}
+
+/**
+ * @brief Locks a node, waiting as long as another thread holds its lock.
+ *
+ * @param node Pointer to the node.
+ *
+ * @return The version of the node just before locking it.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint64_t lockNode(ConcurrentAVLNode *node) {
+    unsigned spins = 0;
+    uint64_t version = atomic_load(&node->version);
+
+    while((version & LOCKED_BIT) ||
+          !atomic_compare_exchange_weak(&node->version,
+                                        &version,
+                                        version | LOCKED_BIT)) {
+        backOff(&spins);
+        version = atomic_load(&node->version);
+    }
+
+    return version;
+}
+
+/**
+ * @brief Unlocks a changed node by incrementing its version (the obsolete bit
+ *        is kept), so that optimistic readers notice the change.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void unlockNode(ConcurrentAVLNode *node) {
+    uint64_t version = atomic_load(&node->version);
+
+    atomic_store(&node->version, (version & ~LOCKED_BIT) + VERSION_STEP);
+}
+
+/**
+ * @brief Unlocks a node that was not changed by restoring its version, so
+ *        that optimistic readers do not restart for nothing.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void unlockNodeUnchanged(ConcurrentAVLNode *node, uint64_t version) {
+    atomic_store(&node->version, version);
+}
+
+/**
+ * @brief Retrieves the height of a possibly NULL node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int heightOf(ConcurrentAVLNode *node) {
+    return node ? atomic_load(&node->height) : 0;
+}
+
+/**
+ * @brief Recomputes the height of a node out of its children heights.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void updateHeight(ConcurrentAVLNode *node) {
+    int leftHeight = heightOf(atomic_load(&node->left));
+    int rightHeight = heightOf(atomic_load(&node->right));
+
+    atomic_store(&node->height,
+                 1 + (leftHeight > rightHeight ? leftHeight : rightHeight));
+}
+
+/**
+ * @brief Retrieves the child link to follow from a node when searching for a
+ *        value. The holder always leads to its right child (the root).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ConcurrentAVLNode *_Atomic *getChildLink(ConcurrentAVLTree *tree,
+                                                ConcurrentAVLNode *node,
+                                                int value) {
+    ConcurrentAVLNode *_Atomic *link = &node->right;
+
+    if(node != &tree->holder && value < node->value) {
+        link = &node->left;
+    }
+
+    return link;
+}
+
+/**
+ * @brief Replaces a child of a (locked) parent node by another node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void replaceChild(ConcurrentAVLNode *parent,
+                         ConcurrentAVLNode *oldChild,
+                         ConcurrentAVLNode *newChild) {
+    if(atomic_load(&parent->left) == oldChild) {
+        atomic_store(&parent->left, newChild);
+    }
+    else {
+        atomic_store(&parent->right, newChild);
+    }
+
+    if(newChild) {
+        atomic_store(&newChild->parent, parent);
+    }
+}
+
+/**
+ * @brief Retires an unlinked node so that it gets freed once no reader can
+ *        still visit it. If it cannot be retired (allocation failure), it is
+ *        added to the retired list of the tree instead.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void retire(ConcurrentAVLTree *tree, ConcurrentAVLNode *node) {
+    if(!retireEBRPointer(node, free)) {
+        ConcurrentAVLNode *head = atomic_load(&tree->retired);
+
+        do {
+            node->nextRetired = head;
+        } while(!atomic_compare_exchange_weak(&tree->retired, &head, node));
+    }
+}
+
+/**
+ * @brief Descends the tree optimistically (without locking) looking for a
+ *        value. It stops at the node holding the value, or at the node whose
+ *        child link for the value is NULL.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @param value The value to be searched for.
+ *
+ * @param[out] nodePtr Pointer to the variable storing the reached node.
+ *
+ * @param[out] versionPtr Pointer to the variable storing the version of the
+ *                        reached node, as validated during the descent.
+ *
+ * @return True if the descent is consistent and false if a concurrent change
+ *         was detected, in which case it should be restarted.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool descend(ConcurrentAVLTree *tree,
+                    int value,
+                    ConcurrentAVLNode **nodePtr,
+                    uint64_t *versionPtr) {
+    bool consistent = true;
+    bool reached = false;
+    ConcurrentAVLNode *node = &tree->holder;
+    uint64_t version = readVersion(node);
+
+    while(consistent && !reached) {
+        if(node != &tree->holder && node->value == value) {
+            reached = true;
+        }
+        else {
+            ConcurrentAVLNode *child = atomic_load(getChildLink(tree,
+                                                                node,
+                                                                value));
+
+            if(!validate(node, version)) {
+                consistent = false;
+            }
+            else if(!child) {
+                reached = true;
+            }
+            else {
+                uint64_t childVersion = readVersion(child);
+
+                /**
+                 * Validating the node again makes sure that child was still
+                 * its child when its version was read.
+                 */
+                if(!validate(node, version) || (childVersion & OBSOLETE_BIT)) {
+                    consistent = false;
+                }
+                else {
+                    node = child;
+                    version = childVersion;
+                }
+            }
+        }
+    }
+
+    *nodePtr = node;
+    *versionPtr = version;
+
+    return consistent;
+}
+
+/**
+ * @brief Locks the parent of a node, making sure it is still its parent once
+ *        locked.
+ *
+ * @param node Pointer to the node.
+ *
+ * @return Pointer to the locked parent or NULL if the node was unlinked.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ConcurrentAVLNode *lockParent(ConcurrentAVLNode *node) {
+    ConcurrentAVLNode *parent = NULL;
+    bool locked = false;
+
+    while(!locked && !(atomic_load(&node->version) & OBSOLETE_BIT)) {
+        parent = atomic_load(&node->parent);
+
+        uint64_t version = lockNode(parent);
+
+        if(atomic_load(&node->parent) == parent &&
+           (atomic_load(&parent->left) == node ||
+            atomic_load(&parent->right) == node)) {
+            locked = true;
+        }
+        else {
+            unlockNodeUnchanged(parent, version);
+        }
+    }
+
+    return locked ? parent : NULL;
+}
+
+/**
+ * @brief Performs a right rotation on a node whose parent, itself and its left
+ *        child are all locked.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rotateRight(ConcurrentAVLNode *parent,
+                        ConcurrentAVLNode *node,
+                        ConcurrentAVLNode *child) {
+    /**
+     *              node                   child
+     *         child     T3    ==>     T1        node
+     *      T1   middle                      middle   T3
+     */
+    ConcurrentAVLNode *middle = atomic_load(&child->right);
+
+    atomic_store(&node->left, middle);
+    if(middle) {
+        atomic_store(&middle->parent, node);
+    }
+
+    atomic_store(&child->right, node);
+    atomic_store(&node->parent, child);
+    replaceChild(parent, node, child);
+
+    updateHeight(node);
+    updateHeight(child);
+}
+
+/**
+ * @brief Performs a left rotation on a node whose parent, itself and its right
+ *        child are all locked.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rotateLeft(ConcurrentAVLNode *parent,
+                       ConcurrentAVLNode *node,
+                       ConcurrentAVLNode *child) {
+    /**
+     *          node                           child
+     *      T1       child         ==>     node       T3
+     *           middle   T3            T1   middle
+     */
+    ConcurrentAVLNode *middle = atomic_load(&child->left);
+
+    atomic_store(&node->right, middle);
+    if(middle) {
+        atomic_store(&middle->parent, node);
+    }
+
+    atomic_store(&child->left, node);
+    atomic_store(&node->parent, child);
+    replaceChild(parent, node, child);
+
+    updateHeight(node);
+    updateHeight(child);
+}
+
+/**
+ * @brief Rebalances an unbalanced node by a single or double rotation. The
+ *        parent and the node should be locked, whereas the child and the
+ *        grandchild involved are locked here (top to bottom order).
+ *
+ * @param parent Pointer to the locked parent.
+ *
+ * @param node Pointer to the locked unbalanced node.
+ *
+ * @param balance The left height minus the right height of the node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rotate(ConcurrentAVLNode *parent,
+                   ConcurrentAVLNode *node,
+                   int balance) {
+    if(balance > 1) {
+        // Left heavy (the left child cannot be NULL)
+        ConcurrentAVLNode *child = atomic_load(&node->left);
+        lockNode(child);
+
+        if(heightOf(atomic_load(&child->left)) <
+           heightOf(atomic_load(&child->right))) {
+            // Left-right case
+            ConcurrentAVLNode *grandChild = atomic_load(&child->right);
+            lockNode(grandChild);
+            rotateLeft(node, child, grandChild);
+            rotateRight(parent, node, grandChild);
+            unlockNode(grandChild);
+        }
+        else {
+            // Left-left case
+            rotateRight(parent, node, child);
+        }
+
+        unlockNode(child);
+    }
+    else {
+        // Right heavy (the right child cannot be NULL)
+        ConcurrentAVLNode *child = atomic_load(&node->right);
+        lockNode(child);
+
+        if(heightOf(atomic_load(&child->right)) <
+           heightOf(atomic_load(&child->left))) {
+            // Right-left case
+            ConcurrentAVLNode *grandChild = atomic_load(&child->left);
+            lockNode(grandChild);
+            rotateRight(node, child, grandChild);
+            rotateLeft(parent, node, grandChild);
+            unlockNode(grandChild);
+        }
+        else {
+            // Right-right case
+            rotateLeft(parent, node, child);
+        }
+
+        unlockNode(child);
+    }
+}
+
+/**
+ * @brief Walks up from a changed node, unlinking routing nodes having at most
+ *        one child, fixing heights and rotating unbalanced nodes. Every step
+ *        locks only a node and its parent (plus the rotated nodes), and it
+ *        stops once a node is balanced and its height did not change.
+ *
+ * @param tree Pointer to the concurrent AVL tree.
+ *
+ * @param node Pointer to the changed node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rebalance(ConcurrentAVLTree *tree, ConcurrentAVLNode *node) {
+    while(node && node != &tree->holder) {
+        ConcurrentAVLNode *next = NULL;
+        ConcurrentAVLNode *parent = lockParent(node);
+
+        if(parent) {
+            uint64_t parentVersion = atomic_load(&parent->version);
+            uint64_t nodeVersion = lockNode(node);
+            ConcurrentAVLNode *left = atomic_load(&node->left);
+            ConcurrentAVLNode *right = atomic_load(&node->right);
+            int balance = heightOf(left) - heightOf(right);
+            bool changed = true;
+
+            if(!atomic_load(&node->present) && (!left || !right)) {
+                // Unlinking the routing node
+                replaceChild(parent, node, left ? left : right);
+                atomic_fetch_or(&node->version, OBSOLETE_BIT);
+                retire(tree, node);
+                next = parent;
+            }
+            else if(balance > 1 || balance < -1) {
+                rotate(parent, node, balance);
+                next = parent;
+            }
+            else {
+                int height = 1 + (balance > 0 ? heightOf(left) :
+                                                heightOf(right));
+
+                /**
+                 * Heights are not read by optimistic readers, so we do not
+                 * need to change the versions.
+                 */
+                changed = false;
+
+                if(height != atomic_load(&node->height)) {
+                    atomic_store(&node->height, height);
+                    next = parent;
+                }
+            }
+
+            if(changed) {
+                unlockNode(node);
+                unlockNode(parent);
+            }
+            else {
+                unlockNodeUnchanged(node, nodeVersion);
+                unlockNodeUnchanged(parent, parentVersion & ~LOCKED_BIT);
+            }
+        }
+
+        node = next;
+    }
+}
+
+/**
+ * @brief Allocates and initializes a new leaf node.
+ *
+ * @return Pointer to the new node or NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ConcurrentAVLNode *createNode(int value) {
+    ConcurrentAVLNode *newNode = malloc(sizeof(ConcurrentAVLNode));
+
+    if(newNode) {
+        newNode->value = value;
+        atomic_init(&newNode->present, true);
+        atomic_init(&newNode->height, 1);
+        atomic_init(&newNode->version, 0);
+        atomic_init(&newNode->left, NULL);
+        atomic_init(&newNode->right, NULL);
+        atomic_init(&newNode->parent, NULL);
+        newNode->nextRetired = NULL;
+    }
+
+    return newNode;
+}
+
+void initConcurrentAVL(ConcurrentAVLTree *tree) {
+    if(tree) {
+        tree->holder.value = 0;
+        atomic_init(&tree->holder.present, false);
+        atomic_init(&tree->holder.height, 0);
+        atomic_init(&tree->holder.version, 0);
+        atomic_init(&tree->holder.left, NULL);
+        atomic_init(&tree->holder.right, NULL);
+        atomic_init(&tree->holder.parent, NULL);
+        tree->holder.nextRetired = NULL;
+        atomic_init(&tree->retired, NULL);
+        atomic_init(&tree->count, 0);
+    }
+}
+
+/**
+ * @brief Frees a subtree recursively.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void freeSubtree(ConcurrentAVLNode *node) {
+    if(node) {
+        freeSubtree(atomic_load(&node->left));
+        freeSubtree(atomic_load(&node->right));
+        free(node);
+    }
+}
+
+void destroyConcurrentAVL(ConcurrentAVLTree *tree) {
+    if(tree) {
+        ConcurrentAVLNode *node = atomic_load(&tree->retired);
+
+        while(node) {
+            ConcurrentAVLNode *next = node->nextRetired;
+            free(node);
+            node = next;
+        }
+
+        freeSubtree(atomic_load(&tree->holder.right));
+        initConcurrentAVL(tree);
+    }
+}
+
+/**
+ * @brief Traverses a subtree in order and stores the present values, without
+ *        going past the given size of the array.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void traverse(ConcurrentAVLNode *node,
+                     int *values,
+                     size_t size,
+                     size_t *indexPtr) {
+    if(node && *indexPtr < size) {
+        traverse(atomic_load(&node->left), values, size, indexPtr);
+
+        if(*indexPtr < size && atomic_load(&node->present)) {
+            values[(*indexPtr)++] = node->value;
+        }
+
+        traverse(atomic_load(&node->right), values, size, indexPtr);
+    }
+}
+
+int *getConcurrentAVLAsSortedArray(ConcurrentAVLTree *tree) {
+    int *sortedValues = NULL;
+    size_t size = getConcurrentAVLCount(tree);
+
+    if(size > 0) {
+        sortedValues = malloc(size * sizeof(int));
+
+        if(sortedValues && enterEBRCriticalSection()) {
+            /**
+             * The walk is bounded by size, as concurrent additions may have
+             * made the tree grow since it got counted.
+             */
+            size_t index = 0;
+            traverse(atomic_load(&tree->holder.right),
+                     sortedValues,
+                     size,
+                     &index);
+            exitEBRCriticalSection();
+        }
+        else {
+            // The array cannot be filled without entering a critical section
+            free(sortedValues);
+            sortedValues = NULL;
+        }
+    }
+
+    return sortedValues;
+}
+
+char *concurrentAVLToStr(ConcurrentAVLTree *tree) {
+    char *str = NULL;
+    size_t size = getConcurrentAVLCount(tree);
+    int *sortedValues = getConcurrentAVLAsSortedArray(tree);
+
+    if(size == 0 || sortedValues) {
+        str = sortedValuesToStr(sortedValues, size);
+        free(sortedValues);
+    }
+
+    return str;
+}
+
+bool addConcurrentAVLNode(ConcurrentAVLTree *tree, int value) {
+    bool added = false;
+    bool entered = tree && enterEBRCriticalSection();
+    bool done = !entered;
+    ConcurrentAVLNode *newNode = NULL;
+
+    while(!done) {
+        ConcurrentAVLNode *node;
+        uint64_t version;
+
+        if(descend(tree, value, &node, &version)) {
+            if(node != &tree->holder && node->value == value) {
+                if(atomic_load(&node->present)) {
+                    // Already existing (if still so upon validation)
+                    done = validate(node, version);
+                }
+                else if(tryUpgrade(node, version)) {
+                    // Reviving a routing node
+                    atomic_store(&node->present, true);
+                    unlockNode(node);
+                    added = done = true;
+                }
+            }
+            else {
+                if(!newNode) {
+                    newNode = createNode(value);
+                    done = !newNode;
+                }
+
+                if(newNode && tryUpgrade(node, version)) {
+                    atomic_store(&newNode->parent, node);
+                    atomic_store(getChildLink(tree, node, value), newNode);
+                    unlockNode(node);
+                    newNode = NULL;
+
+                    rebalance(tree, node);
+                    added = done = true;
+                }
+            }
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    // The new node is not needed if a routing node got revived instead
+    free(newNode);
+
+    if(added) {
+        atomic_fetch_add(&tree->count, 1);
+    }
+
+    return added;
+}
+
+bool findConcurrentAVLNode(ConcurrentAVLTree *tree, int value) {
+    bool found = false;
+    bool entered = tree && enterEBRCriticalSection();
+    bool done = !entered;
+
+    while(!done) {
+        ConcurrentAVLNode *node;
+        uint64_t version;
+
+        if(descend(tree, value, &node, &version)) {
+            found = node != &tree->holder &&
+                    node->value == value &&
+                    atomic_load(&node->present);
+            done = validate(node, version);
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    return found;
+}
+
+bool deleteConcurrentAVLNode(ConcurrentAVLTree *tree, int value) {
+    bool deleted = false;
+    bool entered = tree && enterEBRCriticalSection();
+    bool done = !entered;
+
+    while(!done) {
+        ConcurrentAVLNode *node;
+        uint64_t version;
+
+        if(descend(tree, value, &node, &version)) {
+            if(node != &tree->holder &&
+               node->value == value &&
+               atomic_load(&node->present)) {
+                if(tryUpgrade(node, version)) {
+                    /**
+                     * The node becomes a routing node, which rebalance
+                     * unlinks if it has at most one child.
+                     */
+                    atomic_store(&node->present, false);
+                    unlockNode(node);
+
+                    rebalance(tree, node);
+                    deleted = done = true;
+                }
+            }
+            else {
+                // Not found (if still so upon validation)
+                done = validate(node, version);
+            }
+        }
+    }
+
+    if(entered) {
+        exitEBRCriticalSection();
+    }
+
+    if(deleted) {
+        atomic_fetch_sub(&tree->count, 1);
+    }
+
+    return deleted;
+}
+
+size_t getConcurrentAVLCount(ConcurrentAVLTree *tree) {
+    return tree ? atomic_load(&tree->count) : 0;
+}
+
+/**
+ * @brief Computes the height of a subtree recursively.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t getSubtreeHeight(ConcurrentAVLNode *node) {
+    size_t height = 0;
+
+    if(node) {
+        size_t leftHeight = getSubtreeHeight(atomic_load(&node->left));
+        size_t rightHeight = getSubtreeHeight(atomic_load(&node->right));
+
+        height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+    }
+
+    return height;
+}
+
+size_t getConcurrentAVLHeight(ConcurrentAVLTree *tree) {
+    return tree ? getSubtreeHeight(atomic_load(&tree->holder.right)) : 0;
+}
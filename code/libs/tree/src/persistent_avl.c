@@ -0,0 +1,413 @@
+/**
+ * @file persistent_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with persistent (immutable) AVL tree.
+ */
+
+#include "tree/common.h"
+#include "tree/persistent_avl.h"
+
+PersistentAVLNode *acquirePersistentAVL(PersistentAVLNode *root) {
+    if(root) {
+        // Nothing is read through the new reference yet, so relaxed is enough
+        atomic_fetch_add_explicit(&root->refCount, 1, memory_order_relaxed);
+    }
+
+    return root;
+}
+
+void releasePersistentAVL(PersistentAVLNode *root) {
+    /**
+     * Acquire-release ordering makes sure that the thread freeing the node
+     * sees all what other threads did with it before releasing it.
+     */
+    if(root && atomic_fetch_sub_explicit(&root->refCount,
+                                         1,
+                                         memory_order_acq_rel) == 1) {
+        releasePersistentAVL(root->left);
+        releasePersistentAVL(root->right);
+        free(root);
+    }
+}
+
+/**
+ * @brief Retrieves the height of a possibly NULL node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int heightOf(PersistentAVLNode *node) {
+    return node ? node->height : 0;
+}
+
+/**
+ * @brief Creates a new node out of a value and two subtrees.
+ *
+ * @param value The value of the new node.
+ *
+ * @param left The left subtree, whose reference is taken over by the node.
+ *
+ * @param right The right subtree, whose reference is taken over by the node.
+ *
+ * @param okPtr Pointer to the variable set to false if allocation fails (in
+ *              which case the subtrees are released and NULL is returned).
+ *
+ * @return The new node with a reference count of one.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static PersistentAVLNode *createNode(int value,
+                                     PersistentAVLNode *left,
+                                     PersistentAVLNode *right,
+                                     bool *okPtr) {
+    PersistentAVLNode *newNode = malloc(sizeof(PersistentAVLNode));
+
+    if(newNode) {
+        int leftHeight = heightOf(left), rightHeight = heightOf(right);
+
+        newNode->value = value;
+        newNode->height = 1 + (leftHeight > rightHeight ? leftHeight :
+                                                          rightHeight);
+        atomic_init(&newNode->refCount, 1);
+        newNode->left = left;
+        newNode->right = right;
+    }
+    else {
+        *okPtr = false;
+        releasePersistentAVL(left);
+        releasePersistentAVL(right);
+    }
+
+    return newNode;
+}
+
+/**
+ * @brief Creates a balanced node out of a value and two subtrees whose heights
+ *        differ by at most two. Instead of rotating (which would modify
+ *        possibly shared nodes), the rotated nodes are created anew.
+ *
+ * @param value The value of the new node.
+ *
+ * @param left The left subtree, whose reference is taken over.
+ *
+ * @param right The right subtree, whose reference is taken over.
+ *
+ * @param okPtr Pointer to the variable set to false if allocation fails.
+ *
+ * @return The new balanced subtree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static PersistentAVLNode *createBalancedNode(int value,
+                                             PersistentAVLNode *left,
+                                             PersistentAVLNode *right,
+                                             bool *okPtr) {
+    PersistentAVLNode *newNode = NULL;
+    int balance = heightOf(left) - heightOf(right);
+
+    if(balance > 1) {
+        if(heightOf(left->left) >= heightOf(left->right)) {
+            // Left-left case: right rotation
+            newNode = createNode(left->value,
+                                 acquirePersistentAVL(left->left),
+                                 createNode(value,
+                                            acquirePersistentAVL(left->right),
+                                            right,
+                                            okPtr),
+                                 okPtr);
+        }
+        else {
+            // Left-right case: left rotation of left then right rotation
+            PersistentAVLNode *middle = left->right;
+
+            newNode = createNode(middle->value,
+                                 createNode(left->value,
+                                            acquirePersistentAVL(left->left),
+                                            acquirePersistentAVL(middle->left),
+                                            okPtr),
+                                 createNode(value,
+                                            acquirePersistentAVL(middle->right),
+                                            right,
+                                            okPtr),
+                                 okPtr);
+        }
+
+        releasePersistentAVL(left);
+    }
+    else if(balance < -1) {
+        if(heightOf(right->right) >= heightOf(right->left)) {
+            // Right-right case: left rotation
+            newNode = createNode(right->value,
+                                 createNode(value,
+                                            left,
+                                            acquirePersistentAVL(right->left),
+                                            okPtr),
+                                 acquirePersistentAVL(right->right),
+                                 okPtr);
+        }
+        else {
+            // Right-left case: right rotation of right then left rotation
+            PersistentAVLNode *middle = right->left;
+
+            newNode = createNode(middle->value,
+                                 createNode(value,
+                                            left,
+                                            acquirePersistentAVL(middle->left),
+                                            okPtr),
+                                 createNode(right->value,
+                                            acquirePersistentAVL(middle->right),
+                                            acquirePersistentAVL(right->right),
+                                            okPtr),
+                                 okPtr);
+        }
+
+        releasePersistentAVL(right);
+    }
+    else {
+        newNode = createNode(value, left, right, okPtr);
+    }
+
+    return newNode;
+}
+
+/**
+ * @brief Adds a value (known not to exist) to a subtree by copying the path
+ *        leading to it.
+ *
+ * @return A new reference on the new subtree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static PersistentAVLNode *addRecursively(PersistentAVLNode *node,
+                                         int value,
+                                         bool *okPtr) {
+    PersistentAVLNode *newNode;
+
+    if(!node) {
+        newNode = createNode(value, NULL, NULL, okPtr);
+    }
+    else if(value < node->value) {
+        newNode = createBalancedNode(node->value,
+                                     addRecursively(node->left, value, okPtr),
+                                     acquirePersistentAVL(node->right),
+                                     okPtr);
+    }
+    else {
+        newNode = createBalancedNode(node->value,
+                                     acquirePersistentAVL(node->left),
+                                     addRecursively(node->right, value, okPtr),
+                                     okPtr);
+    }
+
+    return newNode;
+}
+
+bool addPersistentAVLNode(PersistentAVLNode *root,
+                          int value,
+                          PersistentAVLNode **newRootPtr) {
+    bool added = false;
+
+    if(newRootPtr) {
+        *newRootPtr = NULL;
+
+        if(!findPersistentAVLNode(root, value)) {
+            bool ok = true;
+            PersistentAVLNode *newRoot = addRecursively(root, value, &ok);
+
+            if(ok) {
+                *newRootPtr = newRoot;
+                added = true;
+            }
+            else {
+                // Dropping the partially built version
+                releasePersistentAVL(newRoot);
+            }
+        }
+
+        if(!added) {
+            *newRootPtr = acquirePersistentAVL(root);
+        }
+    }
+
+    return added;
+}
+
+PersistentAVLNode *findPersistentAVLNode(PersistentAVLNode *root, int value) {
+    PersistentAVLNode *itemPtr = NULL;
+
+    while(root && !itemPtr) {
+        if(root->value == value) {
+            itemPtr = root;
+        }
+        else {
+            root = value < root->value ? root->left : root->right;
+        }
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Deletes a value (known to exist) from a subtree by copying the path
+ *        leading to it.
+ *
+ * @return A new reference on the new subtree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static PersistentAVLNode *deleteRecursively(PersistentAVLNode *node,
+                                            int value,
+                                            bool *okPtr) {
+    PersistentAVLNode *newNode;
+
+    if(value < node->value) {
+        newNode = createBalancedNode(node->value,
+                                     deleteRecursively(node->left,
+                                                       value,
+                                                       okPtr),
+                                     acquirePersistentAVL(node->right),
+                                     okPtr);
+    }
+    else if(value > node->value) {
+        newNode = createBalancedNode(node->value,
+                                     acquirePersistentAVL(node->left),
+                                     deleteRecursively(node->right,
+                                                       value,
+                                                       okPtr),
+                                     okPtr);
+    }
+    else if(!node->left || !node->right) {
+        // The remaining child (if any) is shared as it is
+        newNode = acquirePersistentAVL(node->left ? node->left : node->right);
+    }
+    else {
+        // Replacing the value by its successor (minimum of right subtree)
+        int successor;
+        minPersistentAVL(node->right, &successor);
+
+        newNode = createBalancedNode(successor,
+                                     acquirePersistentAVL(node->left),
+                                     deleteRecursively(node->right,
+                                                       successor,
+                                                       okPtr),
+                                     okPtr);
+    }
+
+    return newNode;
+}
+
+bool deletePersistentAVLNode(PersistentAVLNode *root,
+                             int value,
+                             PersistentAVLNode **newRootPtr) {
+    bool deleted = false;
+
+    if(newRootPtr) {
+        *newRootPtr = NULL;
+
+        if(findPersistentAVLNode(root, value)) {
+            bool ok = true;
+            PersistentAVLNode *newRoot = deleteRecursively(root, value, &ok);
+
+            if(ok) {
+                *newRootPtr = newRoot;
+                deleted = true;
+            }
+            else {
+                releasePersistentAVL(newRoot);
+            }
+        }
+
+        if(!deleted) {
+            *newRootPtr = acquirePersistentAVL(root);
+        }
+    }
+
+    return deleted;
+}
+
+size_t getPersistentAVLCount(PersistentAVLNode *root) {
+    size_t count = 0;
+
+    if(root) {
+        count = 1 + getPersistentAVLCount(root->left) +
+                    getPersistentAVLCount(root->right);
+    }
+
+    return count;
+}
+
+size_t getPersistentAVLHeight(PersistentAVLNode *root) {
+    return heightOf(root);
+}
+
+bool maxPersistentAVL(PersistentAVLNode *root, int *maxValuePtr) {
+    bool found = false;
+
+    if(root && maxValuePtr) {
+        while(root->right) {
+            root = root->right;
+        }
+
+        *maxValuePtr = root->value;
+        found = true;
+    }
+
+    return found;
+}
+
+bool minPersistentAVL(PersistentAVLNode *root, int *minValuePtr) {
+    bool found = false;
+
+    if(root && minValuePtr) {
+        while(root->left) {
+            root = root->left;
+        }
+
+        *minValuePtr = root->value;
+        found = true;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Traverses a subtree in order and stores its values.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void traverse(PersistentAVLNode *node, int *values, size_t *indexPtr) {
+    if(node) {
+        traverse(node->left, values, indexPtr);
+        values[(*indexPtr)++] = node->value;
+        traverse(node->right, values, indexPtr);
+    }
+}
+
+int *getPersistentAVLAsSortedArray(PersistentAVLNode *root) {
+    int *sortedValues = NULL;
+
+    if(root) {
+        sortedValues = malloc(getPersistentAVLCount(root) * sizeof(int));
+
+        if(sortedValues) {
+            size_t index = 0;
+            traverse(root, sortedValues, &index);
+        }
+    }
+
+    return sortedValues;
+}
+
+char *persistentAVLToStr(PersistentAVLNode *root) {
+    char *str = NULL;
+    int *sortedValues = getPersistentAVLAsSortedArray(root);
+
+    if(!root || sortedValues) {
+        str = sortedValuesToStr(sortedValues, getPersistentAVLCount(root));
+        free(sortedValues);
+    }
+
+    return str;
+}
@@ -0,0 +1,1328 @@
+/**
+ * @file roaring_set.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with compressed integer set (Roaring-style containers).
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "tree/common.h"
+#include "tree/roaring_set.h"
+
+/**
+ * @def ROARING_MAX_CARDINALITY
+ *
+ * @brief The maximum number of values of a container (2^16).
+ */
+#define ROARING_MAX_CARDINALITY (ROARING_BITMAP_WORDS * 64)
+
+/**
+ * @brief Maps an int value to an unsigned one keeping the order (INT_MIN
+ *        becomes 0 and INT_MAX becomes UINT32_MAX).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t toUnsigned(int value) {
+    return (uint32_t) ((int64_t) value + 2147483648);
+}
+
+/**
+ * @brief Maps back an unsigned value given by toUnsigned to its int value.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static int toSigned(uint32_t value) {
+    return (int) ((int64_t) value - 2147483648);
+}
+
+/**
+ * @brief Counts the set bits of a word.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t countBits(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_popcountll(word);
+#else
+    uint32_t count = 0;
+
+    while(word) {
+        word &= word - 1;
+        count += 1;
+    }
+
+    return count;
+#endif
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero word.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t getLowestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_ctzll(word);
+#else
+    uint32_t index = 0;
+
+    while(!(word & 1)) {
+        word >>= 1;
+        index += 1;
+    }
+
+    return index;
+#endif
+}
+
+/**
+ * @brief Returns the index of the first entry of a sorted array that is not
+ *        less than low (size if there is none).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t searchArray(const uint16_t *array,
+                            uint32_t size,
+                            uint16_t low) {
+    uint32_t begin = 0;
+    uint32_t end = size;
+
+    while(begin < end) {
+        uint32_t middle = begin + (end - begin) / 2;
+
+        if(array[middle] < low) {
+            begin = middle + 1;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief Returns the number of runs starting at or before low, so that the
+ *        only run that may contain low is the one preceding the returned
+ *        index.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t searchRuns(const RoaringRun *runs,
+                           uint32_t size,
+                           uint16_t low) {
+    uint32_t begin = 0;
+    uint32_t end = size;
+
+    while(begin < end) {
+        uint32_t middle = begin + (end - begin) / 2;
+
+        if(runs[middle].start <= low) {
+            begin = middle + 1;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief Returns the index of the first container whose key is not less than
+ *        the given key (numContainers if there is none).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t searchContainers(const RoaringSet *set, uint16_t key) {
+    size_t begin = 0;
+    size_t end = set->numContainers;
+
+    while(begin < end) {
+        size_t middle = begin + (end - begin) / 2;
+
+        if(set->containers[middle].key < key) {
+            begin = middle + 1;
+        }
+        else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief Frees the content of a container (not the container itself).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void freeContainer(RoaringContainer *container) {
+    if(container->type == ROARING_ARRAY) {
+        free(container->data.array);
+    }
+    else if(container->type == ROARING_BITMAP) {
+        free(container->data.bitmap);
+    }
+    else {
+        free(container->data.runs);
+    }
+}
+
+/**
+ * @brief Makes sure an array or run container can hold size entries, growing
+ *        its capacity geometrically.
+ *
+ * @return True if the container can hold size entries and false otherwise
+ *         (allocation failure, in which case the container is unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool reserve(RoaringContainer *container, uint32_t size) {
+    bool reserved = size <= container->capacity;
+
+    if(!reserved) {
+        uint32_t capacity = container->capacity < 4 ? 4
+                                                    : 2 * container->capacity;
+
+        if(capacity < size) {
+            capacity = size;
+        }
+
+        if(container->type == ROARING_RUN) {
+            RoaringRun *runs = realloc(container->data.runs,
+                                       capacity * sizeof(RoaringRun));
+
+            if(runs) {
+                container->data.runs = runs;
+                reserved = true;
+            }
+        }
+        else {
+            uint16_t *array = realloc(container->data.array,
+                                      capacity * sizeof(uint16_t));
+
+            if(array) {
+                container->data.array = array;
+                reserved = true;
+            }
+        }
+
+        if(reserved) {
+            container->capacity = capacity;
+        }
+    }
+
+    return reserved;
+}
+
+/**
+ * @brief Tells if a container holds the given low bits.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool containsLow(const RoaringContainer *container, uint16_t low) {
+    bool found;
+
+    if(container->type == ROARING_ARRAY) {
+        uint32_t index = searchArray(container->data.array,
+                                     container->size,
+                                     low);
+
+        found = index < container->size && container->data.array[index] == low;
+    }
+    else if(container->type == ROARING_BITMAP) {
+        found = (container->data.bitmap[low >> 6] >> (low & 63)) & 1;
+    }
+    else {
+        const RoaringRun *runs = container->data.runs;
+        uint32_t index = searchRuns(runs, container->size, low);
+
+        found = index > 0 &&
+                low <= (uint32_t) runs[index - 1].start +
+                       runs[index - 1].length;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Counts the values of a container that are less than or equal to the
+ *        given low bits.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t rankLow(const RoaringContainer *container, uint16_t low) {
+    uint32_t rank = 0;
+
+    if(container->type == ROARING_ARRAY) {
+        rank = searchArray(container->data.array, container->size, low);
+        rank += rank < container->size && container->data.array[rank] == low;
+    }
+    else if(container->type == ROARING_BITMAP) {
+        uint32_t shift = low & 63;
+        uint64_t mask = shift == 63 ? UINT64_MAX : (1ULL << (shift + 1)) - 1;
+
+        for(uint32_t w = 0; w < (uint32_t) (low >> 6); ++w) {
+            rank += countBits(container->data.bitmap[w]);
+        }
+
+        rank += countBits(container->data.bitmap[low >> 6] & mask);
+    }
+    else {
+        const RoaringRun *runs = container->data.runs;
+
+        for(uint32_t r = 0; r < container->size && runs[r].start <= low; ++r) {
+            uint32_t end = (uint32_t) runs[r].start + runs[r].length;
+
+            rank += (end < low ? end : low) - runs[r].start + 1;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Sets in a bitmap the bits of the values of a container (the bitmap
+ *        words are or-ed, so that several containers can be combined).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void fillBitmap(const RoaringContainer *container, uint64_t *bitmap) {
+    if(container->type == ROARING_ARRAY) {
+        for(uint32_t i = 0; i < container->size; ++i) {
+            uint16_t low = container->data.array[i];
+
+            bitmap[low >> 6] |= 1ULL << (low & 63);
+        }
+    }
+    else if(container->type == ROARING_BITMAP) {
+        for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+            bitmap[w] |= container->data.bitmap[w];
+        }
+    }
+    else {
+        for(uint32_t r = 0; r < container->size; ++r) {
+            uint32_t start = container->data.runs[r].start;
+            uint32_t end = start + container->data.runs[r].length;
+
+            for(uint32_t low = start; low <= end; ++low) {
+                bitmap[low >> 6] |= 1ULL << (low & 63);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Writes the low bits of the values of a container in ascending order.
+ *
+ * @param container Pointer to the container.
+ *
+ * @param array The array receiving the cardinality low bits.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void fillArray(const RoaringContainer *container, uint16_t *array) {
+    uint32_t size = 0;
+
+    if(container->type == ROARING_ARRAY) {
+        memcpy(array,
+               container->data.array,
+               container->size * sizeof(uint16_t));
+    }
+    else if(container->type == ROARING_BITMAP) {
+        for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+            uint64_t word = container->data.bitmap[w];
+
+            while(word) {
+                array[size++] = (uint16_t) (w * 64 + getLowestBit(word));
+                word &= word - 1;
+            }
+        }
+    }
+    else {
+        for(uint32_t r = 0; r < container->size; ++r) {
+            uint32_t start = container->data.runs[r].start;
+            uint32_t end = start + container->data.runs[r].length;
+
+            for(uint32_t low = start; low <= end; ++low) {
+                array[size++] = (uint16_t) low;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Counts the runs (maximal intervals of consecutive values) of a
+ *        container.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static uint32_t countRuns(const RoaringContainer *container) {
+    uint32_t numRuns = 0;
+
+    if(container->type == ROARING_ARRAY) {
+        for(uint32_t i = 0; i < container->size; ++i) {
+            numRuns += i == 0 ||
+                       container->data.array[i] !=
+                       container->data.array[i - 1] + 1;
+        }
+    }
+    else if(container->type == ROARING_BITMAP) {
+        // A run starts at every set bit whose preceding bit is not set
+        uint64_t previous = 0;
+
+        for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+            uint64_t word = container->data.bitmap[w];
+
+            numRuns += countBits(word & ~((word << 1) | (previous >> 63)));
+            previous = word;
+        }
+    }
+    else {
+        numRuns = container->size;
+    }
+
+    return numRuns;
+}
+
+/**
+ * @brief Appends low bits, greater than all the ones already there, to runs.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void appendToRuns(RoaringRun *runs, uint32_t *sizePtr, uint16_t low) {
+    RoaringRun *last = *sizePtr > 0 ? &runs[*sizePtr - 1] : NULL;
+
+    if(last && (uint32_t) last->start + last->length + 1 == low) {
+        last->length += 1;
+    }
+    else {
+        runs[*sizePtr].start = low;
+        runs[*sizePtr].length = 0;
+        *sizePtr += 1;
+    }
+}
+
+/**
+ * @brief Writes the runs of the values of a container in ascending order.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void fillRuns(const RoaringContainer *container, RoaringRun *runs) {
+    uint32_t size = 0;
+
+    if(container->type == ROARING_ARRAY) {
+        for(uint32_t i = 0; i < container->size; ++i) {
+            appendToRuns(runs, &size, container->data.array[i]);
+        }
+    }
+    else if(container->type == ROARING_BITMAP) {
+        for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+            uint64_t word = container->data.bitmap[w];
+
+            while(word) {
+                appendToRuns(runs,
+                             &size,
+                             (uint16_t) (w * 64 + getLowestBit(word)));
+                word &= word - 1;
+            }
+        }
+    }
+    else {
+        memcpy(runs,
+               container->data.runs,
+               container->size * sizeof(RoaringRun));
+    }
+}
+
+/**
+ * @brief Converts a container to another form. An array can only hold up to
+ *        ROARING_ARRAY_MAX_SIZE values.
+ *
+ * @return True if the container has the requested form and false otherwise
+ *         (allocation failure, in which case the container is unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool convertContainer(RoaringContainer *container,
+                             RoaringContainerType type) {
+    bool converted = container->type == type;
+
+    if(!converted && type == ROARING_BITMAP) {
+        uint64_t *bitmap = calloc(ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+        if(bitmap) {
+            fillBitmap(container, bitmap);
+            freeContainer(container);
+            container->data.bitmap = bitmap;
+            container->size = container->capacity = 0;
+            converted = true;
+        }
+    }
+    else if(!converted && type == ROARING_ARRAY) {
+        uint16_t *array = malloc(container->cardinality * sizeof(uint16_t));
+
+        if(array) {
+            fillArray(container, array);
+            freeContainer(container);
+            container->data.array = array;
+            container->size = container->capacity = container->cardinality;
+            converted = true;
+        }
+    }
+    else if(!converted) {
+        uint32_t numRuns = countRuns(container);
+        RoaringRun *runs = malloc(numRuns * sizeof(RoaringRun));
+
+        if(runs) {
+            fillRuns(container, runs);
+            freeContainer(container);
+            container->data.runs = runs;
+            container->size = container->capacity = numRuns;
+            converted = true;
+        }
+    }
+
+    if(converted) {
+        container->type = type;
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Returns the most compact form of a container.
+ *
+ * @param container Pointer to the container.
+ *
+ * @param allowRuns Whether runs are considered (counting the runs of a bitmap
+ *                  costs a scan of it).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static RoaringContainerType getBestType(const RoaringContainer *container,
+                                        bool allowRuns) {
+    RoaringContainerType type = ROARING_BITMAP;
+    size_t bytes = ROARING_BITMAP_WORDS * sizeof(uint64_t);
+
+    if(container->cardinality <= ROARING_ARRAY_MAX_SIZE) {
+        type = ROARING_ARRAY;
+        bytes = container->cardinality * sizeof(uint16_t);
+    }
+
+    if(allowRuns && countRuns(container) * sizeof(RoaringRun) < bytes) {
+        type = ROARING_RUN;
+    }
+
+    return type;
+}
+
+/**
+ * @brief Brings a container back to its most compact form after adding or
+ *        deleting a value. Arrays and bitmaps are switched according to the
+ *        cardinality, while runs are kept as long as they are the most
+ *        compact. If the conversion fails, the container is kept as is.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void adjustContainer(RoaringContainer *container) {
+    if(container->type != ROARING_ARRAY) {
+        convertContainer(container,
+                         getBestType(container,
+                                     container->type == ROARING_RUN));
+    }
+}
+
+/**
+ * @brief Adds low bits, which are not there yet, to run container.
+ *
+ * @return True if the low bits were added and false otherwise (allocation
+ *         failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addLowToRuns(RoaringContainer *container, uint16_t low) {
+    RoaringRun *runs = container->data.runs;
+    uint32_t index = searchRuns(runs, container->size, low);
+    bool joinsPrevious = index > 0 &&
+                         (uint32_t) runs[index - 1].start +
+                         runs[index - 1].length + 1 == low;
+    bool joinsNext = index < container->size &&
+                     (uint32_t) low + 1 == runs[index].start;
+    bool added = true;
+
+    if(joinsPrevious && joinsNext) {
+        // The value fills the gap between two runs
+        runs[index - 1].length += runs[index].length + 2;
+        memmove(&runs[index],
+                &runs[index + 1],
+                (container->size - index - 1) * sizeof(RoaringRun));
+        container->size -= 1;
+    }
+    else if(joinsPrevious) {
+        runs[index - 1].length += 1;
+    }
+    else if(joinsNext) {
+        runs[index].start -= 1;
+        runs[index].length += 1;
+    }
+    else {
+        added = reserve(container, container->size + 1);
+
+        if(added) {
+            runs = container->data.runs;
+            memmove(&runs[index + 1],
+                    &runs[index],
+                    (container->size - index) * sizeof(RoaringRun));
+            runs[index].start = low;
+            runs[index].length = 0;
+            container->size += 1;
+        }
+    }
+
+    return added;
+}
+
+/**
+ * @brief Adds low bits, which are not there yet, to a container.
+ *
+ * @return True if the low bits were added and false otherwise (allocation
+ *         failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addLow(RoaringContainer *container, uint16_t low) {
+    // A full array becomes a bitmap
+    bool added = container->type != ROARING_ARRAY ||
+                 container->size < ROARING_ARRAY_MAX_SIZE ||
+                 convertContainer(container, ROARING_BITMAP);
+
+    if(added && container->type == ROARING_ARRAY) {
+        added = reserve(container, container->size + 1);
+
+        if(added) {
+            uint16_t *array = container->data.array;
+            uint32_t index = searchArray(array, container->size, low);
+
+            memmove(&array[index + 1],
+                    &array[index],
+                    (container->size - index) * sizeof(uint16_t));
+            array[index] = low;
+            container->size += 1;
+        }
+    }
+    else if(added && container->type == ROARING_BITMAP) {
+        container->data.bitmap[low >> 6] |= 1ULL << (low & 63);
+    }
+    else if(added) {
+        added = addLowToRuns(container, low);
+    }
+
+    if(added) {
+        container->cardinality += 1;
+    }
+
+    return added;
+}
+
+/**
+ * @brief Deletes existing low bits from a container.
+ *
+ * @return True if the low bits were deleted and false otherwise (allocation
+ *         failure when splitting a run).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool deleteLow(RoaringContainer *container, uint16_t low) {
+    bool deleted = true;
+
+    if(container->type == ROARING_ARRAY) {
+        uint16_t *array = container->data.array;
+        uint32_t index = searchArray(array, container->size, low);
+
+        memmove(&array[index],
+                &array[index + 1],
+                (container->size - index - 1) * sizeof(uint16_t));
+        container->size -= 1;
+    }
+    else if(container->type == ROARING_BITMAP) {
+        container->data.bitmap[low >> 6] &= ~(1ULL << (low & 63));
+    }
+    else {
+        uint32_t index = searchRuns(container->data.runs,
+                                    container->size,
+                                    low) - 1;
+        RoaringRun *run = &container->data.runs[index];
+        uint32_t end = (uint32_t) run->start + run->length;
+
+        if(run->length == 0) {
+            memmove(run,
+                    run + 1,
+                    (container->size - index - 1) * sizeof(RoaringRun));
+            container->size -= 1;
+        }
+        else if(low == run->start) {
+            run->start += 1;
+            run->length -= 1;
+        }
+        else if(low == end) {
+            run->length -= 1;
+        }
+        else {
+            // Splitting the run into [start, low - 1] and [low + 1, end]
+            deleted = reserve(container, container->size + 1);
+
+            if(deleted) {
+                RoaringRun *runs = container->data.runs;
+
+                memmove(&runs[index + 2],
+                        &runs[index + 1],
+                        (container->size - index - 1) * sizeof(RoaringRun));
+                runs[index + 1].start = (uint16_t) (low + 1);
+                runs[index + 1].length = (uint16_t) (end - low - 1);
+                runs[index].length = (uint16_t) (low - runs[index].start - 1);
+                container->size += 1;
+            }
+        }
+    }
+
+    if(deleted) {
+        container->cardinality -= 1;
+    }
+
+    return deleted;
+}
+
+/**
+ * @brief Inserts an empty array container with the given key at the given
+ *        index of the containers of a set.
+ *
+ * @return Pointer to the inserted container and NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static RoaringContainer *insertContainer(RoaringSet *set,
+                                         size_t index,
+                                         uint16_t key) {
+    RoaringContainer *container = NULL;
+    bool reserved = set->numContainers < set->capacity;
+
+    if(!reserved) {
+        size_t capacity = set->capacity < 4 ? 4 : 2 * set->capacity;
+        RoaringContainer *containers = realloc(set->containers,
+                                               capacity *
+                                               sizeof(RoaringContainer));
+
+        if(containers) {
+            set->containers = containers;
+            set->capacity = capacity;
+            reserved = true;
+        }
+    }
+
+    if(reserved) {
+        container = &set->containers[index];
+        memmove(container + 1,
+                container,
+                (set->numContainers - index) * sizeof(RoaringContainer));
+        set->numContainers += 1;
+
+        container->data.array = NULL;
+        container->size = container->capacity = container->cardinality = 0;
+        container->key = key;
+        container->type = ROARING_ARRAY;
+    }
+
+    return container;
+}
+
+/**
+ * @brief Frees and removes the container at the given index of a set.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void removeContainer(RoaringSet *set, size_t index) {
+    freeContainer(&set->containers[index]);
+    memmove(&set->containers[index],
+            &set->containers[index + 1],
+            (set->numContainers - index - 1) * sizeof(RoaringContainer));
+    set->numContainers -= 1;
+}
+
+/**
+ * @brief Copies the values of a container into an empty array container.
+ *
+ * @return True if the values were copied and false otherwise (allocation
+ *         failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool copyContainer(const RoaringContainer *source,
+                          RoaringContainer *destination) {
+    bool copied;
+
+    if(source->type == ROARING_BITMAP) {
+        uint64_t *bitmap = malloc(ROARING_BITMAP_WORDS * sizeof(uint64_t));
+
+        copied = bitmap != NULL;
+
+        if(copied) {
+            memcpy(bitmap,
+                   source->data.bitmap,
+                   ROARING_BITMAP_WORDS * sizeof(uint64_t));
+            destination->data.bitmap = bitmap;
+            destination->type = ROARING_BITMAP;
+        }
+    }
+    else {
+        destination->type = source->type;
+        copied = reserve(destination, source->size);
+
+        if(copied && source->type == ROARING_ARRAY) {
+            memcpy(destination->data.array,
+                   source->data.array,
+                   source->size * sizeof(uint16_t));
+        }
+        else if(copied) {
+            memcpy(destination->data.runs,
+                   source->data.runs,
+                   source->size * sizeof(RoaringRun));
+        }
+
+        destination->size = copied ? source->size : 0;
+    }
+
+    if(copied) {
+        destination->cardinality = source->cardinality;
+    }
+
+    return copied;
+}
+
+/**
+ * @brief Puts in an empty array container the union of two containers having
+ *        the same key.
+ *
+ * @return True if the union was computed and false otherwise (allocation
+ *         failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool uniteContainers(const RoaringContainer *container1,
+                            const RoaringContainer *container2,
+                            RoaringContainer *result) {
+    bool united;
+
+    if(container1->type == ROARING_ARRAY && container2->type == ROARING_ARRAY) {
+        // Merging the sorted arrays
+        united = reserve(result, container1->size + container2->size);
+
+        if(united) {
+            const uint16_t *array1 = container1->data.array;
+            const uint16_t *array2 = container2->data.array;
+            uint32_t i = 0, j = 0;
+
+            while(i < container1->size || j < container2->size) {
+                bool take1 = i < container1->size &&
+                             (j == container2->size || array1[i] <= array2[j]);
+                bool take2 = j < container2->size &&
+                             (i == container1->size || array2[j] <= array1[i]);
+
+                result->data.array[result->size++] = take1 ? array1[i]
+                                                           : array2[j];
+                i += take1;
+                j += take2;
+            }
+
+            result->cardinality = result->size;
+            united = result->cardinality <= ROARING_ARRAY_MAX_SIZE ||
+                     convertContainer(result, ROARING_BITMAP);
+        }
+    }
+    else {
+        // Or-ing the bitmaps of both containers
+        uint64_t *bitmap = calloc(ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+        united = bitmap != NULL;
+
+        if(united) {
+            fillBitmap(container1, bitmap);
+            fillBitmap(container2, bitmap);
+
+            for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+                result->cardinality += countBits(bitmap[w]);
+            }
+
+            result->data.bitmap = bitmap;
+            result->type = ROARING_BITMAP;
+            convertContainer(result,
+                             getBestType(result,
+                                         container1->type == ROARING_RUN ||
+                                         container2->type == ROARING_RUN));
+        }
+    }
+
+    return united;
+}
+
+/**
+ * @brief Puts in an empty array container the intersection of two containers
+ *        having the same key. The result may be empty.
+ *
+ * @return True if the intersection was computed and false otherwise
+ *         (allocation failure).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool intersectContainers(const RoaringContainer *container1,
+                                const RoaringContainer *container2,
+                                RoaringContainer *result) {
+    bool intersected;
+
+    if(container1->type == ROARING_ARRAY && container2->type == ROARING_ARRAY) {
+        // Merging the sorted arrays
+        uint32_t size1 = container1->size, size2 = container2->size;
+
+        intersected = reserve(result, size1 < size2 ? size1 : size2);
+
+        if(intersected) {
+            const uint16_t *array1 = container1->data.array;
+            const uint16_t *array2 = container2->data.array;
+            uint32_t i = 0, j = 0;
+
+            while(i < size1 && j < size2) {
+                if(array1[i] == array2[j]) {
+                    result->data.array[result->size++] = array1[i];
+                }
+
+                bool advance1 = array1[i] <= array2[j];
+                bool advance2 = array2[j] <= array1[i];
+
+                i += advance1;
+                j += advance2;
+            }
+        }
+    }
+    else if(container1->type == ROARING_ARRAY ||
+            container2->type == ROARING_ARRAY) {
+        // Keeping the values of the array that the other container holds
+        const RoaringContainer *array = container1->type == ROARING_ARRAY ?
+                                        container1 : container2;
+        const RoaringContainer *other = array == container1 ? container2
+                                                            : container1;
+
+        intersected = reserve(result, array->size);
+
+        for(uint32_t i = 0; intersected && i < array->size; ++i) {
+            if(containsLow(other, array->data.array[i])) {
+                result->data.array[result->size++] = array->data.array[i];
+            }
+        }
+    }
+    else {
+        // And-ing the bitmaps of both containers
+        uint64_t *bitmap = calloc(ROARING_BITMAP_WORDS, sizeof(uint64_t));
+        uint64_t *bitmap2 = calloc(ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+        intersected = bitmap && bitmap2;
+
+        if(intersected) {
+            fillBitmap(container1, bitmap);
+            fillBitmap(container2, bitmap2);
+
+            for(uint32_t w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+                bitmap[w] &= bitmap2[w];
+                result->cardinality += countBits(bitmap[w]);
+            }
+
+            result->data.bitmap = bitmap;
+            result->type = ROARING_BITMAP;
+            convertContainer(result,
+                             getBestType(result,
+                                         container1->type == ROARING_RUN ||
+                                         container2->type == ROARING_RUN));
+        }
+        else {
+            free(bitmap);
+        }
+
+        free(bitmap2);
+    }
+
+    if(intersected && result->type == ROARING_ARRAY) {
+        result->cardinality = result->size;
+    }
+
+    return intersected;
+}
+
+/**
+ * @brief Computes the union or the intersection of two sets, merging their
+ *        containers by key.
+ *
+ * @return True if the result was computed and false otherwise (allocation
+ *         failure, in which case result is unchanged).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool combineRoaringSets(RoaringSet *set1,
+                               RoaringSet *set2,
+                               RoaringSet *result,
+                               bool isUnion) {
+    RoaringSet combined = {0};
+    bool combinedAll = result != NULL;
+    size_t numContainers1 = set1 ? set1->numContainers : 0;
+    size_t numContainers2 = set2 ? set2->numContainers : 0;
+    size_t i = 0, j = 0;
+
+    while(combinedAll && (i < numContainers1 || j < numContainers2)) {
+        const RoaringContainer *container1 = i < numContainers1 ?
+                                             &set1->containers[i] : NULL;
+        const RoaringContainer *container2 = j < numContainers2 ?
+                                             &set2->containers[j] : NULL;
+        bool take1 = container1 &&
+                     (!container2 || container1->key <= container2->key);
+        bool take2 = container2 &&
+                     (!container1 || container2->key <= container1->key);
+
+        if((take1 && take2) || isUnion) {
+            RoaringContainer *container = insertContainer(
+                                            &combined,
+                                            combined.numContainers,
+                                            take1 ? container1->key
+                                                  : container2->key);
+
+            combinedAll = container != NULL;
+
+            if(combinedAll && take1 && take2) {
+                combinedAll = isUnion ? uniteContainers(container1,
+                                                        container2,
+                                                        container)
+                                      : intersectContainers(container1,
+                                                            container2,
+                                                            container);
+            }
+            else if(combinedAll) {
+                combinedAll = copyContainer(take1 ? container1 : container2,
+                                            container);
+            }
+
+            if(combinedAll && container->cardinality == 0) {
+                removeContainer(&combined, combined.numContainers - 1);
+            }
+            else if(combinedAll) {
+                combined.count += container->cardinality;
+            }
+        }
+
+        i += take1;
+        j += take2;
+    }
+
+    if(combinedAll) {
+        deleteEntireRoaring(result);
+        *result = combined;
+    }
+    else {
+        deleteEntireRoaring(&combined);
+    }
+
+    return combinedAll;
+}
+
+void displayRoaringSet(RoaringSet *set) {
+    char *str = roaringSetToStr(set);
+
+    if(str) {
+        printf("\n%s\n", str);
+        free(str);
+    }
+}
+
+char *roaringSetToStr(RoaringSet *set) {
+    char *str = NULL;
+    size_t size = getRoaringCount(set);
+    int *sortedValues = getRoaringAsSortedArray(set);
+
+    if(size == 0 || sortedValues) {
+        str = sortedValuesToStr(sortedValues, size);
+        free(sortedValues);
+    }
+
+    return str;
+}
+
+bool addRoaringValue(RoaringSet *set, int value) {
+    bool added = false;
+
+    if(set) {
+        uint32_t unsignedValue = toUnsigned(value);
+        uint16_t key = (uint16_t) (unsignedValue >> 16);
+        uint16_t low = (uint16_t) unsignedValue;
+        size_t index = searchContainers(set, key);
+        RoaringContainer *container;
+
+        if(index < set->numContainers && set->containers[index].key == key) {
+            container = &set->containers[index];
+        }
+        else {
+            container = insertContainer(set, index, key);
+        }
+
+        if(container && !containsLow(container, low)) {
+            added = addLow(container, low);
+
+            if(added) {
+                adjustContainer(container);
+                set->count += 1;
+            }
+        }
+
+        if(container && container->cardinality == 0) {
+            // The container was inserted, but the value could not be added
+            removeContainer(set, index);
+        }
+    }
+
+    return added;
+}
+
+bool findRoaringValue(RoaringSet *set, int value) {
+    bool found = false;
+
+    if(set) {
+        uint32_t unsignedValue = toUnsigned(value);
+        uint16_t key = (uint16_t) (unsignedValue >> 16);
+        size_t index = searchContainers(set, key);
+
+        found = index < set->numContainers &&
+                set->containers[index].key == key &&
+                containsLow(&set->containers[index], (uint16_t) unsignedValue);
+    }
+
+    return found;
+}
+
+bool deleteRoaringValue(RoaringSet *set, int value) {
+    bool deleted = false;
+
+    if(set) {
+        uint32_t unsignedValue = toUnsigned(value);
+        uint16_t key = (uint16_t) (unsignedValue >> 16);
+        uint16_t low = (uint16_t) unsignedValue;
+        size_t index = searchContainers(set, key);
+        RoaringContainer *container = index < set->numContainers &&
+                                      set->containers[index].key == key ?
+                                      &set->containers[index] : NULL;
+
+        if(container && containsLow(container, low)) {
+            deleted = deleteLow(container, low);
+        }
+
+        if(deleted) {
+            set->count -= 1;
+
+            if(container->cardinality == 0) {
+                removeContainer(set, index);
+            }
+            else {
+                adjustContainer(container);
+            }
+        }
+    }
+
+    return deleted;
+}
+
+void deleteEntireRoaring(RoaringSet *set) {
+    if(set) {
+        for(size_t i = 0; i < set->numContainers; ++i) {
+            freeContainer(&set->containers[i]);
+        }
+
+        free(set->containers);
+
+        set->containers = NULL;
+        set->numContainers = set->capacity = set->count = 0;
+    }
+}
+
+size_t getRoaringCount(RoaringSet *set) {
+    return set ? set->count : 0;
+}
+
+size_t getRoaringRank(RoaringSet *set, int value) {
+    size_t rank = 0;
+
+    if(set) {
+        uint32_t unsignedValue = toUnsigned(value);
+        uint16_t key = (uint16_t) (unsignedValue >> 16);
+
+        for(size_t i = 0;
+            i < set->numContainers && set->containers[i].key <= key;
+            ++i) {
+            const RoaringContainer *container = &set->containers[i];
+
+            rank += container->key < key ? container->cardinality
+                                         : rankLow(container,
+                                                   (uint16_t) unsignedValue);
+        }
+    }
+
+    return rank;
+}
+
+size_t getRoaringMemoryUsage(RoaringSet *set) {
+    size_t bytes = 0;
+
+    if(set) {
+        bytes = sizeof(RoaringSet) + set->capacity * sizeof(RoaringContainer);
+
+        for(size_t i = 0; i < set->numContainers; ++i) {
+            const RoaringContainer *container = &set->containers[i];
+
+            if(container->type == ROARING_ARRAY) {
+                bytes += container->capacity * sizeof(uint16_t);
+            }
+            else if(container->type == ROARING_BITMAP) {
+                bytes += ROARING_BITMAP_WORDS * sizeof(uint64_t);
+            }
+            else {
+                bytes += container->capacity * sizeof(RoaringRun);
+            }
+        }
+    }
+
+    return bytes;
+}
+
+void optimizeRoaringSet(RoaringSet *set) {
+    for(size_t i = 0; set && i < set->numContainers; ++i) {
+        // If the conversion fails, the container is kept as is
+        convertContainer(&set->containers[i],
+                         getBestType(&set->containers[i], true));
+    }
+}
+
+bool buildRoaringFromSortedArray(RoaringSet *set,
+                                 const int *sortedValues,
+                                 size_t size) {
+    bool built = set != NULL;
+    size_t begin = 0;
+
+    deleteEntireRoaring(set);
+
+    for(size_t i = 1; built && i < size; ++i) {
+        built = sortedValues[i - 1] <= sortedValues[i];
+    }
+
+    while(built && begin < size) {
+        // Finding the values sharing the key of the first one
+        uint16_t key = (uint16_t) (toUnsigned(sortedValues[begin]) >> 16);
+        size_t end = begin;
+        uint32_t cardinality = 0;
+
+        while(end < size && toUnsigned(sortedValues[end]) >> 16 == key) {
+            cardinality += end == begin ||
+                           sortedValues[end] != sortedValues[end - 1];
+            end += 1;
+        }
+
+        RoaringContainer *container = insertContainer(set,
+                                                      set->numContainers,
+                                                      key);
+
+        built = container != NULL;
+
+        if(built && cardinality <= ROARING_ARRAY_MAX_SIZE) {
+            built = reserve(container, cardinality);
+
+            for(size_t i = begin; built && i < end; ++i) {
+                if(i == begin || sortedValues[i] != sortedValues[i - 1]) {
+                    container->data.array[container->size++] =
+                        (uint16_t) toUnsigned(sortedValues[i]);
+                }
+            }
+        }
+        else if(built) {
+            uint64_t *bitmap = calloc(ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+            built = bitmap != NULL;
+
+            for(size_t i = begin; built && i < end; ++i) {
+                uint16_t low = (uint16_t) toUnsigned(sortedValues[i]);
+
+                bitmap[low >> 6] |= 1ULL << (low & 63);
+            }
+
+            if(built) {
+                container->data.bitmap = bitmap;
+                container->type = ROARING_BITMAP;
+            }
+        }
+
+        if(built) {
+            container->cardinality = cardinality;
+            set->count += cardinality;
+
+            // If the conversion fails, the container is kept as is
+            convertContainer(container, getBestType(container, true));
+        }
+
+        begin = end;
+    }
+
+    if(!built) {
+        deleteEntireRoaring(set);
+    }
+
+    return built;
+}
+
+int *getRoaringAsSortedArray(RoaringSet *set) {
+    int *sortedArray = NULL;
+
+    if(set && set->count > 0) {
+        uint16_t *lows = malloc(ROARING_MAX_CARDINALITY * sizeof(uint16_t));
+
+        sortedArray = malloc(set->count * sizeof(int));
+
+        if(sortedArray && lows) {
+            size_t index = 0;
+
+            for(size_t i = 0; i < set->numContainers; ++i) {
+                const RoaringContainer *container = &set->containers[i];
+                uint32_t high = (uint32_t) container->key << 16;
+
+                fillArray(container, lows);
+
+                for(uint32_t j = 0; j < container->cardinality; ++j) {
+                    sortedArray[index++] = toSigned(high | lows[j]);
+                }
+            }
+        }
+        else {
+            free(sortedArray);
+            sortedArray = NULL;
+        }
+
+        free(lows);
+    }
+
+    return sortedArray;
+}
+
+bool getRoaringUnion(RoaringSet *set1, RoaringSet *set2, RoaringSet *result) {
+    return combineRoaringSets(set1, set2, result, true);
+}
+
+bool getRoaringIntersection(RoaringSet *set1,
+                            RoaringSet *set2,
+                            RoaringSet *result) {
+    return combineRoaringSets(set1, set2, result, false);
+}
@@ -0,0 +1,374 @@
+/**
+ * @file scapegoat.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with scapegoat (weight-balanced) tree.
+ */
+
+#include "tree/scapegoat.h"
+
+/**
+ * @brief Tells if a child subtree is too heavy compared to its parent subtree,
+ *        i.e. childSize > alpha * parentSize.
+ */
+#define IS_TOO_HEAVY(childSize, parentSize) \
+    (SCAPEGOAT_ALPHA_DENOMINATOR * (childSize) > \
+     SCAPEGOAT_ALPHA_NUMERATOR * (parentSize))
+
+ScapegoatNode **getScapegoatLevelNodesWithPrefeed(
+                                        ScapegoatTree *tree,
+                                        size_t height,
+                                        size_t level,
+                                        ScapegoatNode **previousLevelNodes) {
+    return getBSTLevelNodesWithPrefeed(tree ? tree->root : NULL,
+                                       height,
+                                       level,
+                                       previousLevelNodes);
+}
+
+ScapegoatNode **getScapegoatLevelNodes(ScapegoatTree *tree,
+                                       size_t height,
+                                       size_t level) {
+    return getBSTLevelNodes(tree ? tree->root : NULL, height, level);
+}
+
+void displayScapegoatTree(ScapegoatTree *tree) {
+    // The layout is that of a BST, so we display it as such
+    displayBST(tree ? tree->root : NULL);
+}
+
+char *scapegoatTreeToStr(ScapegoatTree *tree) {
+    return bstToStr(tree ? tree->root : NULL);
+}
+
+/**
+ * @brief Computes the height bound h_alpha(n) = floor(log_{1/alpha}(n)), i.e.
+ *        the largest depth d such that (1/alpha)^d <= n. A node deeper than
+ *        this bound triggers a rebuild.
+ *
+ * @param count The count to compute the bound for.
+ *
+ * @return The maximum allowed depth (zero-based) of any node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t getAlphaHeight(size_t count) {
+    size_t height = 0;
+    double power = 1.0;
+    const double FACTOR = (double) SCAPEGOAT_ALPHA_DENOMINATOR /
+                          SCAPEGOAT_ALPHA_NUMERATOR;
+
+    while(power * FACTOR <= (double) count) {
+        power *= FACTOR;
+        ++height;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Flattens a subtree into an array of node pointers (in-order).
+ *
+ * @param root Pointer to the root node of the subtree.
+ *
+ * @param nodes The array to fill (of at least subtree count size).
+ *
+ * @param indexPtr Pointer to the current index within nodes.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void flatten(ScapegoatNode *root,
+                    ScapegoatNode **nodes,
+                    size_t *indexPtr) {
+    if(root) {
+        flatten(root->left, nodes, indexPtr);
+        nodes[(*indexPtr)++] = root;
+        flatten(root->right, nodes, indexPtr);
+    }
+}
+
+/**
+ * @brief Builds a perfectly balanced subtree out of sorted node pointers by
+ *        relinking them (no allocation is involved).
+ *
+ * @param nodes The sorted array of node pointers.
+ *
+ * @param count The number of nodes.
+ *
+ * @return The root of the built subtree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ScapegoatNode *buildBalanced(ScapegoatNode **nodes, size_t count) {
+    ScapegoatNode *root = NULL;
+
+    if(count > 0) {
+        size_t middle = count / 2;
+
+        root = nodes[middle];
+        root->left = buildBalanced(nodes, middle);
+        root->right = buildBalanced(nodes + middle + 1, count - middle - 1);
+    }
+
+    return root;
+}
+
+/**
+ * @brief Rebuilds the subtree rooted at *root into a perfectly balanced one.
+ *
+ * @param root Pointer to the pointer to the root of the subtree.
+ *
+ * @param count The number of nodes in the subtree.
+ *
+ * @note If the temporary array cannot be allocated, the subtree is kept as it
+ *       is (it remains a valid, although less balanced, tree).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rebuild(ScapegoatNode **root, size_t count) {
+    ScapegoatNode **nodes = malloc(count * sizeof(ScapegoatNode *));
+
+    if(nodes) {
+        size_t index = 0;
+        flatten(*root, nodes, &index);
+        *root = buildBalanced(nodes, count);
+        free(nodes);
+    }
+}
+
+/**
+ * @brief Creates a new leaf node and updates the tree counters.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @param value The value of the new node.
+ *
+ * @return The new node or NULL if allocation fails.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static ScapegoatNode *createNode(ScapegoatTree *tree, int value) {
+    ScapegoatNode *newNode = malloc(sizeof(ScapegoatNode));
+
+    if(newNode) {
+        newNode->value = value;
+        newNode->left = newNode->right = NULL;
+
+        tree->count++;
+
+        if(tree->count > tree->maxCount) {
+            tree->maxCount = tree->count;
+        }
+    }
+
+    return newNode;
+}
+
+bool addScapegoatNode(ScapegoatTree *tree, int value) {
+    bool added = false;
+
+    if(tree) {
+        /**
+         * We keep the insertion path (pointers to the child pointers) to be
+         * able to walk back up looking for the scapegoat.
+         */
+        ScapegoatNode **path[SCAPEGOAT_MAX_PATH_LENGTH];
+        size_t depth = 0;
+        ScapegoatNode **link = &tree->root;
+
+        while(*link && depth < SCAPEGOAT_MAX_PATH_LENGTH - 1) {
+            path[depth++] = link;
+            link = value <= (*link)->value ? &(*link)->left : &(*link)->right;
+        }
+
+        if(!(*link)) {
+            *link = createNode(tree, value);
+            added = *link != NULL;
+        }
+
+        if(added && depth > getAlphaHeight(tree->maxCount)) {
+            /**
+             * The new node is too deep: walk up computing subtree sizes
+             * until we find an ancestor whose child on the path is too heavy.
+             */
+            size_t childSize = 1;
+
+            while(depth > 0) {
+                ScapegoatNode **ancestor = path[--depth];
+                ScapegoatNode *sibling;
+
+                if(link == &(*ancestor)->left) {
+                    sibling = (*ancestor)->right;
+                }
+                else {
+                    sibling = (*ancestor)->left;
+                }
+
+                size_t size = childSize + 1 + getBSTCount(sibling);
+
+                if(IS_TOO_HEAVY(childSize, size)) {
+                    rebuild(ancestor, size);
+                    break;
+                }
+
+                childSize = size;
+                link = ancestor;
+            }
+        }
+    }
+
+    return added;
+}
+
+/**
+ * @brief Recursively inserts a new node and, while unwinding, looks for the
+ *        scapegoat if the node was inserted too deep.
+ *
+ * @param root Pointer to the pointer to the root of the current subtree.
+ *
+ * @param tree Pointer to the scapegoat tree (for counters).
+ *
+ * @param value The value to be added.
+ *
+ * @param depth The depth of the current subtree root.
+ *
+ * @param addedPtr Pointer to the variable that tells if the node was added.
+ *
+ * @return The size of the current subtree if we are still looking for the
+ *         scapegoat, and zero otherwise (no violation or already rebuilt).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static size_t addRecursively(ScapegoatNode **root,
+                             ScapegoatTree *tree,
+                             int value,
+                             size_t depth,
+                             bool *addedPtr) {
+    size_t size = 0;
+
+    if(!(*root)) {
+        *root = createNode(tree, value);
+        *addedPtr = *root != NULL;
+
+        if(*addedPtr && depth > getAlphaHeight(tree->maxCount)) {
+            size = 1;
+        }
+    }
+    else {
+        ScapegoatNode **child, *sibling;
+
+        if(value <= (*root)->value) {
+            child = &(*root)->left;
+            sibling = (*root)->right;
+        }
+        else {
+            child = &(*root)->right;
+            sibling = (*root)->left;
+        }
+
+        size_t childSize = addRecursively(child, tree, value, depth + 1,
+                                          addedPtr);
+
+        if(childSize > 0) {
+            size = childSize + 1 + getBSTCount(sibling);
+
+            if(IS_TOO_HEAVY(childSize, size)) {
+                rebuild(root, size);
+                size = 0;
+            }
+        }
+    }
+
+    return size;
+}
+
+bool addScapegoatNodeRecursively(ScapegoatTree *tree, int value) {
+    bool added = false;
+
+    if(tree) {
+        addRecursively(&tree->root, tree, value, 0, &added);
+    }
+
+    return added;
+}
+
+ScapegoatNode *findScapegoatNode(ScapegoatTree *tree, int value) {
+    return findBSTNode(tree ? tree->root : NULL, value);
+}
+
+ScapegoatNode *findScapegoatNodeRecursively(ScapegoatTree *tree, int value) {
+    return findBSTNodeRecursively(tree ? tree->root : NULL, value);
+}
+
+/**
+ * @brief Updates the counters after a successful deletion and rebuilds the
+ *        entire tree if it has shrunk below alpha * maxCount.
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void afterDeletion(ScapegoatTree *tree) {
+    tree->count--;
+
+    // Rebuilding the entire tree if count < alpha * maxCount
+    if(SCAPEGOAT_ALPHA_DENOMINATOR * tree->count <
+       SCAPEGOAT_ALPHA_NUMERATOR * tree->maxCount) {
+        if(tree->count > 0) {
+            rebuild(&tree->root, tree->count);
+        }
+
+        tree->maxCount = tree->count;
+    }
+}
+
+bool deleteScapegoatNode(ScapegoatTree *tree, int value) {
+    bool deleted = false;
+
+    if(tree && deleteBSTNode(&tree->root, value)) {
+        afterDeletion(tree);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+bool deleteScapegoatNodeRecursively(ScapegoatTree *tree, int value) {
+    bool deleted = false;
+
+    if(tree && deleteBSTNodeRecursively(&tree->root, value)) {
+        afterDeletion(tree);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+void deleteEntireScapegoat(ScapegoatTree *tree) {
+    if(tree) {
+        deleteEntireBST(&tree->root);
+        tree->count = tree->maxCount = 0;
+    }
+}
+
+size_t getScapegoatCount(ScapegoatTree *tree) {
+    return tree ? tree->count : 0;
+}
+
+size_t getScapegoatHeight(ScapegoatTree *tree) {
+    return getBSTHeight(tree ? tree->root : NULL);
+}
+
+bool maxScapegoat(ScapegoatTree *tree, int *maxValuePtr) {
+    return maxBST(tree ? tree->root : NULL, maxValuePtr);
+}
+
+bool minScapegoat(ScapegoatTree *tree, int *minValuePtr) {
+    return minBST(tree ? tree->root : NULL, minValuePtr);
+}
+
+int *getScapegoatAsSortedArray(ScapegoatTree *tree) {
+    return getBSTAsSortedArray(tree ? tree->root : NULL);
+}
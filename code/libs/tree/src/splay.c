@@ -0,0 +1,445 @@
+/**
+ * @file splay.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This file contains the implementation of the functions associated
+ *        with splay (self-adjusting) tree.
+ */
+
+#include "tree/splay.h"
+
+SplayNode **getSplayLevelNodesWithPrefeed(SplayNode *root,
+                                          size_t height,
+                                          size_t level,
+                                          SplayNode **previousLevelNodes) {
+    return getBSTLevelNodesWithPrefeed(root, height, level, previousLevelNodes);
+}
+
+SplayNode **getSplayLevelNodes(SplayNode *root, size_t height, size_t level) {
+    return getBSTLevelNodes(root, height, level);
+}
+
+void displaySplayTree(SplayNode *root) {
+    // The layout is that of a BST, so we display it as such
+    displayBST(root);
+}
+
+char *splayTreeToStr(SplayNode *root) {
+    return bstToStr(root);
+}
+
+/**
+ * @brief Performs a left rotation on a given node in a splay tree.
+ *
+ * @param node A pointer to a pointer to the node to be rotated (its right
+ *             child should not be NULL).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rotateLeft(SplayNode **node) {
+    /**
+     *              x                      y
+     *         T1       y      ==>     x       T3
+     *               T2   T3        T1   T2
+     */
+    SplayNode *xNode = *node;
+
+    *node = xNode->right;
+    xNode->right = (*node)->left;
+    (*node)->left = xNode;
+}
+
+/**
+ * @brief Performs a right rotation on a given node in a splay tree.
+ *
+ * @param node A pointer to a pointer to the node to be rotated (its left child
+ *             should not be NULL).
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void rotateRight(SplayNode **node) {
+    /**
+     *              x                      y
+     *         y       T3      ==>     T1      x
+     *      T1   T2                         T2   T3
+     */
+    SplayNode *xNode = *node;
+
+    *node = xNode->left;
+    xNode->left = (*node)->right;
+    (*node)->right = xNode;
+}
+
+/**
+ * @brief Splays the node holding the given value (or the last node visited
+ *        while searching for it) to the root using the top-down approach,
+ *        which needs no recursion and no parent pointers.
+ *
+ * @param root Pointer to the root node of a non-empty splay tree.
+ *
+ * @param value The value to splay for.
+ *
+ * @return The new root of the splay tree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static SplayNode *splay(SplayNode *root, int value) {
+    /**
+     * We split the tree into three parts while descending: a left tree
+     * holding values less than the value, a right tree holding values greater
+     * than it and the middle tree rooted at the current node. The header node
+     * collects the left tree in its right pointer and the right tree in its
+     * left pointer. leftTreeMax and rightTreeMin are the nodes where the next
+     * nodes are to be linked.
+     */
+    SplayNode header = {0, NULL, NULL};
+    SplayNode *leftTreeMax = &header, *rightTreeMin = &header;
+
+    while(root->value != value) {
+        if(value < root->value) {
+            if(!root->left) {
+                break;
+            }
+
+            if(value < root->left->value) {
+                // Zig-zig case: rotate right first
+                rotateRight(&root);
+
+                if(!root->left) {
+                    break;
+                }
+            }
+
+            // Linking the current root to the right tree
+            rightTreeMin->left = root;
+            rightTreeMin = root;
+            root = root->left;
+        }
+        else {
+            if(!root->right) {
+                break;
+            }
+
+            if(value > root->right->value) {
+                // Zag-zag case: rotate left first
+                rotateLeft(&root);
+
+                if(!root->right) {
+                    break;
+                }
+            }
+
+            // Linking the current root to the left tree
+            leftTreeMax->right = root;
+            leftTreeMax = root;
+            root = root->right;
+        }
+    }
+
+    // Reassembling the left, middle and right trees
+    leftTreeMax->right = root->left;
+    rightTreeMin->left = root->right;
+    root->left = header.right;
+    root->right = header.left;
+
+    return root;
+}
+
+/**
+ * @brief Splays the maximum node of a non-empty splay tree to the root using
+ *        the top-down approach. The new root has therefore no right child.
+ *
+ * @param root Pointer to the root node of a non-empty splay tree.
+ *
+ * @return The new root of the splay tree.
+ *
+ * @note We do not rely on splay(root, INT_MAX) as duplicates of the maximum
+ *       would stop the splaying before reaching the rightmost node.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static SplayNode *splayMax(SplayNode *root) {
+    SplayNode header = {0, NULL, NULL};
+    SplayNode *leftTreeMax = &header;
+
+    while(root->right) {
+        if(root->right->right) {
+            // Zag-zag case
+            rotateLeft(&root);
+        }
+
+        if(root->right) {
+            leftTreeMax->right = root;
+            leftTreeMax = root;
+            root = root->right;
+        }
+    }
+
+    leftTreeMax->right = root->left;
+    root->left = header.right;
+
+    return root;
+}
+
+/**
+ * @brief Splays the node holding the given value (or the last node visited
+ *        while searching for it) to the root using recursion (bottom-up
+ *        approach).
+ *
+ * @param root Pointer to the pointer to the root node of the (sub-)tree.
+ *
+ * @param value The value to splay for.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void splayRecursively(SplayNode **root, int value) {
+    if(*root && (*root)->value != value) {
+        if(value < (*root)->value) {
+            SplayNode **left = &(*root)->left;
+
+            if(*left) {
+                if(value < (*left)->value) {
+                    // Zig-zig: bring the value up in left-left subtree first
+                    splayRecursively(&(*left)->left, value);
+                    rotateRight(root);
+                }
+                else if(value > (*left)->value) {
+                    // Zig-zag: bring the value up in left-right subtree first
+                    splayRecursively(&(*left)->right, value);
+
+                    if((*left)->right) {
+                        rotateLeft(left);
+                    }
+                }
+
+                // Final zig (left pointer may have changed after rotation)
+                if((*root)->left) {
+                    rotateRight(root);
+                }
+            }
+        }
+        else {
+            SplayNode **right = &(*root)->right;
+
+            if(*right) {
+                if(value > (*right)->value) {
+                    // Zag-zag
+                    splayRecursively(&(*right)->right, value);
+                    rotateLeft(root);
+                }
+                else if(value < (*right)->value) {
+                    // Zag-zig
+                    splayRecursively(&(*right)->left, value);
+
+                    if((*right)->left) {
+                        rotateRight(right);
+                    }
+                }
+
+                // Final zag
+                if((*root)->right) {
+                    rotateLeft(root);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Splays the maximum node of a splay tree to the root using recursion.
+ *
+ * @param root Pointer to the pointer to the root node of the (sub-)tree.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void splayMaxRecursively(SplayNode **root) {
+    if(*root && (*root)->right) {
+        // Zag-zag: bring the maximum up in the right-right subtree first
+        splayMaxRecursively(&(*root)->right->right);
+        rotateLeft(root);
+
+        if((*root)->right) {
+            rotateLeft(root);
+        }
+    }
+}
+
+/**
+ * @brief Creates a new splay node and makes it the root after splitting the
+ *        (already splayed) tree around the new value.
+ *
+ * @param root Pointer to the pointer to the root node of the splay tree, which
+ *             has just been splayed for the value (or is empty).
+ *
+ * @param value The value to be added.
+ *
+ * @return True if the node was successfully allocated and added.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static bool addAsRoot(SplayNode **root, int value) {
+    bool added = false;
+    SplayNode *newNode = malloc(sizeof(SplayNode));
+
+    if(newNode) {
+        // Allocation was successful
+        newNode->value = value;
+
+        if(!(*root)) {
+            newNode->left = newNode->right = NULL;
+        }
+        else if(value < (*root)->value) {
+            // The old root and its right subtree are greater
+            newNode->left = (*root)->left;
+            newNode->right = *root;
+            (*root)->left = NULL;
+        }
+        else {
+            /**
+             * The old root (possibly a duplicate) and its left subtree are
+             * less than or equal to the value.
+             */
+            newNode->right = (*root)->right;
+            newNode->left = *root;
+            (*root)->right = NULL;
+        }
+
+        *root = newNode;
+        added = true;
+    }
+
+    return added;
+}
+
+bool addSplayNode(SplayNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        if(*root) {
+            *root = splay(*root, value);
+        }
+
+        added = addAsRoot(root, value);
+    }
+
+    return added;
+}
+
+bool addSplayNodeRecursively(SplayNode **root, int value) {
+    bool added = false;
+
+    if(root) {
+        splayRecursively(root, value);
+        added = addAsRoot(root, value);
+    }
+
+    return added;
+}
+
+SplayNode *findSplayNode(SplayNode **root, int value) {
+    SplayNode *itemPtr = NULL;
+
+    if(root && *root) {
+        *root = splay(*root, value);
+
+        if((*root)->value == value) {
+            itemPtr = *root;
+        }
+    }
+
+    return itemPtr;
+}
+
+SplayNode *findSplayNodeRecursively(SplayNode **root, int value) {
+    SplayNode *itemPtr = NULL;
+
+    if(root && *root) {
+        splayRecursively(root, value);
+
+        if((*root)->value == value) {
+            itemPtr = *root;
+        }
+    }
+
+    return itemPtr;
+}
+
+/**
+ * @brief Removes the root of a splay tree by joining its left and right
+ *        subtrees. The maximum of the left subtree is splayed to its top (so
+ *        that it has no right child) and then receives the right subtree.
+ *
+ * @param root Pointer to the pointer to the root node to be removed.
+ *
+ * @param recursive Whether recursive splaying should be used.
+ *
+ * @note The function is statically typed to limit its scope to this file only.
+ */
+static void deleteRoot(SplayNode **root, bool recursive) {
+    SplayNode *itemPtr = *root;
+
+    if(!itemPtr->left) {
+        *root = itemPtr->right;
+    }
+    else {
+        if(recursive) {
+            splayMaxRecursively(&itemPtr->left);
+        }
+        else {
+            itemPtr->left = splayMax(itemPtr->left);
+        }
+
+        *root = itemPtr->left;
+        (*root)->right = itemPtr->right;
+    }
+
+    free(itemPtr);
+}
+
+bool deleteSplayNode(SplayNode **root, int value) {
+    bool deleted = false;
+
+    if(findSplayNode(root, value)) {
+        // The node to be deleted is now the root
+        deleteRoot(root, false);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+bool deleteSplayNodeRecursively(SplayNode **root, int value) {
+    bool deleted = false;
+
+    if(findSplayNodeRecursively(root, value)) {
+        deleteRoot(root, true);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+void deleteEntireSplay(SplayNode **root) {
+    deleteEntireBST(root);
+}
+
+size_t getSplayCount(SplayNode *root) {
+    return getBSTCount(root);
+}
+
+size_t getSplayHeight(SplayNode *root) {
+    return getBSTHeight(root);
+}
+
+bool maxSplay(SplayNode *root, int *maxValuePtr) {
+    return maxBST(root, maxValuePtr);
+}
+
+bool minSplay(SplayNode *root, int *minValuePtr) {
+    return minBST(root, minValuePtr);
+}
+
+int *getSplayAsSortedArray(SplayNode *root) {
+    return getBSTAsSortedArray(root);
+}
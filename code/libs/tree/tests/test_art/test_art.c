@@ -0,0 +1,248 @@
+/**
+ * @file test_art.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to adaptive radix tree in "art.h",
+ *        checking the results against the ones of AVL tree in "avl.h".
+ */
+
+#include <limits.h>
+#include <stdio.h>
+
+#define UNITY_EXCLUDE_THREAD_SUPPORT
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "tree/art.h"
+#include "tree/avl.h"
+
+/**
+ * @brief Stops a traversal once the visited value reaches the limit pointed
+ *        to by context, counting the visited values below it.
+ */
+bool visitBelowLimit(int value, void *context) {
+    int *limitAndCount = context;
+    bool goOn = value < limitAndCount[0];
+
+    limitAndCount[1] += goOn;
+
+    return goOn;
+}
+
+/**
+ * @brief Creates ARTFunctions test group.
+ */
+TEST_GROUP(ARTFunctions);
+
+/**
+ * @brief Creates ARTFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(ARTFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates ARTFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(ARTFunctions) {
+    // Each test deletes its own trees
+};
+
+/**
+ * @brief Creates ARTFunctions test case: inner nodes grow from ARTNode4 to
+ *        ARTNode256 and shrink back, and the common key bytes are compressed.
+ */
+TEST(ARTFunctions, test_node_sizes) {
+    ARTNode *root = NULL;
+    int base = 0x12345600;
+
+    TEST_ASSERT_TRUE(addARTNode(&root, base));
+    TEST_ASSERT_EQUAL(ART_LEAF, root->type);
+    TEST_ASSERT_FALSE(addARTNode(&root, base));
+
+    for(int i = 1; i < 256; ++i) {
+        TEST_ASSERT_TRUE(addARTNode(&root, base + i));
+
+        ARTNodeType expected = i < 4 ? ART_NODE4 :
+                               i < 16 ? ART_NODE16 :
+                               i < 48 ? ART_NODE48 : ART_NODE256;
+
+        TEST_ASSERT_EQUAL(expected, root->type);
+        TEST_ASSERT_EQUAL(i + 1, root->numChildren);
+    }
+
+    // The three first key bytes are shared by all values
+    TEST_ASSERT_EQUAL(3, root->prefixLength);
+    TEST_ASSERT_EQUAL(2, getARTHeight(root));
+    TEST_ASSERT_EQUAL(256, getARTCount(root));
+
+    // A value differing on the second key byte splits the prefix
+    TEST_ASSERT_TRUE(addARTNode(&root, 0x12FF0000));
+    TEST_ASSERT_EQUAL(ART_NODE4, root->type);
+    TEST_ASSERT_EQUAL(1, root->prefixLength);
+    TEST_ASSERT_EQUAL(3, getARTHeight(root));
+    TEST_ASSERT_TRUE(deleteARTNode(&root, 0x12FF0000));
+    TEST_ASSERT_EQUAL(3, root->prefixLength);
+
+    for(int i = 255; i > 0; --i) {
+        TEST_ASSERT_TRUE(deleteARTNode(&root, base + i));
+        TEST_ASSERT_FALSE(deleteARTNode(&root, base + i));
+
+        if(i == 37) {
+            TEST_ASSERT_EQUAL(ART_NODE48, root->type);
+        }
+        else if(i == 12) {
+            TEST_ASSERT_EQUAL(ART_NODE16, root->type);
+        }
+        else if(i == 3) {
+            TEST_ASSERT_EQUAL(ART_NODE4, root->type);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(ART_LEAF, root->type);
+    TEST_ASSERT_NOT_NULL(findARTNode(root, base));
+    TEST_ASSERT_TRUE(deleteARTNode(&root, base));
+    TEST_ASSERT_NULL(root);
+}
+
+/**
+ * @brief Creates ARTFunctions test case: scattered values give the same results
+ *        as an AVL tree while adding, finding and deleting.
+ */
+TEST(ARTFunctions, test_against_avl) {
+    ARTNode *root = NULL;
+    AVLNode *avlRoot = NULL;
+    const size_t COUNT = 4000;
+    int values[4000];
+
+    for(size_t i = 0; i < COUNT; ++i) {
+        /**
+         * Clustered values (sharing key bytes, some repeated) and spread ones,
+         * the multiplier 2654435761 (about 2^32 divided by the golden ratio)
+         * scattering consecutive indices.
+         */
+        values[i] = i % 2 ? (int) ((i * 7919) % 2500) - 1250
+                          : (int) ((unsigned) (i / 2) * 2654435761U);
+
+        bool added = addAVLNode(&avlRoot, values[i]);
+        TEST_ASSERT_EQUAL(added, addARTNode(&root, values[i]));
+    }
+
+    TEST_ASSERT_TRUE(addARTNode(&root, INT_MIN) && addARTNode(&root, INT_MAX));
+    TEST_ASSERT_TRUE(addAVLNode(&avlRoot, INT_MIN) &&
+                     addAVLNode(&avlRoot, INT_MAX));
+
+    for(int round = 0; round < 2; ++round) {
+        size_t count = getAVLCount(avlRoot);
+        int *expected = getAVLAsSortedArray(avlRoot);
+        int *sortedValues = getARTAsSortedArray(root);
+        int minValue, maxValue, avlMinValue, avlMaxValue;
+
+        TEST_ASSERT_EQUAL(count, getARTCount(root));
+        TEST_ASSERT_EQUAL_INT_ARRAY(expected, sortedValues, count);
+
+        TEST_ASSERT_TRUE(minART(root, &minValue) &&
+                         minAVL(avlRoot, &avlMinValue));
+        TEST_ASSERT_TRUE(maxART(root, &maxValue) &&
+                         maxAVL(avlRoot, &avlMaxValue));
+        TEST_ASSERT_EQUAL(avlMinValue, minValue);
+        TEST_ASSERT_EQUAL(avlMaxValue, maxValue);
+
+        for(int value = -3000; value < 3000; ++value) {
+            TEST_ASSERT_EQUAL(findAVLNode(avlRoot, value) != NULL,
+                              findARTNode(root, value) != NULL);
+        }
+
+        TEST_ASSERT_LESS_OR_EQUAL(5, getARTHeight(root));
+
+        free(expected);
+        free(sortedValues);
+
+        // Deleting half of the values, then checking again
+        for(size_t i = 0; round == 0 && i < COUNT; i += 2) {
+            bool deleted = deleteAVLNode(&avlRoot, values[i]);
+            TEST_ASSERT_EQUAL(deleted, deleteARTNode(&root, values[i]));
+        }
+    }
+
+    deleteEntireART(&root);
+    deleteEntireAVL(&avlRoot);
+    TEST_ASSERT_NULL(root);
+}
+
+/**
+ * @brief Creates ARTFunctions test case: ordered traversal and string
+ *        representation.
+ */
+TEST(ARTFunctions, test_traversal) {
+    ARTNode *root = NULL;
+    int limitAndCount[2] = {10, 0};
+    int minValue;
+    char *str;
+
+    str = artToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    TEST_ASSERT_FALSE(minART(root, &minValue));
+    TEST_ASSERT_NULL(getARTAsSortedArray(root));
+    TEST_ASSERT_TRUE(traverseART(root, visitBelowLimit, limitAndCount));
+
+    int values[] = {300, -1, 7, 65536, 0, -70000, 12, 5};
+
+    for(size_t i = 0; i < sizeof(values) / sizeof(int); ++i) {
+        TEST_ASSERT_TRUE(addARTNode(&root, values[i]));
+    }
+
+    str = artToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< -70000 | -1 | 0 | 5 | 7 | 12 | 300 | 65536 >",
+                             str);
+    free(str);
+
+    // The traversal stops at 12
+    TEST_ASSERT_FALSE(traverseART(root, visitBelowLimit, limitAndCount));
+    TEST_ASSERT_EQUAL(5, limitAndCount[1]);
+
+    deleteEntireART(&root);
+}
+
+/**
+ * @brief Creates ARTFunctions test case: the height does not grow with the
+ *        number of values.
+ */
+TEST(ARTFunctions, test_height) {
+    ARTNode *root = NULL;
+    size_t count = 0;
+
+    for(size_t i = 0; i < 200000; ++i) {
+        count += addARTNode(&root, (int) ((unsigned) i * 2654435761U));
+    }
+
+    TEST_ASSERT_EQUAL(count, getARTCount(root));
+    TEST_ASSERT_LESS_OR_EQUAL(5, getARTHeight(root));
+
+    deleteEntireART(&root);
+}
+
+/**
+ * @brief Creates ARTFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(ARTFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(ARTFunctions, test_node_sizes);
+    RUN_TEST_CASE(ARTFunctions, test_against_avl);
+    RUN_TEST_CASE(ARTFunctions, test_traversal);
+    RUN_TEST_CASE(ARTFunctions, test_height);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the ARTFunctions group tests
+    RUN_TEST_GROUP(ARTFunctions);
+
+    // End testing
+    return UNITY_END();
+}
@@ -131,7 +131,9 @@ char *getLevelAsFormattedStr(Node **nodes, size_t numNodes, size_t numDigits) {
         str = malloc(len * sizeof(char));
 
         if(str) {
-            // Successful allocation
+            // Successful allocation (starting from an empty string to append)
+            str[0] = '\0';
+
             for(size_t i = 0; i < numNodes - 1; ++i) {
                 if(nodes[i]) {
                     sprintf(str + strlen(str), "%d ", nodes[i]->value);
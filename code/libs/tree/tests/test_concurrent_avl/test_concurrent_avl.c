@@ -0,0 +1,289 @@
+/**
+ * @file test_concurrent_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to concurrent AVL tree in
+ *        "concurrent_avl.h", first from a single thread and then from several
+ *        threads working on the same tree.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "reclamation/ebr.h"
+#include "tree/concurrent_avl.h"
+
+/**
+ * @def NUM_THREADS
+ *
+ * @brief The number of threads used by the multi-threaded tests.
+ */
+#define NUM_THREADS 4
+
+/**
+ * @def KEYS_PER_THREAD
+ *
+ * @brief The number of keys owned by every thread in multi-threaded tests.
+ */
+#define KEYS_PER_THREAD 2000
+
+/**
+ * @brief The tree shared by the threads of multi-threaded tests.
+ */
+ConcurrentAVLTree sharedTree;
+
+/**
+ * @brief Tells if a concurrent AVL tree is ordered and balanced (routing
+ *        nodes included), computing its height at the same time.
+ *
+ * @param node Pointer to the root node of the (sub-)tree.
+ *
+ * @param minValue The minimum allowed value in the subtree.
+ *
+ * @param maxValue The maximum allowed value in the subtree.
+ *
+ * @param[out] heightPtr Pointer to the variable storing the subtree height.
+ *
+ * @return True if the subtree is ordered and balanced and false otherwise.
+ */
+bool isValid(ConcurrentAVLNode *node,
+             long minValue,
+             long maxValue,
+             int *heightPtr) {
+    bool valid = true;
+    *heightPtr = 0;
+
+    if(node) {
+        int leftHeight, rightHeight;
+
+        valid = node->value >= minValue && node->value <= maxValue &&
+                isValid(node->left, minValue, node->value - 1L, &leftHeight) &&
+                isValid(node->right, node->value + 1L, maxValue, &rightHeight);
+
+        if(valid) {
+            valid = leftHeight - rightHeight <= 1 &&
+                    rightHeight - leftHeight <= 1 &&
+                    node->parent &&
+                    (node->parent->left == node || node->parent->right == node);
+            *heightPtr = 1 + (leftHeight > rightHeight ? leftHeight :
+                                                         rightHeight);
+        }
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Tells if the whole tree is ordered and balanced.
+ */
+bool isValidTree(ConcurrentAVLTree *tree) {
+    int height;
+
+    return isValid(tree->holder.right, -1000000L, 1000000L, &height);
+}
+
+/**
+ * @brief A thread adding its own keys, checking them, deleting half of them
+ *        and looking up the keys of the other threads on the way.
+ *
+ * @param arg Pointer to the thread index.
+ *
+ * @return NULL if all the operations went as expected and arg otherwise.
+ */
+void *runWorker(void *arg) {
+    int index = *(int *) arg;
+    bool ok = true;
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        // Interleaving the keys of the threads to get them to collide
+        int key = i * NUM_THREADS + index;
+
+        ok = addConcurrentAVLNode(&sharedTree, key) && ok;
+        ok = !addConcurrentAVLNode(&sharedTree, key) && ok;
+
+        // Others' keys may or may not be present, but lookups must not fail
+        findConcurrentAVLNode(&sharedTree, key + 1);
+    }
+
+    for(int i = 0; i < KEYS_PER_THREAD; ++i) {
+        int key = i * NUM_THREADS + index;
+
+        ok = findConcurrentAVLNode(&sharedTree, key) && ok;
+
+        if(i % 2 == 0) {
+            ok = deleteConcurrentAVLNode(&sharedTree, key) && ok;
+            ok = !deleteConcurrentAVLNode(&sharedTree, key) && ok;
+            ok = !findConcurrentAVLNode(&sharedTree, key) && ok;
+        }
+    }
+
+    // Letting another thread reuse the reclamation record
+    unregisterEBRThread();
+
+    return ok ? NULL : arg;
+}
+
+/**
+ * @brief Creates ConcurrentAVLFunctions test group.
+ */
+TEST_GROUP(ConcurrentAVLFunctions);
+
+/**
+ * @brief Creates ConcurrentAVLFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(ConcurrentAVLFunctions) {
+    initConcurrentAVL(&sharedTree);
+};
+
+/**
+ * @brief Creates ConcurrentAVLFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(ConcurrentAVLFunctions) {
+    destroyConcurrentAVL(&sharedTree);
+    reclaimAllEBRPointers();
+};
+
+/**
+ * @brief Creates ConcurrentAVLFunctions test case: single-threaded adding,
+ *        finding and deleting.
+ */
+TEST(ConcurrentAVLFunctions, test_single_thread) {
+    int nums[] = {50, 30, 70, 20, 40, 60, 80, 10, 90, 100, 45, 35, 65, 75};
+    size_t len = sizeof(nums) / sizeof(int);
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(addConcurrentAVLNode(&sharedTree, nums[i]));
+        TEST_ASSERT_EQUAL(i + 1, getConcurrentAVLCount(&sharedTree));
+        TEST_ASSERT_TRUE(isValidTree(&sharedTree));
+    }
+
+    // Duplicates are not allowed
+    TEST_ASSERT_FALSE(addConcurrentAVLNode(&sharedTree, 40));
+    TEST_ASSERT_EQUAL(len, getConcurrentAVLCount(&sharedTree));
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(findConcurrentAVLNode(&sharedTree, nums[i]));
+    }
+
+    TEST_ASSERT_FALSE(findConcurrentAVLNode(&sharedTree, 11));
+    TEST_ASSERT_FALSE(deleteConcurrentAVLNode(&sharedTree, 11));
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(deleteConcurrentAVLNode(&sharedTree, nums[i]));
+        TEST_ASSERT_FALSE(findConcurrentAVLNode(&sharedTree, nums[i]));
+        TEST_ASSERT_EQUAL(len - i - 1, getConcurrentAVLCount(&sharedTree));
+        TEST_ASSERT_TRUE(isValidTree(&sharedTree));
+
+        // Adding back the deleted value and deleting it again
+        TEST_ASSERT_TRUE(addConcurrentAVLNode(&sharedTree, nums[i]));
+        TEST_ASSERT_TRUE(findConcurrentAVLNode(&sharedTree, nums[i]));
+        TEST_ASSERT_TRUE(deleteConcurrentAVLNode(&sharedTree, nums[i]));
+    }
+
+    // Routing nodes left behind (if any) do not hold values
+    char *str = concurrentAVLToStr(&sharedTree);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+}
+
+/**
+ * @brief Creates ConcurrentAVLFunctions test case: sorted insertions keep the
+ *        tree balanced.
+ */
+TEST(ConcurrentAVLFunctions, test_sorted_insertions) {
+    const int COUNT = 1023;
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(addConcurrentAVLNode(&sharedTree, i));
+    }
+
+    TEST_ASSERT_TRUE(isValidTree(&sharedTree));
+
+    // A perfectly balanced tree of 1023 nodes has a height of 10
+    TEST_ASSERT_TRUE(getConcurrentAVLHeight(&sharedTree) <= 11);
+
+    int *sortedArray = getConcurrentAVLAsSortedArray(&sharedTree);
+    TEST_ASSERT_TRUE(sortedArray != NULL);
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i, sortedArray[i]);
+    }
+
+    free(sortedArray);
+
+    char *str;
+    for(int i = 3; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(deleteConcurrentAVLNode(&sharedTree, i));
+    }
+
+    str = concurrentAVLToStr(&sharedTree);
+    TEST_ASSERT_EQUAL_STRING("< 0 | 1 | 2 >", str);
+    free(str);
+}
+
+/**
+ * @brief Creates ConcurrentAVLFunctions test case: several threads add, find
+ *        and delete their own keys on the same tree at the same time.
+ */
+TEST(ConcurrentAVLFunctions, test_multiple_threads) {
+    pthread_t threads[NUM_THREADS];
+    int indices[NUM_THREADS];
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        indices[t] = t;
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[t],
+                                            NULL,
+                                            runWorker,
+                                            &indices[t]));
+    }
+
+    for(int t = 0; t < NUM_THREADS; ++t) {
+        void *result;
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[t], &result));
+        TEST_ASSERT_EQUAL_PTR(NULL, result);
+    }
+
+    // Half the keys of every thread remain
+    TEST_ASSERT_EQUAL(NUM_THREADS * KEYS_PER_THREAD / 2,
+                      getConcurrentAVLCount(&sharedTree));
+    TEST_ASSERT_TRUE(isValidTree(&sharedTree));
+
+    int *sortedArray = getConcurrentAVLAsSortedArray(&sharedTree);
+    TEST_ASSERT_TRUE(sortedArray != NULL);
+
+    for(int i = 0; i < NUM_THREADS * KEYS_PER_THREAD / 2; ++i) {
+        // Keys of even rank i * NUM_THREADS + index were deleted
+        int rank = i / NUM_THREADS * 2 + 1;
+        TEST_ASSERT_EQUAL(rank * NUM_THREADS + i % NUM_THREADS,
+                          sortedArray[i]);
+    }
+
+    free(sortedArray);
+}
+
+/**
+ * @brief Creates ConcurrentAVLFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(ConcurrentAVLFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(ConcurrentAVLFunctions, test_single_thread);
+    RUN_TEST_CASE(ConcurrentAVLFunctions, test_sorted_insertions);
+    RUN_TEST_CASE(ConcurrentAVLFunctions, test_multiple_threads);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the ConcurrentAVLFunctions group tests
+    RUN_TEST_GROUP(ConcurrentAVLFunctions);
+
+    // End testing
+    return UNITY_END();
+}
@@ -0,0 +1,228 @@
+/**
+ * @file test_persistent_avl.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to persistent AVL tree in
+ *        "persistent_avl.h".
+ */
+
+#include <stdio.h>
+
+#define UNITY_EXCLUDE_THREAD_SUPPORT
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "tree/persistent_avl.h"
+
+/**
+ * @brief Tells if a persistent AVL version is ordered and balanced with
+ *        properly stored heights.
+ *
+ * @param node Pointer to the root node of the (sub-)tree.
+ *
+ * @param minValue The minimum allowed value in the subtree.
+ *
+ * @param maxValue The maximum allowed value in the subtree.
+ *
+ * @return True if the subtree is valid and false otherwise.
+ */
+bool isValid(PersistentAVLNode *node, long minValue, long maxValue) {
+    bool valid = true;
+
+    if(node) {
+        int leftHeight = node->left ? node->left->height : 0;
+        int rightHeight = node->right ? node->right->height : 0;
+
+        valid = node->value >= minValue && node->value <= maxValue &&
+                leftHeight - rightHeight <= 1 &&
+                rightHeight - leftHeight <= 1 &&
+                node->height == 1 + (leftHeight > rightHeight ? leftHeight :
+                                                                rightHeight) &&
+                isValid(node->left, minValue, node->value - 1L) &&
+                isValid(node->right, node->value + 1L, maxValue);
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Counts the nodes that belong only to a given version, i.e. the ones
+ *        reachable from its root without going through a shared node (having
+ *        more than one reference).
+ *
+ * @param node Pointer to the root node of the version.
+ *
+ * @return The number of nodes private to the version.
+ */
+size_t countPrivateNodes(PersistentAVLNode *node) {
+    size_t count = 0;
+
+    if(node && atomic_load(&node->refCount) == 1) {
+        count = 1 + countPrivateNodes(node->left) +
+                    countPrivateNodes(node->right);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Creates PersistentAVLFunctions test group.
+ */
+TEST_GROUP(PersistentAVLFunctions);
+
+/**
+ * @brief Creates PersistentAVLFunctions group setup that run prior to every
+ *        test.
+ */
+TEST_SETUP(PersistentAVLFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates PersistentAVLFunctions group teardown that run after every
+ *        test.
+ */
+TEST_TEAR_DOWN(PersistentAVLFunctions) {
+    // Add any test teardown code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates PersistentAVLFunctions test case: old versions are kept
+ *        intact upon adding and deleting.
+ */
+TEST(PersistentAVLFunctions, test_versions) {
+    PersistentAVLNode *versions[4] = {NULL};
+    char *str;
+
+    TEST_ASSERT_TRUE(addPersistentAVLNode(NULL, 8, &versions[0]));
+    TEST_ASSERT_TRUE(addPersistentAVLNode(versions[0], 3, &versions[1]));
+    TEST_ASSERT_TRUE(addPersistentAVLNode(versions[1], 12, &versions[2]));
+    TEST_ASSERT_TRUE(deletePersistentAVLNode(versions[2], 8, &versions[3]));
+
+    const char *expected[] = {"< 8 >",
+                              "< 3 | 8 >",
+                              "< 3 | 8 | 12 >",
+                              "< 3 | 12 >"};
+
+    for(size_t i = 0; i < 4; ++i) {
+        str = persistentAVLToStr(versions[i]);
+        TEST_ASSERT_EQUAL_STRING(expected[i], str);
+        free(str);
+        TEST_ASSERT_TRUE(isValid(versions[i], -1000, 1000));
+    }
+
+    TEST_ASSERT_TRUE(findPersistentAVLNode(versions[2], 8) != NULL);
+    TEST_ASSERT_EQUAL(NULL, findPersistentAVLNode(versions[3], 8));
+
+    // Duplicates and non-existing values give back the same version
+    PersistentAVLNode *sameVersion;
+    TEST_ASSERT_FALSE(addPersistentAVLNode(versions[3], 3, &sameVersion));
+    TEST_ASSERT_EQUAL_PTR(versions[3], sameVersion);
+    releasePersistentAVL(sameVersion);
+
+    TEST_ASSERT_FALSE(deletePersistentAVLNode(versions[3], 8, &sameVersion));
+    TEST_ASSERT_EQUAL_PTR(versions[3], sameVersion);
+    releasePersistentAVL(sameVersion);
+
+    // Releasing versions in any order keeps the remaining ones valid
+    releasePersistentAVL(versions[1]);
+    releasePersistentAVL(versions[3]);
+
+    str = persistentAVLToStr(versions[2]);
+    TEST_ASSERT_EQUAL_STRING("< 3 | 8 | 12 >", str);
+    free(str);
+
+    releasePersistentAVL(versions[0]);
+    releasePersistentAVL(versions[2]);
+
+    str = persistentAVLToStr(NULL);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+}
+
+/**
+ * @brief Creates PersistentAVLFunctions test case: snapshots are O(1) and
+ *        updates copy only O(log n) nodes.
+ */
+TEST(PersistentAVLFunctions, test_path_copying) {
+    PersistentAVLNode *root = NULL, *newRoot;
+    const int COUNT = 1000;
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(addPersistentAVLNode(root, i, &newRoot));
+        releasePersistentAVL(root);
+        root = newRoot;
+    }
+
+    TEST_ASSERT_TRUE(isValid(root, -100000, 100000));
+    TEST_ASSERT_EQUAL(COUNT, getPersistentAVLCount(root));
+    TEST_ASSERT_EQUAL(COUNT, countPrivateNodes(root));
+
+    size_t height = getPersistentAVLHeight(root);
+    TEST_ASSERT_TRUE(height <= 15);
+
+    // Taking a snapshot shares the entire tree
+    PersistentAVLNode *snapshot = acquirePersistentAVL(root);
+    TEST_ASSERT_EQUAL_PTR(root, snapshot);
+    TEST_ASSERT_EQUAL(0, countPrivateNodes(root));
+
+    for(int i = 0; i < COUNT; i += 7) {
+        TEST_ASSERT_TRUE(deletePersistentAVLNode(root, i, &newRoot));
+        TEST_ASSERT_TRUE(isValid(newRoot, -100000, 100000));
+
+        // Only the path (plus the rotated nodes) is copied
+        TEST_ASSERT_TRUE(countPrivateNodes(newRoot) <= 2 * height);
+
+        releasePersistentAVL(root);
+        root = newRoot;
+    }
+
+    // The snapshot did not change
+    TEST_ASSERT_EQUAL(COUNT, getPersistentAVLCount(snapshot));
+    TEST_ASSERT_TRUE(isValid(snapshot, -100000, 100000));
+
+    int *sortedArray = getPersistentAVLAsSortedArray(snapshot);
+    TEST_ASSERT_TRUE(sortedArray != NULL);
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i, sortedArray[i]);
+    }
+
+    free(sortedArray);
+
+    // Meanwhile, the latest version lost every seventh value
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i % 7 != 0, findPersistentAVLNode(root, i) != NULL);
+    }
+
+    int minValue, maxValue;
+    TEST_ASSERT_TRUE(minPersistentAVL(root, &minValue));
+    TEST_ASSERT_EQUAL(1, minValue);
+    TEST_ASSERT_TRUE(maxPersistentAVL(root, &maxValue));
+    TEST_ASSERT_EQUAL(COUNT - 1, maxValue);
+
+    releasePersistentAVL(snapshot);
+    TEST_ASSERT_EQUAL(getPersistentAVLCount(root), countPrivateNodes(root));
+    releasePersistentAVL(root);
+}
+
+/**
+ * @brief Creates PersistentAVLFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(PersistentAVLFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(PersistentAVLFunctions, test_versions);
+    RUN_TEST_CASE(PersistentAVLFunctions, test_path_copying);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the PersistentAVLFunctions group tests
+    RUN_TEST_GROUP(PersistentAVLFunctions);
+
+    // End testing
+    return UNITY_END();
+}
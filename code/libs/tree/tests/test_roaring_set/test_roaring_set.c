@@ -0,0 +1,365 @@
+/**
+ * @file test_roaring_set.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to compressed integer set in
+ *        "roaring_set.h".
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#define UNITY_EXCLUDE_THREAD_SUPPORT
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "tree/avl.h"
+#include "tree/roaring_set.h"
+
+/**
+ * @brief Returns the type of the container holding a value (the value is
+ *        expected to be in the set).
+ */
+RoaringContainerType getContainerType(RoaringSet *set, int value) {
+    uint16_t key = (uint16_t) (((uint32_t) value ^ 0x80000000U) >> 16);
+    RoaringContainerType type = ROARING_ARRAY;
+
+    for(size_t i = 0; i < set->numContainers; ++i) {
+        if(set->containers[i].key == key) {
+            type = set->containers[i].type;
+        }
+    }
+
+    return type;
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test group.
+ */
+TEST_GROUP(RoaringSetFunctions);
+
+/**
+ * @brief Creates RoaringSetFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(RoaringSetFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates RoaringSetFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(RoaringSetFunctions) {
+    // Each test deletes its own sets
+};
+
+/**
+ * @brief Creates RoaringSetFunctions test case: adding, finding and deleting
+ *        values, including the extreme ones, and rejecting duplicates.
+ */
+TEST(RoaringSetFunctions, test_add_find_delete) {
+    RoaringSet set = {0};
+    int values[] = {INT_MIN, -65537, -65536, -1, 0, 1, 65535, 65536, INT_MAX};
+    const size_t SIZE = sizeof(values) / sizeof(int);
+    char *str;
+
+    str = roaringSetToStr(&set);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    TEST_ASSERT_FALSE(findRoaringValue(&set, 0));
+    TEST_ASSERT_FALSE(deleteRoaringValue(&set, 0));
+
+    for(size_t i = SIZE; i > 0; --i) {
+        TEST_ASSERT_TRUE(addRoaringValue(&set, values[i - 1]));
+        TEST_ASSERT_FALSE(addRoaringValue(&set, values[i - 1]));
+    }
+
+    TEST_ASSERT_EQUAL(SIZE, getRoaringCount(&set));
+
+    str = roaringSetToStr(&set);
+    TEST_ASSERT_EQUAL_STRING("< -2147483648 | -65537 | -65536 | -1 | 0 | 1 | "
+                             "65535 | 65536 | 2147483647 >",
+                             str);
+    free(str);
+
+    for(size_t i = 0; i < SIZE; ++i) {
+        TEST_ASSERT_TRUE(findRoaringValue(&set, values[i]));
+        TEST_ASSERT_FALSE(findRoaringValue(&set, values[i] ^ 2));
+        TEST_ASSERT_EQUAL(i + 1, getRoaringRank(&set, values[i]));
+    }
+
+    TEST_ASSERT_EQUAL(3, getRoaringRank(&set, -2));
+
+    for(size_t i = 0; i < SIZE; i += 2) {
+        TEST_ASSERT_TRUE(deleteRoaringValue(&set, values[i]));
+        TEST_ASSERT_FALSE(deleteRoaringValue(&set, values[i]));
+    }
+
+    str = roaringSetToStr(&set);
+    TEST_ASSERT_EQUAL_STRING("< -65537 | -1 | 1 | 65536 >", str);
+    free(str);
+
+    deleteEntireRoaring(&set);
+    TEST_ASSERT_EQUAL(0, getRoaringCount(&set));
+    TEST_ASSERT_NULL(set.containers);
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test case: containers switch between
+ *        array, bitmap and runs as values are added and deleted.
+ */
+TEST(RoaringSetFunctions, test_container_types) {
+    RoaringSet set = {0};
+
+    // Every other value of a chunk: an array, then a bitmap above 4096 values
+    for(int value = 0; value < 2 * ROARING_ARRAY_MAX_SIZE; value += 2) {
+        TEST_ASSERT_TRUE(addRoaringValue(&set, value));
+    }
+
+    TEST_ASSERT_EQUAL(ROARING_ARRAY, getContainerType(&set, 0));
+    TEST_ASSERT_TRUE(addRoaringValue(&set, 1));
+    TEST_ASSERT_EQUAL(ROARING_BITMAP, getContainerType(&set, 0));
+    TEST_ASSERT_TRUE(deleteRoaringValue(&set, 1));
+    TEST_ASSERT_EQUAL(ROARING_ARRAY, getContainerType(&set, 0));
+    TEST_ASSERT_EQUAL(ROARING_ARRAY_MAX_SIZE, getRoaringCount(&set));
+
+    // Filling the gaps makes a single run once optimized
+    for(int value = 1; value < 2 * ROARING_ARRAY_MAX_SIZE; value += 2) {
+        TEST_ASSERT_TRUE(addRoaringValue(&set, value));
+    }
+
+    TEST_ASSERT_EQUAL(ROARING_BITMAP, getContainerType(&set, 0));
+    optimizeRoaringSet(&set);
+    TEST_ASSERT_EQUAL(ROARING_RUN, getContainerType(&set, 0));
+    TEST_ASSERT_EQUAL(1, set.containers[0].size);
+
+    // Splitting, shrinking and joining runs
+    TEST_ASSERT_TRUE(deleteRoaringValue(&set, 100));
+    TEST_ASSERT_TRUE(deleteRoaringValue(&set, 0));
+    TEST_ASSERT_TRUE(deleteRoaringValue(&set, 2 * ROARING_ARRAY_MAX_SIZE - 1));
+    TEST_ASSERT_EQUAL(ROARING_RUN, getContainerType(&set, 0));
+    TEST_ASSERT_EQUAL(2, set.containers[0].size);
+    TEST_ASSERT_FALSE(findRoaringValue(&set, 100));
+    TEST_ASSERT_TRUE(findRoaringValue(&set, 101));
+    TEST_ASSERT_EQUAL(99, getRoaringRank(&set, 100));
+
+    TEST_ASSERT_TRUE(addRoaringValue(&set, 100));
+    TEST_ASSERT_TRUE(addRoaringValue(&set, 0));
+    TEST_ASSERT_EQUAL(1, set.containers[0].size);
+    TEST_ASSERT_EQUAL(2 * ROARING_ARRAY_MAX_SIZE - 1, getRoaringCount(&set));
+
+    // Too many runs: the runs become a bitmap, then an array
+    for(int value = 1; value < 2 * ROARING_ARRAY_MAX_SIZE - 1; value += 2) {
+        TEST_ASSERT_TRUE(deleteRoaringValue(&set, value));
+    }
+
+    TEST_ASSERT_EQUAL(ROARING_ARRAY, getContainerType(&set, 0));
+    TEST_ASSERT_EQUAL(ROARING_ARRAY_MAX_SIZE, getRoaringCount(&set));
+
+    for(int value = 0; value < 2 * ROARING_ARRAY_MAX_SIZE; value += 2) {
+        TEST_ASSERT_TRUE(findRoaringValue(&set, value));
+        TEST_ASSERT_FALSE(findRoaringValue(&set, value + 1));
+    }
+
+    deleteEntireRoaring(&set);
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test case: scattered values give the
+ *        same sorted array and ranks as an AVL tree, and an AVL sorted array
+ *        gives back the same set.
+ */
+TEST(RoaringSetFunctions, test_sorted_array) {
+    RoaringSet set = {0};
+    RoaringSet built = {0};
+    AVLNode *root = NULL;
+    const size_t COUNT = 4000;
+
+    for(size_t i = 0; i < COUNT; ++i) {
+        /**
+         * Dense values around zero and sparse ones over the whole range, the
+         * multiplier 2654435761 (about 2^32 divided by the golden ratio)
+         * scattering consecutive indices.
+         */
+        int value = i % 2 ? (int) ((i * 7919) % 30000) - 15000
+                          : (int) ((unsigned) (i / 2) * 2654435761U);
+
+        if(!findAVLNode(root, value)) {
+            TEST_ASSERT_TRUE(addAVLNode(&root, value));
+        }
+
+        addRoaringValue(&set, value);
+    }
+
+    size_t count = getAVLCount(root);
+    int *expected = getAVLAsSortedArray(root);
+    int *sortedValues = getRoaringAsSortedArray(&set);
+
+    TEST_ASSERT_EQUAL(count, getRoaringCount(&set));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, sortedValues, count);
+
+    for(size_t i = 0; i < count; i += 7) {
+        TEST_ASSERT_EQUAL(i + 1, getRoaringRank(&set, expected[i]));
+    }
+
+    TEST_ASSERT_TRUE(buildRoaringFromSortedArray(&built, expected, count));
+    free(sortedValues);
+    sortedValues = getRoaringAsSortedArray(&built);
+    TEST_ASSERT_EQUAL(count, getRoaringCount(&built));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, sortedValues, count);
+
+    // Duplicates are stored once, and unsorted values are rejected
+    int duplicates[] = {-3, -3, 5, 5, 5, 70000};
+    int unsorted[] = {1, 3, 2};
+
+    TEST_ASSERT_TRUE(buildRoaringFromSortedArray(&built, duplicates, 6));
+    TEST_ASSERT_EQUAL(3, getRoaringCount(&built));
+    TEST_ASSERT_FALSE(buildRoaringFromSortedArray(&built, unsorted, 3));
+    TEST_ASSERT_EQUAL(0, getRoaringCount(&built));
+    TEST_ASSERT_TRUE(buildRoaringFromSortedArray(&built, NULL, 0));
+    TEST_ASSERT_NULL(getRoaringAsSortedArray(&built));
+
+    free(expected);
+    free(sortedValues);
+    deleteEntireAVL(&root);
+    deleteEntireRoaring(&set);
+    deleteEntireRoaring(&built);
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test case: union and intersection of
+ *        sets mixing arrays, bitmaps and runs.
+ */
+TEST(RoaringSetFunctions, test_union_and_intersection) {
+    RoaringSet evens = {0};     // Bitmaps
+    RoaringSet range = {0};     // Runs
+    RoaringSet sparse = {0};    // Arrays
+    RoaringSet result = {0};
+    const int LIMIT = 300000;
+
+    for(int value = 0; value < 200000; value += 2) {
+        addRoaringValue(&evens, value);
+    }
+
+    for(int value = 100000; value < LIMIT; ++value) {
+        addRoaringValue(&range, value);
+    }
+
+    for(int value = -50000; value < LIMIT; value += 999) {
+        addRoaringValue(&sparse, value);
+    }
+
+    optimizeRoaringSet(&range);
+    TEST_ASSERT_EQUAL(ROARING_BITMAP, getContainerType(&evens, 0));
+    TEST_ASSERT_EQUAL(ROARING_RUN, getContainerType(&range, 150000));
+    TEST_ASSERT_EQUAL(ROARING_ARRAY, getContainerType(&sparse, 0));
+
+    RoaringSet *sets[] = {&evens, &range, &sparse};
+
+    for(size_t i = 0; i < 3; ++i) {
+        for(size_t j = 0; j < 3; ++j) {
+            TEST_ASSERT_TRUE(getRoaringUnion(sets[i], sets[j], &result));
+
+            size_t count = 0;
+
+            for(int value = -60000; value < LIMIT + 1000; ++value) {
+                bool expected = findRoaringValue(sets[i], value) ||
+                                findRoaringValue(sets[j], value);
+
+                TEST_ASSERT_EQUAL(expected, findRoaringValue(&result, value));
+                count += expected;
+            }
+
+            TEST_ASSERT_EQUAL(count, getRoaringCount(&result));
+            TEST_ASSERT_TRUE(getRoaringIntersection(sets[i],
+                                                    sets[j],
+                                                    &result));
+            count = 0;
+
+            for(int value = -60000; value < LIMIT + 1000; ++value) {
+                bool expected = findRoaringValue(sets[i], value) &&
+                                findRoaringValue(sets[j], value);
+
+                TEST_ASSERT_EQUAL(expected, findRoaringValue(&result, value));
+                count += expected;
+            }
+
+            TEST_ASSERT_EQUAL(count, getRoaringCount(&result));
+        }
+    }
+
+    // The result can be one of the operands
+    TEST_ASSERT_TRUE(getRoaringIntersection(&evens, &range, &evens));
+    TEST_ASSERT_EQUAL(50000, getRoaringCount(&evens));
+    TEST_ASSERT_TRUE(getRoaringUnion(&evens, &range, &range));
+    TEST_ASSERT_EQUAL(200000, getRoaringCount(&range));
+
+    deleteEntireRoaring(&evens);
+    deleteEntireRoaring(&range);
+    deleteEntireRoaring(&sparse);
+    deleteEntireRoaring(&result);
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test case: dense values cost a few bits
+ *        each, and consecutive ones far less than a bit.
+ */
+TEST(RoaringSetFunctions, test_memory_usage) {
+    const size_t COUNT = 1 << 20;
+    int *values = malloc(COUNT * sizeof(int));
+    RoaringSet set = {0};
+
+    TEST_ASSERT_NOT_NULL(values);
+
+    // Consecutive values
+    for(size_t i = 0; i < COUNT; ++i) {
+        values[i] = (int) i - 1000;
+    }
+
+    TEST_ASSERT_TRUE(buildRoaringFromSortedArray(&set, values, COUNT));
+    TEST_ASSERT_LESS_THAN(COUNT / 64, getRoaringMemoryUsage(&set));
+
+    // One value out of two on average, picked by the top bit of a scattering
+    size_t count = 0;
+
+    for(size_t i = 0; i < 2 * COUNT; ++i) {
+        if(((unsigned) i * 2654435761U) >> 31) {
+            values[count++] = (int) i;
+        }
+
+        if(count == COUNT) {
+            break;
+        }
+    }
+
+    TEST_ASSERT_TRUE(buildRoaringFromSortedArray(&set, values, count));
+    TEST_ASSERT_LESS_THAN(count * 3 / 8, getRoaringMemoryUsage(&set));
+
+    free(values);
+    deleteEntireRoaring(&set);
+}
+
+/**
+ * @brief Creates RoaringSetFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(RoaringSetFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(RoaringSetFunctions, test_add_find_delete);
+    RUN_TEST_CASE(RoaringSetFunctions, test_container_types);
+    RUN_TEST_CASE(RoaringSetFunctions, test_sorted_array);
+    RUN_TEST_CASE(RoaringSetFunctions, test_union_and_intersection);
+    RUN_TEST_CASE(RoaringSetFunctions, test_memory_usage);
+};
+
+int main() {
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running the RoaringSetFunctions group tests
+    RUN_TEST_GROUP(RoaringSetFunctions);
+
+    // End testing
+    return UNITY_END();
+}
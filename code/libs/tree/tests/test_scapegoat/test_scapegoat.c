@@ -0,0 +1,326 @@
+/**
+ * @file test_scapegoat.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to scapegoat tree in "scapegoat.h".
+ *        By default, it tests iterative methods. As for recursive methods, a
+ *        corresponding option should be passed.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * REMARK:
+ *
+ * Note that on Windows, we have strcmpi for case-insensitive comparison.
+ * However, on Linux, we have strcasecmp, which is part of strings.h.
+ * In what follows, we use preprocessor commands to deal with such situation.
+*/
+#ifdef _WIN32
+    #define strcasecmp _stricmp
+#else
+    #include <strings.h>
+#endif
+
+#define UNITY_EXCLUDE_THREAD_SUPPORT
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "tree/scapegoat.h"
+
+// Global variable that will be set based on main arguments
+bool recursive = false;
+
+/**
+ * We define function pointers to allow testing iterative and recursive
+ * methods. It is good practice to initialize function pointers with NULL.
+ */
+bool (*add)(ScapegoatTree *, int) = NULL;
+ScapegoatNode *(*find)(ScapegoatTree *, int) = NULL;
+bool (*deleteNode)(ScapegoatTree *, int) = NULL;
+
+/**
+ * @brief It is intended to be run once before all tests (just after
+ *        UNITY_BEGIN()) to properly set function pointers.
+ */
+void moduleSetUp() {
+    if(recursive) {
+        add = addScapegoatNodeRecursively;
+        find = findScapegoatNodeRecursively;
+        deleteNode = deleteScapegoatNodeRecursively;
+    }
+    else {
+        add = addScapegoatNode;
+        find = findScapegoatNode;
+        deleteNode = deleteScapegoatNode;
+    }
+}
+
+/**
+ * @brief Tells if a scapegoat tree satisfies the (non-strict) binary search
+ *        tree property, i.e. all values are within [minValue, maxValue].
+ *
+ * @param root Pointer to the root node of the (sub-)tree.
+ *
+ * @param minValue The minimum allowed value in the subtree.
+ *
+ * @param maxValue The maximum allowed value in the subtree.
+ *
+ * @return True if the subtree satisfies the property and false otherwise.
+ */
+bool isOrdered(ScapegoatNode *root, long minValue, long maxValue) {
+    bool ordered = true;
+
+    if(root) {
+        ordered = root->value >= minValue && root->value <= maxValue &&
+                  isOrdered(root->left, minValue, root->value) &&
+                  isOrdered(root->right, root->value, maxValue);
+    }
+
+    return ordered;
+}
+
+/**
+ * @brief Computes the maximum height allowed for a scapegoat tree, which is
+ *        floor(log_{1/alpha}(maxCount)) + 1 (counted in nodes).
+ *
+ * @param tree Pointer to the scapegoat tree.
+ *
+ * @return The maximum allowed height.
+ */
+size_t getMaxAllowedHeight(ScapegoatTree *tree) {
+    size_t height = 1;
+    double power = 1.0;
+    const double FACTOR = (double) SCAPEGOAT_ALPHA_DENOMINATOR /
+                          SCAPEGOAT_ALPHA_NUMERATOR;
+
+    while(power * FACTOR <= (double) tree->maxCount) {
+        power *= FACTOR;
+        ++height;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test group.
+ */
+TEST_GROUP(ScapegoatFunctions);
+
+/**
+ * @brief Creates ScapegoatFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(ScapegoatFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates ScapegoatFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(ScapegoatFunctions) {
+    // Add any test teardown code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates ScapegoatFunctions test case: node footprint is that of BST.
+ */
+TEST(ScapegoatFunctions, test_node_size) {
+    TEST_ASSERT_EQUAL(sizeof(BSTNode), sizeof(ScapegoatNode));
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test case: sorted insertions (worst case
+ *        for a plain BST) keep a logarithmic height.
+ */
+TEST(ScapegoatFunctions, test_sorted_insertions) {
+    ScapegoatTree tree = {0};
+    const int COUNT = 1000;
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(add(&tree, i));
+        TEST_ASSERT_EQUAL(i + 1, getScapegoatCount(&tree));
+        TEST_ASSERT_TRUE(getScapegoatHeight(&tree) <=
+                         getMaxAllowedHeight(&tree));
+    }
+
+    TEST_ASSERT_EQUAL(COUNT, getBSTCount(tree.root));
+    TEST_ASSERT_TRUE(isOrdered(tree.root, -100000, 100000));
+
+    // Descending insertions as well
+    for(int i = -1; i >= -COUNT; --i) {
+        TEST_ASSERT_TRUE(add(&tree, i));
+        TEST_ASSERT_TRUE(getScapegoatHeight(&tree) <=
+                         getMaxAllowedHeight(&tree));
+    }
+
+    TEST_ASSERT_EQUAL(2 * COUNT, getScapegoatCount(&tree));
+    TEST_ASSERT_TRUE(isOrdered(tree.root, -100000, 100000));
+
+    int *sortedArray = getScapegoatAsSortedArray(&tree);
+    TEST_ASSERT_TRUE(sortedArray != NULL);
+
+    for(int i = 0; i < 2 * COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i - COUNT, sortedArray[i]);
+    }
+
+    free(sortedArray);
+
+    for(int i = -COUNT; i < COUNT; ++i) {
+        ScapegoatNode *node = find(&tree, i);
+        TEST_ASSERT_TRUE(node != NULL);
+        TEST_ASSERT_EQUAL(i, node->value);
+    }
+
+    TEST_ASSERT_EQUAL(NULL, find(&tree, COUNT));
+
+    int minValue, maxValue;
+    TEST_ASSERT_TRUE(minScapegoat(&tree, &minValue));
+    TEST_ASSERT_EQUAL(-COUNT, minValue);
+    TEST_ASSERT_TRUE(maxScapegoat(&tree, &maxValue));
+    TEST_ASSERT_EQUAL(COUNT - 1, maxValue);
+
+    deleteEntireScapegoat(&tree);
+    TEST_ASSERT_EQUAL(NULL, tree.root);
+    TEST_ASSERT_EQUAL(0, getScapegoatCount(&tree));
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test case: deletions shrink the tree and
+ *        trigger full rebuilds that keep the height logarithmic.
+ */
+TEST(ScapegoatFunctions, test_deletions) {
+    ScapegoatTree tree = {0};
+    const int COUNT = 512;
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(add(&tree, i));
+    }
+
+    // Attempting to delete non-existing item
+    TEST_ASSERT_FALSE(deleteNode(&tree, COUNT));
+    TEST_ASSERT_EQUAL(COUNT, getScapegoatCount(&tree));
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(deleteNode(&tree, i));
+        TEST_ASSERT_EQUAL(NULL, find(&tree, i));
+        TEST_ASSERT_EQUAL(COUNT - i - 1, getScapegoatCount(&tree));
+        TEST_ASSERT_EQUAL(COUNT - i - 1, getBSTCount(tree.root));
+        TEST_ASSERT_TRUE(isOrdered(tree.root, -100000, 100000));
+        TEST_ASSERT_TRUE(getScapegoatHeight(&tree) <=
+                         getMaxAllowedHeight(&tree));
+        TEST_ASSERT_TRUE(tree.count <= tree.maxCount);
+    }
+
+    TEST_ASSERT_EQUAL(NULL, tree.root);
+    TEST_ASSERT_EQUAL(0, tree.maxCount);
+    TEST_ASSERT_FALSE(deleteNode(&tree, 0));
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test case: duplicates are allowed.
+ */
+TEST(ScapegoatFunctions, test_duplicate_items) {
+    ScapegoatTree tree = {0};
+    char *str = NULL;
+    int nums[] = {8, 3, 5, 1, 7, 9, 2, 6, 8, 5, 8, 8, 8, 8};
+    size_t len = sizeof(nums) / sizeof(int);
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(add(&tree, nums[i]));
+        TEST_ASSERT_TRUE(isOrdered(tree.root, -1000, 1000));
+    }
+
+    str = scapegoatTreeToStr(&tree);
+    TEST_ASSERT_EQUAL_STRING(
+                    "< 1 | 2 | 3 | 5 | 5 | 6 | 7 | 8 | 8 | 8 | 8 | 8 | 8 | 9 >",
+                    str);
+    free(str);
+
+    // Deleting duplicates one at a time
+    for(size_t i = 0; i < 6; ++i) {
+        TEST_ASSERT_TRUE(find(&tree, 8) != NULL);
+        TEST_ASSERT_TRUE(deleteNode(&tree, 8));
+        TEST_ASSERT_EQUAL(len - i - 1, getScapegoatCount(&tree));
+        TEST_ASSERT_TRUE(isOrdered(tree.root, -1000, 1000));
+    }
+
+    TEST_ASSERT_FALSE(deleteNode(&tree, 8));
+    TEST_ASSERT_EQUAL(NULL, find(&tree, 8));
+
+    str = scapegoatTreeToStr(&tree);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 5 | 5 | 6 | 7 | 9 >", str);
+    free(str);
+
+    deleteEntireScapegoat(&tree);
+    TEST_ASSERT_EQUAL(NULL, tree.root);
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test case: testing scapegoatTreeToStr.
+ */
+TEST(ScapegoatFunctions, test_scapegoatTreeToStr) {
+    ScapegoatTree tree = {0};
+    char *str = NULL;
+
+    str = scapegoatTreeToStr(&tree);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(add(&tree, 8));
+    str = scapegoatTreeToStr(&tree);
+    TEST_ASSERT_EQUAL_STRING("< 8 >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(add(&tree, -3));
+    TEST_ASSERT_TRUE(add(&tree, 12));
+    str = scapegoatTreeToStr(&tree);
+    TEST_ASSERT_EQUAL_STRING("< -3 | 8 | 12 >", str);
+    free(str);
+
+    deleteEntireScapegoat(&tree);
+    TEST_ASSERT_EQUAL(NULL, tree.root);
+}
+
+/**
+ * @brief Creates ScapegoatFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(ScapegoatFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(ScapegoatFunctions, test_node_size);
+    RUN_TEST_CASE(ScapegoatFunctions, test_sorted_insertions);
+    RUN_TEST_CASE(ScapegoatFunctions, test_deletions);
+    RUN_TEST_CASE(ScapegoatFunctions, test_duplicate_items);
+    RUN_TEST_CASE(ScapegoatFunctions, test_scapegoatTreeToStr);
+};
+
+int main(int argc, char *args[]) {
+    /**
+     * Consuming "--recursive" argument if passed
+    */
+    if(argc > 2) {
+        // Printing to standard error (square brackets enclose optional args)
+        fprintf(stderr, "Usage: %s [--recursive]\n", args[0]);
+
+        // Exist with an error
+        exit(1);
+    }
+    else {
+        if(argc == 2 && strcasecmp(args[1], "--recursive") == 0) {
+            recursive = true;
+        }
+    }
+
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running moduleSetUp to properly set the different function pointers
+    moduleSetUp();
+
+    // Running the ScapegoatFunctions group tests
+    RUN_TEST_GROUP(ScapegoatFunctions);
+
+    // End testing
+    return UNITY_END();
+}
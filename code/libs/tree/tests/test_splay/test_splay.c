@@ -0,0 +1,312 @@
+/**
+ * @file test_splay.c
+ *
+ * @author Samah A. SHAYYA
+ *
+ * @brief This tests the functions related to splay tree in "splay.h". By
+ *        default, it tests iterative (top-down) methods. As for recursive
+ *        methods, a corresponding option should be passed.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * REMARK:
+ *
+ * Note that on Windows, we have strcmpi for case-insensitive comparison.
+ * However, on Linux, we have strcasecmp, which is part of strings.h.
+ * In what follows, we use preprocessor commands to deal with such situation.
+*/
+#ifdef _WIN32
+    #define strcasecmp _stricmp
+#else
+    #include <strings.h>
+#endif
+
+#define UNITY_EXCLUDE_THREAD_SUPPORT
+#include "unity.h"
+#include "unity_fixture.h"
+
+#include "tree/splay.h"
+
+// Global variable that will be set based on main arguments
+bool recursive = false;
+
+/**
+ * We define function pointers to allow testing iterative and recursive
+ * methods. It is good practice to initialize function pointers with NULL.
+ */
+bool (*add)(SplayNode **, int) = NULL;
+SplayNode *(*find)(SplayNode **, int) = NULL;
+bool (*deleteNode)(SplayNode **, int) = NULL;
+
+/**
+ * @brief It is intended to be run once before all tests (just after
+ *        UNITY_BEGIN()) to properly set function pointers.
+ */
+void moduleSetUp() {
+    if(recursive) {
+        add = addSplayNodeRecursively;
+        find = findSplayNodeRecursively;
+        deleteNode = deleteSplayNodeRecursively;
+    }
+    else {
+        add = addSplayNode;
+        find = findSplayNode;
+        deleteNode = deleteSplayNode;
+    }
+}
+
+/**
+ * @brief Tells if a splay tree satisfies the (non-strict) binary search tree
+ *        property, i.e. all values are within [minValue, maxValue].
+ *
+ * @param root Pointer to the root node of the splay tree.
+ *
+ * @param minValue The minimum allowed value in the subtree.
+ *
+ * @param maxValue The maximum allowed value in the subtree.
+ *
+ * @return True if the subtree satisfies the property and false otherwise.
+ */
+bool isOrdered(SplayNode *root, long minValue, long maxValue) {
+    bool ordered = true;
+
+    if(root) {
+        ordered = root->value >= minValue && root->value <= maxValue &&
+                  isOrdered(root->left, minValue, root->value) &&
+                  isOrdered(root->right, root->value, maxValue);
+    }
+
+    return ordered;
+}
+
+/**
+ * @brief Creates SplayFunctions test group.
+ */
+TEST_GROUP(SplayFunctions);
+
+/**
+ * @brief Creates SplayFunctions group setup that run prior to every test.
+ */
+TEST_SETUP(SplayFunctions) {
+    // Add any test setup code here or keep empty (it runs before each test)
+};
+
+/**
+ * @brief Creates SplayFunctions group teardown that run after every test.
+ */
+TEST_TEAR_DOWN(SplayFunctions) {
+    // Add any test teardown code here or keep empty (it runs after each test)
+};
+
+/**
+ * @brief Creates SplayFunctions test case: added and found values become the
+ *        root of the tree.
+ */
+TEST(SplayFunctions, test_access_moves_to_root) {
+    SplayNode *root = NULL;
+    int nums[] = {8, 3, 10, 5, 1, 12, 7, 9, 2, 6};
+    size_t len = sizeof(nums) / sizeof(int);
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(add(&root, nums[i]));
+        TEST_ASSERT_EQUAL(i + 1, getSplayCount(root));
+        TEST_ASSERT_EQUAL(nums[i], root->value);
+        TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+    }
+
+    for(size_t i = 0; i < len; ++i) {
+        SplayNode *node = find(&root, nums[len - i - 1]);
+
+        TEST_ASSERT_TRUE(node != NULL);
+        TEST_ASSERT_EQUAL_PTR(root, node);
+        TEST_ASSERT_EQUAL(nums[len - i - 1], root->value);
+        TEST_ASSERT_EQUAL(len, getSplayCount(root));
+        TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+    }
+
+    // Non-existing values are not found but the tree remains valid
+    TEST_ASSERT_EQUAL(NULL, find(&root, 4));
+    TEST_ASSERT_EQUAL(NULL, find(&root, -55));
+    TEST_ASSERT_EQUAL(NULL, find(&root, 55));
+    TEST_ASSERT_EQUAL(len, getSplayCount(root));
+    TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+
+    int minValue, maxValue;
+    TEST_ASSERT_TRUE(minSplay(root, &minValue));
+    TEST_ASSERT_EQUAL(1, minValue);
+    TEST_ASSERT_TRUE(maxSplay(root, &maxValue));
+    TEST_ASSERT_EQUAL(12, maxValue);
+
+    deleteEntireSplay(&root);
+    TEST_ASSERT_EQUAL(NULL, root);
+}
+
+/**
+ * @brief Creates SplayFunctions test case: duplicates are allowed.
+ */
+TEST(SplayFunctions, test_duplicate_items) {
+    SplayNode *root = NULL;
+    char *str = NULL;
+    int nums[] = {8, 3, 5, 1, 7, 9, 2, 6, 8, 5, 8};
+    size_t len = sizeof(nums) / sizeof(int);
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(add(&root, nums[i]));
+        TEST_ASSERT_EQUAL(i + 1, getSplayCount(root));
+        TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+    }
+
+    str = splayTreeToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 5 | 5 | 6 | 7 | 8 | 8 | 8 | 9 >",
+                             str);
+    free(str);
+
+    // Deleting duplicates one at a time
+    for(size_t i = 0; i < 3; ++i) {
+        TEST_ASSERT_TRUE(deleteNode(&root, 8));
+        TEST_ASSERT_EQUAL(len - i - 1, getSplayCount(root));
+        TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+    }
+
+    TEST_ASSERT_FALSE(deleteNode(&root, 8));
+    TEST_ASSERT_EQUAL(NULL, find(&root, 8));
+
+    str = splayTreeToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< 1 | 2 | 3 | 5 | 5 | 6 | 7 | 9 >", str);
+    free(str);
+
+    deleteEntireSplay(&root);
+    TEST_ASSERT_EQUAL(NULL, root);
+}
+
+/**
+ * @brief Creates SplayFunctions test case: one-by-one deletion.
+ */
+TEST(SplayFunctions, test_one_by_one_deletion) {
+    SplayNode *root = NULL;
+    int nums[] = {50, 30, 70, 20, 40, 60, 80, 10, 90, 100, 45, 35, 65, 75};
+    size_t len = sizeof(nums) / sizeof(int);
+
+    for(size_t i = 0; i < len; ++i) {
+        TEST_ASSERT_TRUE(add(&root, nums[i]));
+    }
+
+    // Attempting to delete non-existing item
+    TEST_ASSERT_FALSE(deleteNode(&root, 11));
+    TEST_ASSERT_EQUAL(len, getSplayCount(root));
+
+    for(size_t j = 0; j < len; ++j) {
+        TEST_ASSERT_TRUE(find(&root, nums[j]) != NULL);
+        TEST_ASSERT_TRUE(deleteNode(&root, nums[j]));
+        TEST_ASSERT_EQUAL(NULL, find(&root, nums[j]));
+        TEST_ASSERT_EQUAL(len - j - 1, getSplayCount(root));
+        TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+    }
+
+    TEST_ASSERT_EQUAL(NULL, root);
+}
+
+/**
+ * @brief Creates SplayFunctions test case: sorted insertions degenerate the
+ *        tree but accesses restructure it.
+ */
+TEST(SplayFunctions, test_sorted_insertions) {
+    SplayNode *root = NULL;
+    const int COUNT = 256;
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_TRUE(add(&root, i));
+    }
+
+    // Sorted insertions result in a left-going chain
+    TEST_ASSERT_EQUAL(COUNT, getSplayHeight(root));
+
+    // Accessing the deepest node roughly halves the depth of the access path
+    TEST_ASSERT_TRUE(find(&root, 0) != NULL);
+    TEST_ASSERT_EQUAL(0, root->value);
+    TEST_ASSERT_TRUE(getSplayHeight(root) <= COUNT / 2 + 2);
+    TEST_ASSERT_TRUE(isOrdered(root, -1000, 1000));
+
+    int *sortedArray = getSplayAsSortedArray(root);
+    TEST_ASSERT_TRUE(sortedArray != NULL);
+
+    for(int i = 0; i < COUNT; ++i) {
+        TEST_ASSERT_EQUAL(i, sortedArray[i]);
+    }
+
+    free(sortedArray);
+
+    deleteEntireSplay(&root);
+    TEST_ASSERT_EQUAL(NULL, root);
+}
+
+/**
+ * @brief Creates SplayFunctions test case: testing splayTreeToStr.
+ */
+TEST(SplayFunctions, test_splayTreeToStr) {
+    SplayNode *root = NULL;
+    char *str = NULL;
+
+    str = splayTreeToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(add(&root, 8));
+    str = splayTreeToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< 8 >", str);
+    free(str);
+
+    TEST_ASSERT_TRUE(add(&root, -3));
+    TEST_ASSERT_TRUE(add(&root, 12));
+    str = splayTreeToStr(root);
+    TEST_ASSERT_EQUAL_STRING("< -3 | 8 | 12 >", str);
+    free(str);
+
+    deleteEntireSplay(&root);
+    TEST_ASSERT_EQUAL(NULL, root);
+}
+
+/**
+ * @brief Creates SplayFunctions test group runner.
+ */
+TEST_GROUP_RUNNER(SplayFunctions) {
+    // Adding all test cases
+    RUN_TEST_CASE(SplayFunctions, test_access_moves_to_root);
+    RUN_TEST_CASE(SplayFunctions, test_duplicate_items);
+    RUN_TEST_CASE(SplayFunctions, test_one_by_one_deletion);
+    RUN_TEST_CASE(SplayFunctions, test_sorted_insertions);
+    RUN_TEST_CASE(SplayFunctions, test_splayTreeToStr);
+};
+
+int main(int argc, char *args[]) {
+    /**
+     * Consuming "--recursive" argument if passed
+    */
+    if(argc > 2) {
+        // Printing to standard error (square brackets enclose optional args)
+        fprintf(stderr, "Usage: %s [--recursive]\n", args[0]);
+
+        // Exist with an error
+        exit(1);
+    }
+    else {
+        if(argc == 2 && strcasecmp(args[1], "--recursive") == 0) {
+            recursive = true;
+        }
+    }
+
+    // Start testing
+    UNITY_BEGIN();
+
+    // Running moduleSetUp to properly set the different function pointers
+    moduleSetUp();
+
+    // Running the SplayFunctions group tests
+    RUN_TEST_GROUP(SplayFunctions);
+
+    // End testing
+    return UNITY_END();
+}